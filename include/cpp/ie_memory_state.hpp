@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include <memory>
 #include <string>
 
 namespace InferenceEngine {
@@ -55,6 +56,22 @@ class MemoryState {
     void SetState(Blob::Ptr state) {
         CALL_STATUS_FNC(SetState, state);
     }
+
+    /**
+     * @brief Wraps original method
+     * IMemoryStateSwappable::SwapState, throws NOT_IMPLEMENTED if the state is not an IMemoryStateSwappable
+     * @param state The blob to bind as the storage of the state
+     * @return The blob with the previous state
+     */
+    Blob::Ptr SwapState(Blob::Ptr state) {
+        auto swappable = std::dynamic_pointer_cast<IMemoryStateSwappable>(actual);
+        if (!swappable)
+            throw NotImplemented("SwapState is not supported by memory state " + GetName());
+        ResponseDesc resp;
+        auto res = swappable->SwapState(state, &resp);
+        if (res != OK) InferenceEngine::details::extract_exception(res, resp.msg);
+        return state;
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -38,6 +38,22 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipelined execution of subgraphs. Every subgraph has its own pool of
+ * infer requests shared by all infer requests of the executable network, so different infer requests run
+ * different subgraphs at the same time. CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) is not applied to the subgraphs
+ * in this mode. Subgraphs of the same device are made by affinities with different suffixes, e.g. "CPU.0" and "CPU.1".
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
+/**
+ * @brief The key for the number of infer requests of every subgraph in the pipelined execution.
+ * The value is a non-negative integer, "0" (default) means the OPTIMAL_NUMBER_OF_INFER_REQUESTS
+ * metric of the subgraph executable network
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS);
+
 /**
  * @deprecated Use DLIA_CONFIG_KEY(DUMP_SUPPORTED_LAYERS_INFORMATION) FPGA configuration boolean key instead
  * @brief The bool key to define whether information messages with a reason are printed in case the layer is unsupported by DLA
@@ -137,6 +137,7 @@ enum ColorFormat : uint32_t {
     RGBX,        ///< RGBX color format with X ignored during inference
     BGRX,        ///< BGRX color format with X ignored during inference
     NV12,        ///< NV12 color format represented as compound Y+UV blob
+    I420,        ///< I420 color format represented as compound Y+U+V blob
 };
 inline std::ostream & operator << (std::ostream &out, const ColorFormat & fmt) {
     switch (fmt) {
@@ -149,6 +150,7 @@ inline std::ostream & operator << (std::ostream &out, const ColorFormat & fmt) {
         PRINT_COLOR_FORMAT(RGBX);
         PRINT_COLOR_FORMAT(BGRX);
         PRINT_COLOR_FORMAT(NV12);
+        PRINT_COLOR_FORMAT(I420);
 
 #undef PRINT_COLOR_FORMAT
 
@@ -215,4 +215,167 @@ public:
     virtual const Blob::Ptr& uv() const noexcept;
 };
 
+/**
+ * @brief Represents a blob that contains three planes (Y, U and V) in I420 color format.
+ * Planes are not copied, so the blob may wrap the planes of a decoded frame
+ */
+class INFERENCE_ENGINE_API_CLASS(I420Blob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the I420Blob object
+     */
+    using Ptr = std::shared_ptr<I420Blob>;
+
+    /**
+     * @brief A smart pointer to the const I420Blob object
+     */
+    using CPtr = std::shared_ptr<const I420Blob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    I420Blob() = delete;
+
+    /**
+     * @brief Constructs I420 blob from three planes Y, U and V
+     * @param y Blob object that represents Y plane in I420 color format
+     * @param u Blob object that represents U plane in I420 color format
+     * @param v Blob object that represents V plane in I420 color format
+     */
+    I420Blob(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr& v);
+
+    /**
+     * @brief Constructs I420 blob from three planes Y, U and V
+     * @param y Blob object that represents Y plane in I420 color format
+     * @param u Blob object that represents U plane in I420 color format
+     * @param v Blob object that represents V plane in I420 color format
+     */
+    I420Blob(Blob::Ptr&& y, Blob::Ptr&& u, Blob::Ptr&& v);
+
+    /**
+     * @brief A virtual destructor
+     */
+    virtual ~I420Blob() = default;
+
+    /**
+     * @brief A copy constructor
+     */
+    I420Blob(const I420Blob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    I420Blob& operator=(const I420Blob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    I420Blob(I420Blob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    I420Blob& operator=(I420Blob&& blob) = default;
+
+    /**
+     * @brief Returns a shared pointer to Y plane
+     */
+    virtual Blob::Ptr& y() noexcept;
+
+    /**
+     * @brief Returns a shared pointer to Y plane
+     */
+    virtual const Blob::Ptr& y() const noexcept;
+
+    /**
+     * @brief Returns a shared pointer to U plane
+     */
+    virtual Blob::Ptr& u() noexcept;
+
+    /**
+     * @brief Returns a shared pointer to U plane
+     */
+    virtual const Blob::Ptr& u() const noexcept;
+
+    /**
+     * @brief Returns a shared pointer to V plane
+     */
+    virtual Blob::Ptr& v() noexcept;
+
+    /**
+     * @brief Returns a shared pointer to V plane
+     */
+    virtual const Blob::Ptr& v() const noexcept;
+};
+
+/**
+ * @brief Represents a batch of images (usually ROIs of one frame) for the input pre-processing.
+ * Every image is pre-processed into the corresponding item of the network's input batch. Images are
+ * either memory blobs of the batch size 1, NV12 blobs or I420 blobs and may have different sizes.
+ * Items of the network's input batch past the images are zeroed unless the dynamic batch limits the batch
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedBlob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    BatchedBlob() = delete;
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     * @param blobs A vector of memory blobs of the same precision and layout, of NV12 blobs or of I420 blobs
+     */
+    explicit BatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     * @param blobs A vector of memory blobs of the same precision and layout, of NV12 blobs or of I420 blobs
+     */
+    explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
+
+    /**
+     * @brief A virtual destructor
+     */
+    virtual ~BatchedBlob() = default;
+
+    /**
+     * @brief A copy constructor
+     */
+    BatchedBlob(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    BatchedBlob& operator=(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    BatchedBlob(BatchedBlob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    BatchedBlob& operator=(BatchedBlob&& blob) = default;
+};
+
+/**
+ * @brief Creates a batched blob of the given ROIs of one frame with pre-allocated memory.
+ * ROI blobs share the memory of the frame, so the pre-processing reads the pixels of the ROIs only.
+ * @param inputBlob A frame: a memory blob of the batch size 1, an NV12 blob or an I420 blob
+ * @param rois ROI objects inside of the frame, the i-th ROI is the i-th item of the batch
+ * @return A shared pointer to the newly created BatchedBlob object
+ */
+INFERENCE_ENGINE_API_CPP(BatchedBlob::Ptr) make_shared_blob(const Blob::Ptr &inputBlob, const std::vector<ROI> &rois);
+
 }  // namespace InferenceEngine
@@ -72,6 +72,44 @@ struct LayerConfig {
     std::vector<DataConfig> outConfs;
 };
 
+/**
+ * @struct LayerPostOp
+ * @brief This structure describes an operation applied to the output of the layer implementation.
+ * The plugin fuses the operation following the layer into the implementation which supports it.
+ */
+struct LayerPostOp {
+    /**
+     * @brief Kinds of post operations
+     */
+    enum Type {
+        Relu,        // x > 0 ? x : alpha * x
+        Elu,         // x > 0 ? x : alpha * (exp(x) - 1)
+        Logistic,    // 1 / (1 + exp(-x))
+        Tanh,        // tanh(x)
+        Clamp,       // min(max(x, alpha), beta)
+        ScaleShift,  // x * data[0][c] + data[1][c]
+        Quantize     // FakeQuantize with input low/high data[0][c], data[1][c] and output low/high data[2][c], data[3][c]
+    };
+
+    /**
+     * @brief Kind of the operation
+     */
+    Type type = Relu;
+    /**
+     * @brief Parameters of activation functions
+     */
+    float alpha = 0.f;
+    float beta = 0.f;
+    /**
+     * @brief Per channel values of ScaleShift and Quantize, a vector of the only value is broadcasted to all channels
+     */
+    std::vector<std::vector<float>> data;
+    /**
+     * @brief Number of Quantize levels
+     */
+    size_t levels = 0;
+};
+
 /**
  * @brief This class provides interface for extension implementations
  */
@@ -117,6 +155,30 @@ public:
                                std::vector<Blob::Ptr>& outputs, ResponseDesc* resp) noexcept = 0;
 };
 
+/**
+ * @brief This class provides interface for the implementation with the custom execution code
+ * which is able to apply operations following the layer to its output.
+ * The plugin detects the interface at runtime, implementations of ILayerExecImpl only don't support post operations
+ */
+class ILayerExecImplWithPostOps : public ILayerExecImpl {
+public:
+    /**
+     * @brief Checks if the implementation is able to apply the operation to its only output
+     * @param postOp Operation following the layer
+     * @return true if the operation can be fused into the implementation
+     */
+    virtual bool isPostOpSupported(const LayerPostOp& postOp) const noexcept = 0;
+
+    /**
+     * @brief Sets operations which execute() must apply in the given order to the output.
+     * Called after init() with the operations every one of which is supported by the implementation
+     * @param postOps Operations following the layer
+     * @param resp Response descriptor
+     * @return Status code
+     */
+    virtual StatusCode setPostOps(const std::vector<LayerPostOp>& postOps, ResponseDesc* resp) noexcept = 0;
+};
+
 /**
  * @brief This class provides interface for extension factories
  */
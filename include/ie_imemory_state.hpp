@@ -57,4 +57,26 @@ class IMemoryState : public details::no_copy {
     virtual StatusCode GetLastState(Blob::CPtr & lastState, ResponseDesc *resp) const noexcept = 0;
 };
 
-}  // namespace InferenceEngine
\ No newline at end of file
+/**
+ * @brief memory state which storage can be exchanged without a copy.
+ * @details It extends IMemoryState instead of adding a method to it to keep the binary interface of the existing plugins,
+ * the support is queried by dynamic_cast from IMemoryState.
+ */
+class IMemoryStateSwappable : public IMemoryState {
+ public:
+    using Ptr = std::shared_ptr<IMemoryStateSwappable>;
+
+    /**
+     * @brief Binds the memory of the given blob as the storage of the state without copying it.
+     * @details After the call the network reads and updates the state directly in the memory of the blob and the blob
+     * receives the storage that was used before, so independent sessions can be switched by exchanging their blobs.
+     * The blob must have the precision, dimensions and layout of the state. It must not be called while an inference
+     * of the network is running.
+     * @param state The blob with the state to bind, on success it is replaced by the blob with the previous state
+     * @param  resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode SwapState(Blob::Ptr & state, ResponseDesc *resp) noexcept = 0;
+};
+
+}  // namespace InferenceEngine
@@ -145,6 +145,53 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+* @brief Metric to get a size in bytes of memory shared by intermediate tensors of executable network.
+* String value is "MEMORY_ARENA_SIZE"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_ARENA_SIZE, uint64_t);
+
+/**
+* @brief Metric to get a size in bytes of memory which intermediate tensors would take with the
+* greedy by size placement, a baseline for MEMORY_ARENA_SIZE. String value is "MEMORY_ARENA_SIZE_GREEDY"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_ARENA_SIZE_GREEDY, uint64_t);
+
+/**
+* @brief Metric to get a lower bound in bytes for MEMORY_ARENA_SIZE, i.e. max total size of
+* intermediate tensors alive at the same time. String value is "MEMORY_ARENA_LOWER_BOUND"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_ARENA_LOWER_BOUND, uint64_t);
+
+/**
+* @brief Metric to get a part of time (from 0 to 1) each CPU stream was busy with infer requests
+* since the executable network was loaded. String value is "STREAMS_UTILIZATION"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_UTILIZATION, std::vector<float>);
+
+/**
+* @brief Metric to get a number of infer requests executed by each CPU stream. String value is "STREAMS_EXECUTED_REQUESTS"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_EXECUTED_REQUESTS, std::vector<uint64_t>);
+
+/**
+* @brief Metric to get a number of infer requests executed by an already compiled graph of a shape bucket
+* (see PluginConfigParams::KEY_CPU_SHAPE_BUCKETS). String value is "SHAPE_BUCKETS_HITS"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(SHAPE_BUCKETS_HITS, uint64_t);
+
+/**
+* @brief Metric to get a number of infer requests which compiled the graph of their shape bucket.
+* String value is "SHAPE_BUCKETS_MISSES"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(SHAPE_BUCKETS_MISSES, uint64_t);
+
+/**
+* @brief Metric to get a number of infer requests whose inputs were padded up to the shapes of a larger bucket.
+* String value is "SHAPE_BUCKETS_PADDED_REQUESTS"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(SHAPE_BUCKETS_PADDED_REQUESTS, uint64_t);
+
 }  // namespace Metrics
 
 /**
@@ -194,12 +241,65 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 * - KEY_CPU_THROUGHPUT_AUTO creates bare minimum of streams to improve the performance,
 *   this is the most portable option if you have no insights into how many cores you target machine will have
 *   (and what is the optimal number of streams)
+* - KEY_CPU_THROUGHPUT_CALIBRATE measures the throughput of the network for several numbers of streams
+*   (and threads per stream) when the network is loaded and creates the streams of the best one,
+*   see KEY_CPU_CALIBRATION_LATENCY_BOUND and KEY_CPU_CALIBRATION_CACHE
 * - finally, specifying the positive integer value creates the requested number of streams
 */
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
+DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_CALIBRATE);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+* @brief The key sets the bound of the average latency (in milliseconds) for the streams calibration.
+* The calibration selects the best throughput among the configurations with the latency below the bound,
+* or the lowest latency if no configuration satisfies it. Zero (default) means no bound.
+*/
+DECLARE_CONFIG_KEY(CPU_CALIBRATION_LATENCY_BOUND);
+
+/**
+* @brief The key sets the file the results of the streams calibration are persisted to.
+* Results are keyed by the hash of the network (topology and weights), the CPU model and the latency bound,
+* so the network is calibrated once per machine type. The file is replaced as a whole on every update,
+* so the processes sharing it never read it partially written. Empty string (default) keeps the results
+* in the process memory only.
+*/
+DECLARE_CONFIG_KEY(CPU_CALIBRATION_CACHE);
+
+/**
+* @brief The key enables concurrent execution of independent branches of the network graph on the CPU.
+* Nodes which do not depend on each other are grouped into stages and executed in parallel within the stage.
+* Mostly useful for latency (batch 1) cases of models with many small parallel branches.
+* Supported with TBB threading only, with other threading options nodes are executed sequentially.
+* This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+* @brief The key allows CPU streams to borrow threads of idle streams on the same socket.
+* Every stream still has its own threads pinned to its own cores, but parallel work of a busy stream
+* can be picked up by threads of idle neighbour streams, which helps with requests of different complexity.
+* The streams of a socket share the threads of the network, so their total number is the same as without borrowing.
+* Supported with TBB threading only and ignored for a single stream.
+* This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
+/**
+* @brief The key sets input shapes besides the ones of the network, the CPU executable network accepts them
+* without reshape and reload of the network. Buckets are separated by ';', each bucket lists the shapes of
+* inputs separated by ',' in the "name:dim0xdim1x...xdimN" form, e.g. "data:1x3x320x320;data:1x3x640x640".
+* Inputs missing in the bucket keep the shapes of the network.
+* A graph is compiled on the first request of the bucket and shares the weights with other graphs.
+* An input blob with the shape of a bucket is executed by its graph, a smaller blob is padded with zeros
+* up to the smallest bucket covering it. Output blobs get the shapes of the bucket, so they should be
+* requested by GetBlob() after the inference. Supported for a single stream only and for networks
+* without memory layers, as the graphs of the buckets can't share the states of the network graph.
+* Empty string (default) switches the buckets off.
+*/
+DECLARE_CONFIG_KEY(CPU_SHAPE_BUCKETS);
+
 /**
 * @brief Optimize GPU plugin execution to maximize throughput.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
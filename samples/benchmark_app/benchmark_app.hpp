@@ -84,6 +84,10 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for reorders report option
+static const char reorders_message[] = "Optional. Report the number of layout reorders inserted into the executable graph "
+                                       "and of concatenations copying their inputs, and the share of the execution time they take.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -154,6 +158,9 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for showing reorders of the executable graph <br>
+DEFINE_bool(reorders, false, reorders_message);
+
 /**
 * @brief This function show a help message
 */
@@ -185,4 +192,5 @@ static void showUsage() {
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -reorders                 " << reorders_message << std::endl;
 }
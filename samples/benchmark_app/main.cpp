@@ -250,6 +250,7 @@ int main(int argc, char *argv[]) {
         bool perf_counts = (FLAGS_report_type == detailedCntReport ||
                             FLAGS_report_type == averageCntReport ||
                             FLAGS_pc ||
+                            FLAGS_reorders ||
                             !FLAGS_exec_graph_path.empty());
 
         auto devices = parseDevices(device_name);
@@ -505,6 +506,57 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        if (FLAGS_reorders) {
+            try {
+                CNNNetwork execGraphInfo = exeNetwork.GetExecGraphInfo();
+                size_t reorders = 0, copyConcats = 0;
+                double reordersTime = 0.0, copyConcatsTime = 0.0, totalTime = 0.0;
+                for (const auto& layer : execGraphInfo) {
+                    // the layers which are not executed have no numeric time
+                    auto time = layer->params.find("execTimeMcs");
+                    double layerTime = 0.0;
+                    if (time != layer->params.end() && time->second != "not_executed")
+                        layerTime = std::stod(time->second);
+                    totalTime += layerTime;
+
+                    // the concatenations which are not in-place copy their inputs to the output
+                    if (layer->type == "Concatenation" && layer->GetParamAsString("inPlace", "true") == "false") {
+                        copyConcats++;
+                        copyConcatsTime += layerTime;
+                        slog::info << "Concatenation " << layer->name << " copies its inputs in "
+                                   << layer->GetParamAsString("outputLayouts", "undef") << slog::endl;
+                    }
+
+                    if (layer->type != "Reorder")
+                        continue;
+                    reorders++;
+                    reordersTime += layerTime;
+                    std::string parentLayouts = "undef";
+                    if (!layer->insData.empty() && layer->insData[0].lock()->getCreatorLayer().lock())
+                        parentLayouts = layer->insData[0].lock()->getCreatorLayer().lock()->GetParamAsString("outputLayouts", "undef");
+                    slog::info << "Reorder " << layer->name << ": " << parentLayouts << " -> "
+                               << layer->GetParamAsString("outputLayouts", "undef") << slog::endl;
+                }
+                double reordersShare = totalTime > 0.0 ? 100.0 * reordersTime / totalTime : 0.0;
+                double copyConcatsShare = totalTime > 0.0 ? 100.0 * copyConcatsTime / totalTime : 0.0;
+                slog::info << "Reorders in the executable graph: " << reorders << ", "
+                           << float_to_string(reordersShare) << "% of the execution time" << slog::endl;
+                slog::info << "Copying concatenations in the executable graph: " << copyConcats << ", "
+                           << float_to_string(copyConcatsShare) << "% of the execution time" << slog::endl;
+                if (statistics) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {"number of reorders", std::to_string(reorders)},
+                                                  {"reorders time share (%)", float_to_string(reordersShare)},
+                                                  {"number of copying concatenations", std::to_string(copyConcats)},
+                                                  {"copying concatenations time share (%)", float_to_string(copyConcatsShare)}
+                                              });
+                }
+            } catch (const std::exception & ex) {
+                slog::err << "Can't get executable graph: " << ex.what() << slog::endl;
+            }
+        }
+
         if (perf_counts) {
             std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> perfCounts;
             for (size_t ireq = 0; ireq < nireq; ireq++) {
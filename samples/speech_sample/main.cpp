@@ -393,6 +393,100 @@ void sumPerformanceCounters(std::map<std::string, InferenceEngine::InferenceEngi
     }
 }
 
+/**
+ * @brief Multiplexes independent sessions over one infer request and measures the time of inferences
+ * with switching the memory states of the sessions by zero-copy swaps and by copying them in and out
+ */
+void benchmarkSessions(InferenceEngine::ExecutableNetwork &executableNet, InferenceEngine::InferRequest &request,
+                       uint32_t numSessions, uint32_t numRounds) {
+    auto states = executableNet.QueryState();
+    if (states.empty()) {
+        slog::warn << "The network has no memory states, sessions benchmark is skipped" << slog::endl;
+        return;
+    }
+
+    std::vector<std::vector<Blob::Ptr>> sessionStates(numSessions);
+    for (auto &sessionState : sessionStates) {
+        for (auto &state : states) {
+            TensorDesc desc = state.GetLastState()->getTensorDesc();
+            Blob::Ptr blob;
+            if (desc.getPrecision() == Precision::I16) {
+                blob = make_shared_blob<int16_t>(desc);
+            } else {
+                blob = make_shared_blob<float>(desc);
+            }
+            blob->allocate();
+            std::memset(blob->buffer(), 0, blob->byteSize());
+            sessionState.push_back(blob);
+        }
+    }
+
+    auto run = [&](const std::function<void(uint32_t)> &bind, const std::function<void(uint32_t)> &unbind) {
+        auto t0 = Time::now();
+        for (uint32_t round = 0; round < numRounds; round++) {
+            for (uint32_t session = 0; session < numSessions; session++) {
+                bind(session);
+                request.Infer();
+                unbind(session);
+            }
+        }
+        return std::chrono::duration_cast<ms>(Time::now() - t0).count();
+    };
+    auto none = [](uint32_t) {};
+
+    for (auto &state : states) {
+        state.Reset();
+    }
+    double inferTime = run(none, none);
+
+    double copyTime = run([&](uint32_t session) {
+        for (size_t i = 0; i < states.size(); i++) {
+            states[i].SetState(sessionStates[session][i]);
+        }
+    }, [&](uint32_t session) {
+        for (size_t i = 0; i < states.size(); i++) {
+            auto lastState = states[i].GetLastState();
+            std::memcpy(sessionStates[session][i]->buffer(), lastState->cbuffer(), lastState->byteSize());
+        }
+    });
+
+    // the blobs returned by the swaps belong to the previously bound session, the first ones are the network's own
+    std::vector<Blob::Ptr> networkStates(states.size());
+    int bound = -1;
+    double swapTime = -1;
+    try {
+        swapTime = run([&](uint32_t session) {
+            for (size_t i = 0; i < states.size(); i++) {
+                Blob::Ptr previous = states[i].SwapState(sessionStates[session][i]);
+                if (bound < 0)
+                    networkStates[i] = previous;
+            }
+            bound = static_cast<int>(session);
+        }, none);
+    } catch (const std::exception &error) {
+        slog::warn << "Memory states cannot be swapped: " << error.what() << slog::endl;
+    }
+    if (bound >= 0) {
+        for (size_t i = 0; i < states.size(); i++) {
+            states[i].SwapState(networkStates[i]);
+        }
+    }
+
+    const double numInfers = static_cast<double>(numSessions) * numRounds;
+    size_t stateBytes = 0;
+    for (auto &state : sessionStates.front()) {
+        stateBytes += state->byteSize();
+    }
+    std::cout << "Sessions benchmark: " << numSessions << " sessions, " << numRounds << " frames each, "
+              << states.size() << " memory states of " << stateBytes << " bytes per session" << std::endl;
+    std::cout << "Average Infer time per frame without switching:\t" << inferTime / numInfers << " ms" << std::endl;
+    std::cout << "Average Infer time per frame with state copies:\t" << copyTime / numInfers << " ms" << std::endl;
+    if (swapTime >= 0) {
+        std::cout << "Average Infer time per frame with state swaps:\t" << swapTime / numInfers << " ms" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
 bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     // ---------------------------Parsing and validation of input args--------------------------------------
     slog::info << "Parsing input parameters" << slog::endl;
@@ -477,6 +571,14 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Invalid value for 'cw_l' argument. It must be greater than or equal to 0");
     }
 
+    if (FLAGS_sessions < 0) {
+        throw std::logic_error("Invalid value for 'sessions' argument. It must be greater than or equal to 0");
+    }
+
+    if (FLAGS_session_rounds <= 0) {
+        throw std::logic_error("Invalid value for 'session_rounds' argument. It must be greater than 0");
+    }
+
     return true;
 }
 
@@ -944,6 +1046,13 @@ int main(int argc, char *argv[]) {
             std::cout << "End of Utterance " << utteranceIndex << std::endl << std::endl;
         }
         // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 10. Benchmark sessions multiplexed over one infer request -----------------
+        if (FLAGS_sessions > 0) {
+            benchmarkSessions(executableNet, inferRequests.front().inferRequest,
+                              static_cast<uint32_t>(FLAGS_sessions), static_cast<uint32_t>(FLAGS_session_rounds));
+        }
+        // -----------------------------------------------------------------------------------------------------
     }
     catch (const std::exception &error) {
         slog::err << error.what() << slog::endl;
@@ -76,6 +76,15 @@ static const char context_window_message_r[] = "Optional. Number of frames for r
                                                "Works only with context window networks."
                                                " If you use the cw_r or cw_l flag, then batch size and nthreads arguments are ignored.";
 
+/// @brief message for sessions argument
+static const char sessions_message[] = "Optional. Number of independent sessions to multiplex over one infer request "
+                                       "after the utterances are processed (default is 0, no benchmark). "
+                                       "Compares switching of memory states by zero-copy swaps with copying them.";
+
+/// @brief message for session rounds argument
+static const char session_rounds_message[] = "Optional. Number of frames inferred by each session in the sessions "
+                                             "benchmark (default is 10).";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -137,6 +146,12 @@ DEFINE_int32(cw_r, 0, context_window_message_r);
 /// @brief Left context window size (default 0)
 DEFINE_int32(cw_l, 0, context_window_message_l);
 
+/// @brief Number of sessions multiplexed in the memory states benchmark (default 0)
+DEFINE_int32(sessions, 0, sessions_message);
+
+/// @brief Number of frames of each session in the memory states benchmark (default 10)
+DEFINE_int32(session_rounds, 10, session_rounds_message);
+
 /**
  * \brief This function show a help message
  */
@@ -164,5 +179,7 @@ static void showUsage() {
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
     std::cout << "    -cw_l \"<integer>\"       " << context_window_message_l << std::endl;
     std::cout << "    -cw_r \"<integer>\"       " << context_window_message_r << std::endl;
+    std::cout << "    -sessions \"<integer>\"   " << sessions_message << std::endl;
+    std::cout << "    -session_rounds \"<integer>\" " << session_rounds_message << std::endl;
 }
 
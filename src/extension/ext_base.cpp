@@ -3,11 +3,13 @@
 //
 
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 
 #include <vector>
 #include <string>
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -122,6 +124,143 @@ void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator
     confs.push_back(config);
 }
 
+bool ExtLayerBase::isPostOpSupported(const LayerPostOp& postOp) const noexcept {
+    if (!postOpsSupported)
+        return false;
+    switch (postOp.type) {
+        case LayerPostOp::ScaleShift:
+            return postOp.data.size() == 2 && !postOp.data[0].empty() && !postOp.data[1].empty();
+        case LayerPostOp::Quantize:
+            if (postOp.data.size() != 4 || postOp.levels < 2)
+                return false;
+            for (const auto& values : postOp.data) {
+                if (values.empty())
+                    return false;
+            }
+            return true;
+        default:
+            return true;
+    }
+}
+
+StatusCode ExtLayerBase::setPostOps(const std::vector<LayerPostOp>& ops, ResponseDesc *resp) noexcept {
+    for (const auto& op : ops) {
+        if (!isPostOpSupported(op)) {
+            if (resp) {
+                std::string msg = "Unsupported post operation!";
+                msg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return NOT_IMPLEMENTED;
+        }
+    }
+    postOps = ops;
+    return OK;
+}
+
+void ExtLayerBase::applyPostOps(float* data, size_t channel, size_t size, size_t channelBlock) const {
+    // the only value is broadcasted, the channels padded by the blocked layout take the last one
+    auto value = [](const std::vector<float>& values, size_t c) {
+        return values[std::min(c, values.size() - 1)];
+    };
+
+    for (const auto& op : postOps) {
+        switch (op.type) {
+            case LayerPostOp::Relu:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = data[i] > 0.f ? data[i] : data[i] * op.alpha;
+                break;
+            case LayerPostOp::Elu:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = data[i] > 0.f ? data[i] : op.alpha * (std::exp(data[i]) - 1.f);
+                break;
+            case LayerPostOp::Logistic:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = 1.f / (1.f + std::exp(-data[i]));
+                break;
+            case LayerPostOp::Tanh:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = std::tanh(data[i]);
+                break;
+            case LayerPostOp::Clamp:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = std::min(std::max(data[i], op.alpha), op.beta);
+                break;
+            case LayerPostOp::ScaleShift:
+                if (channelBlock == 1) {
+                    const float scale = value(op.data[0], channel);
+                    const float shift = value(op.data[1], channel);
+                    for (size_t i = 0; i < size; i++)
+                        data[i] = data[i] * scale + shift;
+                } else {
+                    for (size_t i = 0; i < size; i++) {
+                        const size_t c = channel + i % channelBlock;
+                        data[i] = data[i] * value(op.data[0], c) + value(op.data[1], c);
+                    }
+                }
+                break;
+            case LayerPostOp::Quantize: {
+                const float levels = static_cast<float>(op.levels - 1);
+                for (size_t i = 0; i < size; i++) {
+                    const size_t c = channelBlock == 1 ? channel : channel + i % channelBlock;
+                    const float inputLow = value(op.data[0], c);
+                    const float inputHigh = value(op.data[1], c);
+                    const float outputLow = value(op.data[2], c);
+                    const float outputHigh = value(op.data[3], c);
+
+                    if (data[i] <= inputLow)
+                        data[i] = outputLow;
+                    else if (data[i] > inputHigh)
+                        data[i] = outputHigh;
+                    else
+                        data[i] = std::round((data[i] - inputLow) / (inputHigh - inputLow) * levels) / levels *
+                                  (outputHigh - outputLow) + outputLow;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void ExtLayerBase::applyPostOps(const Blob::Ptr& output) const {
+    if (postOps.empty())
+        return;
+
+    const TensorDesc& desc = output->getTensorDesc();
+    const SizeVector& dims = desc.getDims();
+    const SizeVector& blockDims = desc.getBlockingDesc().getBlockDims();
+    const SizeVector& order = desc.getBlockingDesc().getOrder();
+    float* data = output->buffer().as<float*>() + desc.getBlockingDesc().getOffsetPadding();
+
+    if (dims.size() < 3) {
+        const size_t C = dims.size() == 2 ? dims[1] : 1;
+        parallel_for(output->size() / C, [&](size_t i) {
+            applyPostOps(data + i * C, 0, C, C);
+        });
+        return;
+    }
+
+    size_t inner = 1;
+    for (size_t i = 2; i < blockDims.size(); i++)
+        inner *= blockDims[i];
+
+    if (order.size() == dims.size() + 1 && order.back() == 1) {
+        // channel blocks like nChw8c
+        const size_t channelBlock = blockDims.back();
+        parallel_for2d(blockDims[0], blockDims[1], [&](size_t n, size_t cb) {
+            applyPostOps(data + (n * blockDims[1] + cb) * inner, cb * channelBlock, inner, channelBlock);
+        });
+    } else if (order.back() == 1) {
+        // channels last like nhwc
+        const size_t C = dims[1];
+        parallel_for(output->size() / C, [&](size_t i) {
+            applyPostOps(data + i * C, 0, C, C);
+        });
+    } else {
+        parallel_for2d(blockDims[0], blockDims[1], [&](size_t n, size_t c) {
+            applyPostOps(data + (n * blockDims[1] + c) * inner, c, inner);
+        });
+    }
+}
 
 }  // namespace Cpu
 }  // namespace Extensions
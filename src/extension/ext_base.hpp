@@ -16,10 +16,12 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
-class ExtLayerBase: public ILayerExecImpl {
+class ExtLayerBase: public ILayerExecImplWithPostOps {
 public:
     StatusCode getSupportedConfigurations(std::vector<LayerConfig>& conf, ResponseDesc *resp) noexcept override;
     StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override;
+    bool isPostOpSupported(const LayerPostOp& postOp) const noexcept override;
+    StatusCode setPostOps(const std::vector<LayerPostOp>& ops, ResponseDesc *resp) noexcept override;
 
 protected:
     enum class ConfLayout { ANY, PLN, BLK8, BLK16 };
@@ -42,6 +44,16 @@ protected:
     std::string errorMsg;
     std::vector<LayerConfig> confs;
 
+    // Applies the fused post operations to size values of the output starting from the given channel.
+    // The values of channelBlock consecutive channels are interleaved for blocked layouts.
+    void applyPostOps(float* data, size_t channel, size_t size, size_t channelBlock = 1) const;
+    // Applies the fused post operations to the whole output in a separate pass
+    void applyPostOps(const Blob::Ptr& output) const;
+
+    // set by the implementations calling applyPostOps() for every output value
+    bool postOpsSupported = false;
+    std::vector<LayerPostOp> postOps;
+
 #if defined(HAVE_AVX512F)
     static inline __m512 _mm_uni_loadu_ps(const float* psrc) {
         return _mm512_loadu_ps(psrc);
@@ -69,6 +69,16 @@ public:
             work_amount_dst = ownStrides[0] * own_dims[0];
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+
+            // channels move to the spatial dimensions, the blocked kernel maps the indices of the planar one
+            if (src_dims.size() == 4 && dst_dims.size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -80,6 +90,13 @@ public:
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
+        const SizeVector& blockDims = outputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        if (blockDims.size() > outputs[0]->getTensorDesc().getDims().size()) {
+            depth_to_space_blk(src_data, dst_data, inputs[0]->getTensorDesc().getDims(),
+                               outputs[0]->getTensorDesc().getDims(), blockDims.back());
+            return OK;
+        }
+
         //  Parallel
         parallel_nt(0, [&](const int ithr, const int nthr) {
             size_t start = 0, end = 0, src_idx = 0;
@@ -113,6 +130,40 @@ public:
     }
 
 private:
+    // every output element reads the input element of the planar kernel: its planar offset is split
+    // by the counters of the planar kernel and the planar offset of the input is mapped to the blocked one.
+    // The lanes of the last block past the channels are zero
+    void depth_to_space_blk(const float* src_data, float* dst_data, const SizeVector& src_dims,
+                            const SizeVector& dst_dims, size_t blk) {
+        const size_t C = dst_dims[1];
+        const size_t CB = (C + blk - 1) / blk;
+        const size_t spatial = dst_dims[2] * dst_dims[3];
+        const size_t src_C = src_dims[1];
+        const size_t src_CB = (src_C + blk - 1) / blk;
+        const size_t src_spatial = src_dims[2] * src_dims[3];
+
+        parallel_for2d(dst_dims[0], CB * blk, [&](size_t n, size_t c) {
+            float* pdst = dst_data + ((n * CB + c / blk) * spatial) * blk + c % blk;
+            if (c >= C) {
+                for (size_t i = 0; i < spatial; i++)
+                    pdst[i * blk] = 0.f;
+                return;
+            }
+            for (size_t i = 0; i < spatial; i++) {
+                size_t dst_idx = (n * C + c) * spatial + i;
+                size_t src_idx = 0;
+                for (int j = CNTR_SIZE - 1; j >= 0; j--) {
+                    src_idx += (dst_idx % own_dims[j]) * ownStrides[j];
+                    dst_idx /= own_dims[j];
+                }
+                const size_t src_n = src_idx / (src_C * src_spatial);
+                const size_t src_c = src_idx / src_spatial % src_C;
+                const size_t src_i = src_idx % src_spatial;
+                pdst[i * blk] = src_data[((src_n * src_CB + src_c / blk) * src_spatial + src_i) * blk + src_c % blk];
+            }
+        });
+    }
+
     size_t work_amount_dst;
     size_t own_dims[CNTR_SIZE];
     size_t ownStrides[CNTR_SIZE];
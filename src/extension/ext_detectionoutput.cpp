@@ -6,21 +6,28 @@
 #include "ext_base.hpp"
 
 #include <cfloat>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <cmath>
 #include <string>
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+// equal scores are ordered by the ascending class and prior, so the detections kept at the equal score
+// don't depend on the order of the candidates
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
 class DetectionOutputImpl: public ExtLayerBase {
@@ -163,45 +170,48 @@ public:
             }
         }
 
-        for (int n = 0; n < N; ++n) {
+        // the blocks of priors are transposed to keep both reads and writes sequential
+        const int prior_blocks = (_num_priors + conf_block - 1) / conf_block;
+        parallel_for2d(N, prior_blocks, [&](int n, int pb) {
+            const int p_end = std::min(_num_priors, (pb + 1)*conf_block);
+            const float *pconf = conf_data + n*_num_priors*_num_classes;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes;
             for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                for (int p = pb*conf_block; p < p_end; ++p) {
+                    preordered[c*_num_priors + p] = pconf[p*_num_classes + c];
                 }
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -209,8 +219,11 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
 
+        parallel_for(N, [&](int n) {
+            int detections_total = 0;
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
@@ -229,8 +242,12 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                // only the kept detections are sorted
+                auto keep_end = conf_index_class_map.begin() + _keep_top_k;
+                if (_keep_top_k > 0)
+                    std::nth_element(conf_index_class_map.begin(), keep_end - 1, conf_index_class_map.end(),
+                                     SortScorePairDescend<std::pair<int, int>>);
+                std::sort(conf_index_class_map.begin(), keep_end, SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -244,7 +261,7 @@ public:
                     detections_data[n*_num_classes + label]++;
                 }
             }
-        }
+        });
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
         if (DETECTION_SIZE != 7) {
@@ -273,14 +290,11 @@ public:
                     dst_data[count * DETECTION_SIZE + 1] = static_cast<float>(_decrease_label_id ? c-1 : c);
                     dst_data[count * DETECTION_SIZE + 2] = pconf[c*_num_priors + idx];
 
-                    float xmin = _share_location ? pboxes[idx*4 + 0] :
-                                 pboxes[c*4*_num_priors + idx*4 + 0];
-                    float ymin = _share_location ? pboxes[idx*4 + 1] :
-                                 pboxes[c*4*_num_priors + idx*4 + 1];
-                    float xmax = _share_location ? pboxes[idx*4 + 2] :
-                                 pboxes[c*4*_num_priors + idx*4 + 2];
-                    float ymax = _share_location ? pboxes[idx*4 + 3] :
-                                 pboxes[c*4*_num_priors + idx*4 + 3];
+                    const float *pbox = _share_location ? pboxes + idx : pboxes + c*4*_num_priors + idx;
+                    float xmin = pbox[0*_num_priors];
+                    float ymin = pbox[1*_num_priors];
+                    float xmax = pbox[2*_num_priors];
+                    float ymax = pbox[3*_num_priors];
 
                     if (_clip_after_nms) {
                         xmin = std::max(0.0f, std::min(1.0f, xmin));
@@ -311,6 +325,8 @@ private:
     const int idx_location = 0;
     const int idx_confidence = 1;
     const int idx_priors = 2;
+    // priors transposed at once by the confidence reordering
+    const int conf_block = 64;
 
 
     int _num_classes = 0;
@@ -374,19 +390,21 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
+// the boxes are stored by separate arrays of xmin, ymin, xmax and ymax coordinates of the given size
 static inline float JaccardOverlap(const float *decoded_bbox,
                                    const float *bbox_sizes,
                                    const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
+                                   const int idx2,
+                                   const int num_priors) {
+    float xmin1 = decoded_bbox[0*num_priors + idx1];
+    float ymin1 = decoded_bbox[1*num_priors + idx1];
+    float xmax1 = decoded_bbox[2*num_priors + idx1];
+    float ymax1 = decoded_bbox[3*num_priors + idx1];
+
+    float xmin2 = decoded_bbox[0*num_priors + idx2];
+    float ymin2 = decoded_bbox[1*num_priors + idx2];
+    float ymax2 = decoded_bbox[3*num_priors + idx2];
+    float xmax2 = decoded_bbox[2*num_priors + idx2];
 
     if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
         return 0.0f;
@@ -411,6 +429,139 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
+// Boxes kept by NMS of a class, their coordinates are gathered to separate arrays
+// to compute the overlaps of the next box with a number of kept ones at once.
+struct KeptBoxes {
+    explicit KeptBoxes(int capacity) : data(5*capacity), xmin(data.data()), ymin(xmin + capacity),
+                                       xmax(ymin + capacity), ymax(xmax + capacity), size(ymax + capacity) {}
+
+    void add(int k, float box_xmin, float box_ymin, float box_xmax, float box_ymax, float box_size) {
+        xmin[k] = box_xmin;
+        ymin[k] = box_ymin;
+        xmax[k] = box_xmax;
+        ymax[k] = box_ymax;
+        size[k] = box_size;
+    }
+
+    std::vector<float> data;
+    float *xmin, *ymin, *xmax, *ymax, *size;
+};
+
+// returns true if the box overlaps any of the first count kept boxes more than the threshold
+static inline bool OverlapsAny(const KeptBoxes &kept, int count, float xmin, float ymin, float xmax, float ymax,
+                               float size, float threshold) {
+    int k = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 vxmin = _mm512_set1_ps(xmin);
+    const __m512 vymin = _mm512_set1_ps(ymin);
+    const __m512 vxmax = _mm512_set1_ps(xmax);
+    const __m512 vymax = _mm512_set1_ps(ymax);
+    const __m512 vsize = _mm512_set1_ps(size);
+    const __m512 vthreshold = _mm512_set1_ps(threshold);
+    const __m512 vzero = _mm512_setzero_ps();
+    for (; k <= count - 16; k += 16) {
+        __m512 width = _mm512_sub_ps(_mm512_min_ps(vxmax, _mm512_loadu_ps(kept.xmax + k)),
+                                     _mm512_max_ps(vxmin, _mm512_loadu_ps(kept.xmin + k)));
+        __m512 height = _mm512_sub_ps(_mm512_min_ps(vymax, _mm512_loadu_ps(kept.ymax + k)),
+                                      _mm512_max_ps(vymin, _mm512_loadu_ps(kept.ymin + k)));
+        __m512 intersect = _mm512_mul_ps(width, height);
+        __m512 overlap = _mm512_div_ps(intersect,
+                                       _mm512_sub_ps(_mm512_add_ps(vsize, _mm512_loadu_ps(kept.size + k)), intersect));
+        __mmask16 mask = _mm512_cmp_ps_mask(width, vzero, _CMP_GT_OQ) & _mm512_cmp_ps_mask(height, vzero, _CMP_GT_OQ) &
+                         _mm512_cmp_ps_mask(overlap, vthreshold, _CMP_GT_OQ);
+        if (mask)
+            return true;
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vxmin = _mm256_set1_ps(xmin);
+    const __m256 vymin = _mm256_set1_ps(ymin);
+    const __m256 vxmax = _mm256_set1_ps(xmax);
+    const __m256 vymax = _mm256_set1_ps(ymax);
+    const __m256 vsize = _mm256_set1_ps(size);
+    const __m256 vthreshold = _mm256_set1_ps(threshold);
+    const __m256 vzero = _mm256_setzero_ps();
+    for (; k <= count - 8; k += 8) {
+        __m256 width = _mm256_sub_ps(_mm256_min_ps(vxmax, _mm256_loadu_ps(kept.xmax + k)),
+                                     _mm256_max_ps(vxmin, _mm256_loadu_ps(kept.xmin + k)));
+        __m256 height = _mm256_sub_ps(_mm256_min_ps(vymax, _mm256_loadu_ps(kept.ymax + k)),
+                                      _mm256_max_ps(vymin, _mm256_loadu_ps(kept.ymin + k)));
+        __m256 intersect = _mm256_mul_ps(width, height);
+        __m256 overlap = _mm256_div_ps(intersect,
+                                       _mm256_sub_ps(_mm256_add_ps(vsize, _mm256_loadu_ps(kept.size + k)), intersect));
+        __m256 mask = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(width, vzero, _CMP_GT_OQ),
+                                                  _mm256_cmp_ps(height, vzero, _CMP_GT_OQ)),
+                                    _mm256_cmp_ps(overlap, vthreshold, _CMP_GT_OQ));
+        if (_mm256_movemask_ps(mask))
+            return true;
+    }
+#elif defined(HAVE_SSE)
+    const __m128 vxmin = _mm_set1_ps(xmin);
+    const __m128 vymin = _mm_set1_ps(ymin);
+    const __m128 vxmax = _mm_set1_ps(xmax);
+    const __m128 vymax = _mm_set1_ps(ymax);
+    const __m128 vsize = _mm_set1_ps(size);
+    const __m128 vthreshold = _mm_set1_ps(threshold);
+    const __m128 vzero = _mm_setzero_ps();
+    for (; k <= count - 4; k += 4) {
+        __m128 width = _mm_sub_ps(_mm_min_ps(vxmax, _mm_loadu_ps(kept.xmax + k)),
+                                  _mm_max_ps(vxmin, _mm_loadu_ps(kept.xmin + k)));
+        __m128 height = _mm_sub_ps(_mm_min_ps(vymax, _mm_loadu_ps(kept.ymax + k)),
+                                   _mm_max_ps(vymin, _mm_loadu_ps(kept.ymin + k)));
+        __m128 intersect = _mm_mul_ps(width, height);
+        __m128 overlap = _mm_div_ps(intersect, _mm_sub_ps(_mm_add_ps(vsize, _mm_loadu_ps(kept.size + k)), intersect));
+        __m128 mask = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(width, vzero), _mm_cmpgt_ps(height, vzero)),
+                                 _mm_cmpgt_ps(overlap, vthreshold));
+        if (_mm_movemask_ps(mask))
+            return true;
+    }
+#endif
+    for (; k < count; ++k) {
+        float width = std::min(xmax, kept.xmax[k]) - std::max(xmin, kept.xmin[k]);
+        float height = std::min(ymax, kept.ymax[k]) - std::max(ymin, kept.ymin[k]);
+        if (width <= 0 || height <= 0)
+            continue;
+        float intersect = width * height;
+        if (intersect / (size + kept.size[k] - intersect) > threshold)
+            return true;
+    }
+    return false;
+}
+
+// bucket of the confidence by the high bits of its float representation mapped to preserve the order
+static inline int ConfidenceBucket(float conf, int bucket_bits) {
+    uint32_t bits;
+    conf = conf == 0.0f ? 0.0f : conf;  // -0 and +0 are the same confidence
+    std::memcpy(&bits, &conf, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return static_cast<int>(bits >> (32 - bucket_bits));
+}
+
+// Writes top_k of count candidate indices ordered by ConfidenceComparator to buffer,
+// which must have space for all candidates. The candidates are preselected by a histogram of
+// confidence buckets so only the ones of the buckets above the top_k-th one and of its bucket are sorted.
+static void SelectTopK(const float *conf_data, const int *indices, int count, int top_k, int *buffer) {
+    const int bucket_bits = 11;
+    if (count < 4*top_k || count < 256) {
+        std::partial_sort_copy(indices, indices + count, buffer, buffer + top_k, ConfidenceComparator(conf_data));
+        return;
+    }
+
+    std::vector<int> histogram(1 << bucket_bits, 0);
+    for (int i = 0; i < count; ++i)
+        histogram[ConfidenceBucket(conf_data[indices[i]], bucket_bits)]++;
+
+    int bucket = (1 << bucket_bits) - 1;
+    for (int above = 0; above + histogram[bucket] < top_k; bucket--)
+        above += histogram[bucket];
+
+    int selected = 0;
+    for (int i = 0; i < count; ++i) {
+        if (ConfidenceBucket(conf_data[indices[i]], bucket_bits) >= bucket)
+            buffer[selected++] = indices[i];
+    }
+    std::partial_sort(buffer, buffer + top_k, buffer + selected, ConfidenceComparator(conf_data));
+}
+
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                    const float *loc_data,
                                    const float *variance_data,
@@ -502,10 +653,10 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
             new_ymax = std::max(0.0f, std::min(1.0f, new_ymax));
         }
 
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
+        decoded_bboxes[0*_num_priors + p] = new_xmin;
+        decoded_bboxes[1*_num_priors + p] = new_ymin;
+        decoded_bboxes[2*_num_priors + p] = new_xmax;
+        decoded_bboxes[3*_num_priors + p] = new_ymax;
 
         decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
     });
@@ -525,26 +676,23 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
             count++;
         }
     }
+    if (count == 0)
+        return;
 
     int num_output_scores = (_top_k == -1 ? count : std::min<int>(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    SelectTopK(conf_data, indices, count, num_output_scores, buffer);
 
+    KeptBoxes kept(num_output_scores);
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
+        const float xmin = bboxes[0*_num_priors + idx];
+        const float ymin = bboxes[1*_num_priors + idx];
+        const float xmax = bboxes[2*_num_priors + idx];
+        const float ymax = bboxes[3*_num_priors + idx];
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!OverlapsAny(kept, detections, xmin, ymin, xmax, ymax, sizes[idx], _nms_threshold)) {
+            kept.add(detections, xmin, ymin, xmax, ymax, sizes[idx]);
             indices[detections] = idx;
             detections++;
         }
@@ -577,9 +725,7 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
 
     int num_output_scores = (_top_k == -1 ? count : std::min<int>(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    SelectTopK(conf_data, indices, count, num_output_scores, buffer);
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
@@ -592,7 +738,7 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         bool keep = true;
         for (int k = 0; k < ndetection; ++k) {
             const int kept_idx = pindices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
+            float overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx, _num_priors);
             if (overlap > _nms_threshold) {
                 keep = false;
                 break;
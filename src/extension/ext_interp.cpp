@@ -69,6 +69,7 @@ public:
 #endif
                 addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
             }
+            postOpsSupported = true;
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -111,6 +112,7 @@ public:
             return GENERAL_ERROR;
         }
 
+        applyPostOps(outputs[0]);
         return OK;
     }
 
@@ -42,6 +42,7 @@ public:
 #endif
             addConfig(layer, {{blk_layout, false, -1}}, {{blk_layout, false, 0}});
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
+            postOpsSupported = true;
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -115,6 +116,8 @@ void MVNImpl::mvn_pln(const float* src_data, float* dst_data, const SizeVector&
                         }
                     }
                 }
+                if (!normalize_variance)
+                    applyPostOps(dst_data + cc, c, C2);
             });
         } else {
             parallel_for(C, [&](size_t c) {
@@ -142,6 +145,8 @@ void MVNImpl::mvn_pln(const float* src_data, float* dst_data, const SizeVector&
                         }
                     }
                 }
+                if (!normalize_variance)
+                    applyPostOps(dst_data + cc, c, C2);
             });
         }
     }
@@ -181,6 +186,7 @@ void MVNImpl::mvn_pln(const float* src_data, float* dst_data, const SizeVector&
                             }
                         }
                     }
+                    applyPostOps(dst_data + cc, c, C2);
                 });
             } else {
                 parallel_for(C, [&](size_t c) {
@@ -208,6 +214,7 @@ void MVNImpl::mvn_pln(const float* src_data, float* dst_data, const SizeVector&
                             }
                         }
                     }
+                    applyPostOps(dst_data + cc, c, C2);
                 });
             }
         }
@@ -288,6 +295,7 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector&
                             dst_data[src_offset] = static_cast<float>((static_cast<double>(src_data[src_offset]) - mean) / variance);
                         }
                     }
+                    applyPostOps(dst_data + ccbd, cb * blk_size, C0, blk_size);
                 });
             } else {
                 parallel_for(CB, [&](size_t cb) {
@@ -386,6 +394,7 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector&
                         }
                     }
 #endif
+                    applyPostOps(dst_data + src_off, cb * blk_size, C2, blk_size);
                 });
             }
         }
@@ -418,6 +427,7 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector&
                             dst_data[src_offset] = src_data[src_offset] - static_cast<float>(mean);
                         }
                     }
+                    applyPostOps(dst_data + ccbd, cb * blk_size, C0, blk_size);
                 });
             } else {
                 parallel_for(CB, [&](size_t cb) {
@@ -479,6 +489,7 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector&
                         }
                     }
 #endif
+                    applyPostOps(dst_data + src_off, cb * blk_size, C2, blk_size);
                 });
             }
         }
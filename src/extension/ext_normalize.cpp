@@ -4,6 +4,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 
 #include <algorithm>
 #include <string>
@@ -38,6 +39,15 @@ public:
             eps = layer->GetParamAsFloat("eps");
 
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}}, true);
+            }
+            postOpsSupported = true;
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -79,6 +89,11 @@ public:
         float* dst = outputs[0]->buffer();
 
         SizeVector dims = inputs[0]->getTensorDesc().getDims();
+        const SizeVector& blockDims = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        if (blockDims.size() > dims.size()) {
+            normalize_blk(src, scl, dst, dims, blockDims.back());
+            return OK;
+        }
 
         const int N = static_cast<const int>(dims[0]);
         const int C = static_cast<int>(dims[1]);
@@ -141,80 +156,162 @@ public:
                         float s = channel_shared ? scl[0] : scl[c];
                         pdst[c*H*W+hw] = psrc[c*H*W+hw] * norm * s;
                     }
+                    applyPostOps(pdst + c*H*W, c, H*W);
                 }
             } else {
-                int wh = 0;
+                // pixels are processed by tiles in parallel, post operations are applied to every channel
+                // of the tile right after the tile is written
+                const int tile = 64;
+                const int tiles = (W*H + tile - 1) / tile;
+                parallel_for(tiles, [&](int t) {
+                    const int begin = t*tile;
+                    const int end = std::min(begin + tile, W*H);
+                    int wh = begin;
 #if defined(HAVE_AVX2)
-                for (; wh <= W*H - 8; wh += 8) {
-                    __m256 vnorm = _mm256_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        vnorm = _mm256_fmadd_ps(vsrc, vsrc, vnorm);
+                    for (; wh <= end - 8; wh += 8) {
+                        __m256 vnorm = _mm256_set1_ps(eps);
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
+                            vnorm = _mm256_fmadd_ps(vsrc, vsrc, vnorm);
+                        }
+                        vnorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(vnorm));
+
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            float* pdst_c = pdst + c*W*H;
+
+                            __m256 vscl = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
+
+                            __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
+                            __m256 vdst = _mm256_mul_ps(vsrc, vnorm);
+                            vdst = _mm256_mul_ps(vdst, vscl);
+
+                            _mm256_storeu_ps(pdst_c + wh, vdst);
+                        }
                     }
-                    vnorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(vnorm));
+#elif defined(HAVE_SSE)
+                    for (; wh <= end - 4; wh += 4) {
+                        __m128 vnorm = _mm_set1_ps(eps);
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
+                            vnorm = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vnorm);
+                        }
 
-                        __m256 vscl = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
+                        vnorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(vnorm));
 
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        __m256 vdst = _mm256_mul_ps(vsrc, vnorm);
-                        vdst = _mm256_mul_ps(vdst, vscl);
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                                  float* pdst_c = pdst + c*W*H;
 
-                        _mm256_storeu_ps(pdst_c + wh, vdst);
-                    }
-                }
-#elif defined(HAVE_SSE)
-                for (; wh <= W*H - 4; wh += 4) {
-                    __m128 vnorm = _mm_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
+                            __m128 vscl = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
 
-                        vnorm = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vnorm);
+                            __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
+                            __m128 vdst = _mm_mul_ps(vsrc, vnorm);
+                            vdst = _mm_mul_ps(vdst, vscl);
+
+                            _mm_storeu_ps(pdst_c + wh, vdst);
+                        }
                     }
+#endif
+                    for (; wh < end; wh++) {
+                        float norm = eps;
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            norm += psrc_c[wh]*psrc_c[wh];
+                        }
 
-                    vnorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(vnorm));
+                        norm = 1.0f / std::sqrt(norm);
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                              float* pdst_c = pdst + c*W*H;
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            float* pdst_c = pdst + c*W*H;
+
+                            pdst_c[wh] = channel_shared ? (psrc_c[wh] * norm * scl[0]) : (psrc_c[wh] * norm * scl[c]);
+                        }
+                    }
+
+                    for (int c = 0; c < C && !postOps.empty(); c++)
+                        applyPostOps(pdst + c*W*H + begin, c, end - begin);
+                });
+            }
+        }
+        return OK;
+    }
 
-                        __m128 vscl = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
+private:
+    // the channels of a pixel are stored by blk interleaved values of every channel block,
+    // the channels padded by the last block don't contribute to the norm and stay zero
+    void normalize_blk(const float* src, const float* scl, float* dst, const SizeVector& dims, size_t blk) {
+        const size_t N = dims[0];
+        const size_t C = dims[1];
+        const size_t HW = dims[2] * dims[3];
+        const size_t CB = (C + blk - 1) / blk;
+        const size_t tail = CB * blk - C;
+
+        // post ops as shift or logistic don't keep zeros
+        auto zero_tail = [&](float* pdst_cb, size_t cb) {
+            if (!tail || cb + 1 != CB)
+                return;
+            for (size_t hw = 0; hw < HW; hw++)
+                std::fill_n(pdst_cb + hw*blk + blk - tail, tail, 0.f);
+        };
+
+        auto scale = [&](size_t c) {
+            return channel_shared ? scl[0] : scl[std::min(c, C - 1)];
+        };
+
+        for (size_t n = 0; n < N; n++) {
+            const float* psrc = src + n*CB*HW*blk;
+            float* pdst = dst + n*CB*HW*blk;
 
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
-                        __m128 vdst = _mm_mul_ps(vsrc, vnorm);
-                        vdst = _mm_mul_ps(vdst, vscl);
+            if (across_spatial) {
+                float norm = eps + parallel_sum(CB*HW, 0.f, [&](size_t i) {
+                    const size_t valid = std::min(blk, C - (i / HW)*blk);
+                    float sum = 0.f;
+                    for (size_t b = 0; b < valid; b++)
+                        sum += psrc[i*blk + b]*psrc[i*blk + b];
+                    return sum;
+                });
+                norm = 1.0f / std::sqrt(norm);
 
-                        _mm_storeu_ps(pdst_c + wh, vdst);
+                parallel_for(CB, [&](size_t cb) {
+                    for (size_t hw = 0; hw < HW; hw++) {
+                        const size_t i = (cb*HW + hw)*blk;
+                        for (size_t b = 0; b < blk; b++)
+                            pdst[i + b] = psrc[i + b] * norm * scale(cb*blk + b);
                     }
-                }
-#endif
-                for (; wh < W*H; wh++) {
+                    applyPostOps(pdst + cb*HW*blk, cb*blk, HW*blk, blk);
+                    zero_tail(pdst + cb*HW*blk, cb);
+                });
+            } else {
+                parallel_for(HW, [&](size_t hw) {
                     float norm = eps;
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        norm += psrc_c[wh]*psrc_c[wh];
+                    for (size_t cb = 0; cb < CB; cb++) {
+                        const float* psrc_c = psrc + (cb*HW + hw)*blk;
+                        for (size_t b = 0; b < std::min(blk, C - cb*blk); b++)
+                            norm += psrc_c[b]*psrc_c[b];
                     }
-
                     norm = 1.0f / std::sqrt(norm);
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
-
-                        pdst_c[wh] = channel_shared ? (psrc_c[wh] * norm * scl[0]) : (psrc_c[wh] * norm * scl[c]);
+                    for (size_t cb = 0; cb < CB; cb++) {
+                        const size_t i = (cb*HW + hw)*blk;
+                        for (size_t b = 0; b < blk; b++)
+                            pdst[i + b] = psrc[i + b] * norm * scale(cb*blk + b);
                     }
-                }
+                });
+
+                parallel_for(CB, [&](size_t cb) {
+                    if (!postOps.empty())
+                        applyPostOps(pdst + cb*HW*blk, cb*blk, HW*blk, blk);
+                    zero_tail(pdst + cb*HW*blk, cb);
+                });
             }
         }
-        return OK;
     }
 
-private:
     TBlob<float>::Ptr weights;
 
     bool across_spatial = true;
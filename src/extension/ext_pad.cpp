@@ -62,11 +62,46 @@ public:
                 src_o_dms.push_back(src_dims[i] + pads_begin[i]);
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+
+            // channels aren't padded, so the blocked tensor is padded as the tensor of its block dimensions
+            if ((src_dims.size() == 4 || src_dims.size() == 5) && pads_begin[1] == 0 && pads_end[1] == 0) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const BlockingDesc& srcBlk = config.inConfs[0].desc.getBlockingDesc();
+        const BlockingDesc& dstBlk = config.outConfs[0].desc.getBlockingDesc();
+        src_dims = srcBlk.getBlockDims();
+        dst_dims = dstBlk.getBlockDims();
+        srcStrides = srcBlk.getStrides();
+        dstStrides = dstBlk.getStrides();
+        pads_begin.resize(src_dims.size(), 0);
+
+        // the lanes of the last channel block past the channels are kept zero
+        const SizeVector& dims = config.outConfs[0].desc.getDims();
+        blk_channels = dims.size() > 1 ? dims[1] : 0;
+        blk_size = dst_dims.size() > dims.size() ? dst_dims.back() : 0;
+
+        work_amount = dst_dims[0] * dstStrides[0];
+        src_o_dms.clear();
+        for (size_t i = 0; i < src_dims.size(); i++)
+            src_o_dms.push_back(src_dims[i] + pads_begin[i]);
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src_data = inputs[0]->cbuffer().as<const float *>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -114,6 +149,8 @@ private:
     SizeVector srcStrides;
     SizeVector dstStrides;
     size_t work_amount;
+    size_t blk_channels = 0;
+    size_t blk_size = 0;
 };
 
 
@@ -152,7 +189,8 @@ void PadImpl::pad_constant(const float *src_data, float* dst_data) {
 
             for (size_t i = 0; i < counters.size(); ++i) {
                 if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i]) {
-                    dst_data[dstIdx] = pad_value;
+                    const bool tail_lane = blk_size && counters[1] * blk_size + counters.back() >= blk_channels;
+                    dst_data[dstIdx] = tail_lane ? 0.f : pad_value;
                     srcIdx = 0;
                     break;
                 }
@@ -69,11 +69,34 @@ public:
             srcStrides = layer->insData[REDUCE_DATA].lock()->getTensorDesc().getBlockingDesc().getStrides();
 
             addConfig(layer, { { ConfLayout::PLN, false }, { ConfLayout::PLN, false } }, { { ConfLayout::PLN, false } });
+
+            // reductions keeping the channels keep the channel blocks, so the blocked tensor is reduced
+            // as the tensor of its block dimensions
+            if (keep_dims && data_dims.size() == 4 && constAxesKeepChannels(layer)) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, { { blk_layout, false }, { ConfLayout::PLN, false } }, { { blk_layout, false } });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const TensorDesc& srcDesc = config.inConfs[REDUCE_DATA].desc;
+        blocked = srcDesc.getBlockingDesc().getBlockDims().size() > srcDesc.getDims().size();
+        src_dims = srcDesc.getBlockingDesc().getBlockDims();
+        srcStrides = srcDesc.getBlockingDesc().getStrides();
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         int32_t *idx_data = inputs[REDUCE_INDEXES]->cbuffer().as<int32_t *>() +
                             inputs[REDUCE_INDEXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -90,6 +113,13 @@ public:
                 }
                 return PARAMETER_MISMATCH;
             }
+            if (blocked && axis == 1) {
+                if (resp) {
+                    std::string errorMsg = "Channels of the blocked tensor cannot be reduced";
+                    errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+                }
+                return PARAMETER_MISMATCH;
+            }
             axes.push_back(static_cast<size_t>(axis));
         }
 
@@ -114,7 +144,9 @@ public:
         if (!our_dims.size())
             our_dims = InferenceEngine::SizeVector(1, 1);
 
-        InferenceEngine::SizeVector dst_dims = outputs[0]->getTensorDesc().getDims();
+        // the batch and spatial axes are the same in the block dimensions
+        InferenceEngine::SizeVector dst_dims = blocked ? outputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()
+                                                       : outputs[0]->getTensorDesc().getDims();
         for (size_t i = 0; i < (std::min)(out_dims.size(), dst_dims.size()); i++) {
             if (out_dims[i] != dst_dims[i]) {
                 if (resp) {
@@ -220,10 +252,47 @@ public:
             }
             return GENERAL_ERROR;
         }
+
+        // LogSum, LogSumExp or Max of the zero lanes past the channels aren't zero
+        if (blocked)
+            zero_tail(dst_data, outputs[0]->getTensorDesc().getDims()[1], dst_dims);
         return OK;
     }
 
 private:
+    static bool constAxesKeepChannels(const CNNLayer* layer) {
+        auto creator = layer->insData[1].lock()->getCreatorLayer().lock();
+        if (!creator || creator->type != "Const")
+            return false;
+        auto blob = creator->blobs.find("custom");
+        if (blob == creator->blobs.end() || !blob->second ||
+                blob->second->getTensorDesc().getPrecision() != Precision::I32)
+            return false;
+
+        const size_t rank = layer->insData[0].lock()->getTensorDesc().getDims().size();
+        const int32_t *axes = blob->second->cbuffer().as<const int32_t *>();
+        for (size_t i = 0; i < blob->second->size(); i++) {
+            if (axes[i] == 1 || axes[i] + static_cast<int32_t>(rank) == 1)
+                return false;
+        }
+        return true;
+    }
+
+    void zero_tail(float* dst_data, size_t channels, const SizeVector& blk_dims) {
+        const size_t blk = blk_dims.back();
+        const size_t CB = blk_dims[1];
+        if (channels == CB * blk)
+            return;
+        size_t spatial = 1;
+        for (size_t i = 2; i + 1 < blk_dims.size(); i++)
+            spatial *= blk_dims[i];
+        parallel_for2d(blk_dims[0], spatial, [&](size_t n, size_t i) {
+            float* pdst = dst_data + ((n * CB + CB - 1) * spatial + i) * blk;
+            for (size_t c = channels - (CB - 1) * blk; c < blk; c++)
+                pdst[c] = 0.f;
+        });
+    }
+
     template <typename F1, typename F2>
     void reduce(const float *src_data, float* dst_data, size_t work_amount_dst, size_t reduced_dims_work_amount,
         SizeVector axes_for_reduction, SizeVector dst_dims, float init_value, F1 func1, F2 func2);
@@ -233,6 +302,7 @@ private:
     const size_t REDUCE_DATA = 0;
     const size_t REDUCE_INDEXES = 1;
     bool keep_dims = true;
+    bool blocked = false;
     Reduce reduceMode = Reduce::Sum;
     SizeVector data_dims;
     SizeVector idx_dims;
@@ -59,6 +59,7 @@ public:
             for (auto &conf : confs) {
                 conf.inConfs[0].desc.setPrecision(conf.outConfs[0].desc.getPrecision());
             }
+            postOpsSupported = layer->outData[0]->getTensorDesc().getPrecision() == Precision::FP32;
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -92,6 +93,7 @@ public:
                 size *= sizeof(float);
             }
             simple_copy(dst_data, outputs[0]->byteSize(), src_data, size);
+            applyPostOps(outputs[0]);
             return OK;
         }
 
@@ -141,6 +143,7 @@ public:
 #endif
                 InterpolationKernel(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN, kernel_width, isDownsample && antialias);
         }
+        applyPostOps(outputs[0]);
         return OK;
     }
 
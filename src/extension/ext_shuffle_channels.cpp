@@ -95,6 +95,17 @@ public:
             work_amount_dst = ownStrides[0] * own_dims[0];
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+
+            // channels are shuffled between the blocks, so every channel is copied by its own strided loop
+            if (axis == 1 && (dst_dims.size() == 4 || dst_dims.size() == 5)) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
+                groups = group;
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -106,6 +117,13 @@ public:
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
+        const SizeVector& dims = outputs[0]->getTensorDesc().getDims();
+        const SizeVector& blockDims = outputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        if (blockDims.size() > dims.size()) {
+            shuffle_blk(src_data, dst_data, dims, blockDims.back());
+            return OK;
+        }
+
         if (dataLength > 1) {
             //  Vectorized & Parallel
             parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -136,6 +154,32 @@ public:
     }
 
 private:
+    // the planar kernel writes the input channel (c % group) * (C / group) + c / group to the output channel c,
+    // the lanes of the last block past the channels are zero
+    void shuffle_blk(const float* src_data, float* dst_data, const SizeVector& dims, size_t blk) {
+        const size_t N = dims[0];
+        const size_t C = dims[1];
+        const size_t CB = (C + blk - 1) / blk;
+        const size_t group_size = C / groups;
+        size_t spatial = 1;
+        for (size_t i = 2; i < dims.size(); i++)
+            spatial *= dims[i];
+
+        parallel_for2d(N, CB * blk, [&](size_t n, size_t c) {
+            float* pdst = dst_data + ((n * CB + c / blk) * spatial) * blk + c % blk;
+            if (c >= C) {
+                for (size_t i = 0; i < spatial; i++)
+                    pdst[i * blk] = 0.f;
+                return;
+            }
+            const size_t src_c = (c % groups) * group_size + c / groups;
+            const float* psrc = src_data + ((n * CB + src_c / blk) * spatial) * blk + src_c % blk;
+            for (size_t i = 0; i < spatial; i++)
+                pdst[i * blk] = psrc[i * blk];
+        });
+    }
+
+    size_t groups = 1;
     size_t dataLength = 1;
     size_t work_amount_dst;
     size_t own_dims[CNTR_SIZE];
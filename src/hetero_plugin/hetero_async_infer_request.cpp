@@ -25,6 +25,11 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request
     _heteroInferRequest->setCallbackForLastRequest(f);
 }
 
+HeteroAsyncInferRequest::~HeteroAsyncInferRequest() {
+    // the callback of the pipelined execution refers to this request
+    _heteroInferRequest->waitPipelineJobs();
+}
+
 void HeteroAsyncInferRequest::StartAsync() {
     IE_PROFILING_AUTO_SCOPE(Hetero_Async)
     if (isRequestBusy())
@@ -29,6 +29,8 @@ public:
                             const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
+    ~HeteroAsyncInferRequest() override;
+
     void StartAsync() override;
 
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
@@ -42,8 +42,13 @@ StatusCode HeteroDeviceLoader::LoadNetwork(
         }
     }
 
+    // for devices without DEVICE_ID (e.g. CPU) the suffix only tells apart subgraphs of the same device,
+    // e.g. "CPU.0" and "CPU.1" affinities split the network into two stages of the pipelined execution
     if (!_deviceId.empty()) {
-        tconfig.insert({ CONFIG_KEY(DEVICE_ID), _deviceId });
+        InferenceEngine::ResponseDesc response;
+        if (_plugin->SetConfig({{ CONFIG_KEY(DEVICE_ID), _deviceId }}, &response) == OK) {
+            tconfig.insert({ CONFIG_KEY(DEVICE_ID), _deviceId });
+        }
     }
 
     return _plugin->LoadNetwork(ret, network, tconfig, resp);
@@ -296,6 +296,9 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
         descs.emplace_back(std::move(desc));
     }
 
+    auto itPipeline = config.find(KEY_HETERO_PIPELINE);
+    bool pipeline = itPipeline != config.end() && itPipeline->second == YES;
+
     for (auto &&d : descs) {
         IExecutableNetwork::Ptr ret;
         ResponseDesc resp;
@@ -313,6 +316,10 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
         cfg[IE_INTERNAL_CONFIG_KEY(SUBNETWORK_WITH_NETWORK_INPUTS)] = isInputSubnetwork
                                                                     ? CONFIG_VALUE(YES)
                                                                     : CONFIG_VALUE(NO);
+        // stages of the pipeline run at the same time even if they are on the same device
+        if (pipeline) {
+            cfg[KEY_EXCLUSIVE_ASYNC_REQUESTS] = CONFIG_VALUE(NO);
+        }
         IE_SUPPRESS_DEPRECATED_START
         StatusCode status = d._deviceLoader->LoadNetwork(d._device, ret, *d._clonedNetwork, cfg, &resp);
         IE_SUPPRESS_DEPRECATED_END
@@ -325,11 +332,40 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
 
 
     networks = std::move(descs);
+
+    if (pipeline) {
+        unsigned int stageRequests = 0;
+        auto itStageRequests = config.find(KEY_HETERO_PIPELINE_STAGE_REQUESTS);
+        if (itStageRequests != config.end()) {
+            int value;
+            try {
+                value = std::stoi(itStageRequests->second);
+            } catch (const std::exception &) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << KEY_HETERO_PIPELINE_STAGE_REQUESTS
+                                   << ". Expected only non-negative numbers (#requests)";
+            }
+            if (value < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << KEY_HETERO_PIPELINE_STAGE_REQUESTS
+                                   << ". Expected only non-negative numbers (#requests)";
+            stageRequests = static_cast<unsigned int>(value);
+        }
+        auto itPerfCount = config.find(KEY_PERF_COUNT);
+        bool perfCount = itPerfCount != config.end() && itPerfCount->second == YES;
+
+        std::vector<HeteroPipeline::StageDesc> stages;
+        for (auto &&d : networks) {
+            stages.push_back({d.network, d._iNames, d._oNames});
+        }
+        _pipeline = std::make_shared<HeteroPipeline>(stages, stageRequests, perfCount);
+    }
 }
 
 InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         InputsDataMap networkInputs,
         OutputsDataMap networkOutputs) {
+    if (_pipeline) {
+        return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, _pipeline);
+    }
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto i : networks) {
@@ -362,7 +398,12 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        result = it->second;
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(PIPELINE) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -383,13 +424,20 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE),
+            HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         result = IE_SET_METRIC(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         unsigned int value = 0u;
-        for (auto&& desc : networks) {
-            value = std::max(value, desc.network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        if (_pipeline) {
+            // a request per request of every stage keeps all stages busy
+            value = _pipeline->getNumRequests();
+        } else {
+            for (auto&& desc : networks) {
+                value = std::max(value, desc.network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            }
         }
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
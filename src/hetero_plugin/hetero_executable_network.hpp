@@ -23,6 +23,7 @@
 #include "ie_icore.hpp"
 #include "cnn_network_impl.hpp"
 #include "hetero_async_infer_request.hpp"
+#include "hetero_pipeline.hpp"
 
 namespace HeteroPlugin {
 
@@ -80,6 +81,7 @@ private:
         std::unordered_set<std::string> _iNames;
     };
     std::vector<NetworkDesc> networks;
+    HeteroPipeline::Ptr _pipeline;
 
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
     std::string _name;
@@ -10,8 +10,12 @@
 #include <debug.h>
 #include <ie_layouts.h>
 #include <cassert>
+#include <chrono>
 #include <map>
 #include <string>
+#include <memory>
+#include <utility>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -66,7 +70,38 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
     }
 }
 
+HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                       InferenceEngine::OutputsDataMap networkOutputs,
+                                       const HeteroPipeline::Ptr &pipeline) :
+        InferRequestInternal(networkInputs, networkOutputs),
+        _pipeline(pipeline) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
+    }
+
+    // requests of subgraphs are shared by all requests, so blobs of the network inputs and outputs are allocated here
+    for (auto &&input : _networkInputs) {
+        _inputs[input.first] = _pipeline->createBlob(input.first);
+    }
+    for (auto &&output : _networkOutputs) {
+        _outputs[output.first] = _pipeline->createBlob(output.first);
+    }
+}
+
+HeteroInferRequest::~HeteroInferRequest() {
+    // the job of the pipeline refers to the request, it must be done before the request is destroyed
+    waitPipelineJobs();
+}
+
 void HeteroInferRequest::InferImpl() {
+    if (_pipeline) {
+        startPipeline(false);
+        auto sts = waitPipeline(IInferRequest::WaitMode::RESULT_READY);
+        if (sts != OK) {
+            THROW_IE_EXCEPTION << "Pipelined execution of subgraphs failed with status " << sts;
+        }
+        return;
+    }
     updateInOutIfNeeded();
     size_t i = 0;
     for (auto &&desc : _inferRequests) {
@@ -79,6 +114,15 @@ void HeteroInferRequest::InferImpl() {
 
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
     perfMap.clear();
+    if (_pipeline) {
+        std::lock_guard<std::mutex> lock(_pipelineMutex);
+        for (size_t i = 0; i < _perfCounts.size(); i++) {
+            for (auto &&r : _perfCounts[i]) {
+                perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
+            }
+        }
+        return;
+    }
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
         for (auto &&r : perfMapRequest) {
@@ -89,6 +133,10 @@ void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEng
 
 void HeteroInferRequest::updateInOutIfNeeded() {
     IE_PROFILING_AUTO_SCOPE(updateInOutIfNeeded);
+    // the pipeline sets the blobs to the requests of subgraphs for every inference
+    if (_pipeline) {
+        return;
+    }
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
@@ -123,16 +171,27 @@ void HeteroInferRequest::updateInOutIfNeeded() {
 }
 
 void HeteroInferRequest::startFirstAsyncRequest() {
+    if (_pipeline) {
+        startPipeline(true);
+        return;
+    }
     auto firstAsyncRequest = _inferRequests.begin()->_request;
     firstAsyncRequest->StartAsync();
 }
 
 void HeteroInferRequest::setCallbackForLastRequest(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)>& callback) {
+    if (_pipeline) {
+        _lastCallback = callback;
+        return;
+    }
     auto lastRequest = _inferRequests.back()._request;
     if (lastRequest) lastRequest->SetCompletionCallback(callback);
 }
 
 void HeteroInferRequest::setCallbackSequence() {
+    if (_pipeline) {
+        return;
+    }
     for (auto desc = _inferRequests.begin(); desc != _inferRequests.end(); desc++) {
         auto &currentAsyncRequest = desc->_request;
         auto nextRequestDesc = std::next(desc);
@@ -149,6 +208,9 @@ void HeteroInferRequest::setCallbackSequence() {
 }
 
 StatusCode HeteroInferRequest::waitAllRequests(int64_t millis_timeout) {
+    if (_pipeline) {
+        return waitPipeline(millis_timeout);
+    }
     StatusCode status = INFER_NOT_STARTED;
     bool shareMsMode = true;
     std::chrono::high_resolution_clock::time_point startTime;
@@ -175,3 +237,71 @@ StatusCode HeteroInferRequest::waitAllRequests(int64_t millis_timeout) {
     }
     return status;
 }
+
+void HeteroInferRequest::startPipeline(bool async) {
+    auto job = std::make_shared<HeteroPipeline::Job>();
+    for (auto &&input : _inputs) {
+        auto it = _preProcData.find(input.first);
+        job->_blobs[input.first] = it != _preProcData.end() ? it->second.getRoiBlob() : input.second;
+    }
+    for (auto &&output : _outputs) {
+        job->_blobs[output.first] = output.second;
+    }
+
+    HeteroPipeline::Job *pJob = job.get();
+    auto jobs = _pipelineJobs;
+    job->_callback = [this, pJob, async, jobs](StatusCode sts) {
+        {
+            std::lock_guard<std::mutex> lock(_pipelineMutex);
+            _perfCounts = std::move(pJob->_perfCounts);
+            _pipelineStatus = sts;
+        }
+        _pipelineDone.notify_all();
+        // the callback of the sync inference is not called
+        if (async && _lastCallback) {
+            auto callback = _lastCallback;
+            {
+                std::lock_guard<std::mutex> lock(jobs->_mutex);
+                jobs->_callbackThread = std::this_thread::get_id();
+            }
+            // the request may be destroyed by the callback, only the shared state is used after it
+            callback(InferRequest(), sts);
+        }
+        // notified under the lock as the destructor of the request may run right after the unlock
+        std::lock_guard<std::mutex> lock(jobs->_mutex);
+        jobs->_count--;
+        jobs->_callbackThread = std::thread::id();
+        jobs->_done.notify_all();
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(_pipelineMutex);
+        _pipelineStatus = RESULT_NOT_READY;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_pipelineJobs->_mutex);
+        _pipelineJobs->_count++;
+    }
+    _pipeline->submit(job);
+}
+
+StatusCode HeteroInferRequest::waitPipeline(int64_t millis_timeout) {
+    std::unique_lock<std::mutex> lock(_pipelineMutex);
+    auto ready = [&] { return _pipelineStatus != RESULT_NOT_READY; };
+    if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+        _pipelineDone.wait(lock, ready);
+    } else if (millis_timeout != IInferRequest::WaitMode::STATUS_ONLY) {
+        _pipelineDone.wait_for(lock, std::chrono::milliseconds(millis_timeout), ready);
+    }
+    return _pipelineStatus;
+}
+
+void HeteroInferRequest::waitPipelineJobs() {
+    // the job running the completion callback on this thread is not waited for,
+    // the request is released by the callback in this case
+    auto jobs = _pipelineJobs;
+    std::unique_lock<std::mutex> lock(jobs->_mutex);
+    jobs->_done.wait(lock, [&] {
+        return jobs->_count == 0 || (jobs->_count == 1 && jobs->_callbackThread == std::this_thread::get_id());
+    });
+}
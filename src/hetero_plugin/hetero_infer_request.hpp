@@ -14,11 +14,15 @@
 #include <vector>
 #include <memory>
 #include <unordered_set>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
 #include <cpp/ie_infer_request.hpp>
 #include <cpp/ie_executable_network.hpp>
+#include "hetero_pipeline.hpp"
 
 namespace HeteroPlugin {
 
@@ -39,6 +43,16 @@ public:
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests);
 
+    /**
+     * @brief Creates the request of the pipelined execution, the request has its own input and output blobs
+     * and takes the requests of subgraphs from the pools of the pipeline for every inference
+     */
+    explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                InferenceEngine::OutputsDataMap networkOutputs,
+                                const HeteroPipeline::Ptr &pipeline);
+
+    ~HeteroInferRequest() override;
+
     void InferImpl() override;
 
     void
@@ -56,9 +70,32 @@ public:
 
     bool isAnyRequestBusy();
 
+    // waits for the jobs of the pipeline including their completion callbacks
+    void waitPipelineJobs();
+
 private:
+    void startPipeline(bool async);
+
+    InferenceEngine::StatusCode waitPipeline(int64_t millis_timeout);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+
+    HeteroPipeline::Ptr _pipeline;
+    mutable std::mutex _pipelineMutex;
+    std::condition_variable _pipelineDone;
+    InferenceEngine::StatusCode _pipelineStatus = InferenceEngine::INFER_NOT_STARTED;
+    // jobs in flight including the ones running the completion callback, shared with the jobs
+    // as the request may be released by the user in its completion callback
+    struct PipelineJobs {
+        std::mutex _mutex;
+        std::condition_variable _done;
+        size_t _count = 0;
+        std::thread::id _callbackThread;  // the thread running the completion callback
+    };
+    std::shared_ptr<PipelineJobs> _pipelineJobs = std::make_shared<PipelineJobs>();
+    std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)> _lastCallback;
+    std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _perfCounts;
 };
 
 }  // namespace HeteroPlugin
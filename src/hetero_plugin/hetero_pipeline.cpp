@@ -0,0 +1,211 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.hpp"
+#include <blob_factory.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_profiling.hpp>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(const std::vector<StageDesc> &stages, unsigned int stageRequests, bool perfCount) :
+        _stages(stages.size()),
+        _perfCount(perfCount) {
+    if (stages.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no subgraphs for the pipelined execution";
+    }
+    auto lastUses = getLastUses(stages);
+    for (size_t s = 0; s < stages.size(); s++) {
+        auto &stage = _stages[s];
+        stage._desc = stages[s];
+        stage._lastUse = lastUses[s];
+
+        unsigned int numRequests = stageRequests;
+        if (numRequests == 0) {
+            try {
+                numRequests = stage._desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            } catch (const std::exception &) {
+                // the metric is not supported by the plugin
+            }
+        }
+        numRequests = std::max(numRequests, 1u);
+
+        for (int i = 0; i < static_cast<int>(numRequests); i++) {
+            auto request = stage._desc._network->CreateInferRequestPtr();
+            request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                    [this, s, i](InferRequest /*request*/, StatusCode sts) {
+                        IE_PROFILING_AUTO_SCOPE(PipelineCallback)
+                        onStageDone(s, i, sts);
+                    });
+            stage._requests.push_back(request);
+            stage._idle.push_back(i);
+        }
+        stage._boundBlobs.resize(numRequests);
+        stage._jobs.resize(numRequests);
+
+        for (auto &&name : stage._desc._oNames) {
+            _producers[name] = s;
+            _blobDescs[name] = stage._requests[0]->GetBlob(name.c_str())->getTensorDesc();
+        }
+        for (auto &&name : stage._desc._iNames) {
+            if (_blobDescs.find(name) == _blobDescs.end()) {
+                _blobDescs[name] = stage._requests[0]->GetBlob(name.c_str())->getTensorDesc();
+            }
+        }
+    }
+}
+
+std::vector<size_t> HeteroPipeline::getLastUses(const std::vector<StageDesc> &stages) {
+    // subgraphs are sorted, so the stage reads the outputs of the previous stages only
+    std::vector<size_t> lastUses(stages.size());
+    for (size_t s = 0; s < stages.size(); s++) {
+        lastUses[s] = s;
+        for (size_t j = s + 1; j < stages.size(); j++) {
+            for (auto &&name : stages[j]._iNames) {
+                if (stages[s]._oNames.find(name) != stages[s]._oNames.end()) {
+                    lastUses[s] = j;
+                    break;
+                }
+            }
+        }
+    }
+    return lastUses;
+}
+
+Blob::Ptr HeteroPipeline::createBlob(const std::string &name) const {
+    auto it = _blobDescs.find(name);
+    if (it == _blobDescs.end()) {
+        THROW_IE_EXCEPTION << "Internal error: no subgraph has the blob " << name;
+    }
+    auto blob = make_blob_with_precision(it->second);
+    blob->allocate();
+    return blob;
+}
+
+unsigned int HeteroPipeline::getNumRequests() const {
+    size_t numRequests = 0;
+    for (auto &&stage : _stages) {
+        numRequests += stage._requests.size();
+    }
+    return static_cast<unsigned int>(numRequests);
+}
+
+void HeteroPipeline::submit(const Job::Ptr &job) {
+    job->_requests.assign(_stages.size(), -1);
+    job->_perfCounts.assign(_stages.size(), {});
+
+    StartList toStart;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stages[0]._queue.push_back(job);
+        schedule(0, toStart);
+    }
+    start(toStart);
+}
+
+void HeteroPipeline::schedule(size_t stage, StartList &toStart) {
+    auto &st = _stages[stage];
+    while (!st._queue.empty() && !st._idle.empty()) {
+        auto job = st._queue.front();
+        st._queue.pop_front();
+        int request = st._idle.front();
+        st._idle.pop_front();
+
+        job->_requests[stage] = request;
+        st._jobs[request] = job;
+        toStart.push_back({stage, request, job});
+    }
+}
+
+void HeteroPipeline::release(const Job::Ptr &job, StartList &toStart, bool all, size_t doneStage) {
+    for (size_t s = 0; s < _stages.size(); s++) {
+        int request = job->_requests[s];
+        if (request < 0 || (!all && _stages[s]._lastUse > doneStage))
+            continue;
+        job->_requests[s] = -1;
+        _stages[s]._jobs[request] = nullptr;
+        _stages[s]._idle.push_back(request);
+        schedule(s, toStart);
+    }
+}
+
+void HeteroPipeline::start(const StartList &toStart) {
+    for (auto &&desc : toStart) {
+        try {
+            bind(desc._stage, desc._request, *desc._job);
+            _stages[desc._stage]._requests[desc._request]->StartAsync();
+        } catch (...) {
+            onStageDone(desc._stage, desc._request, GENERAL_ERROR);
+        }
+    }
+}
+
+void HeteroPipeline::bind(size_t stage, int request, const Job &job) {
+    IE_PROFILING_AUTO_SCOPE(PipelineBind)
+    auto &st = _stages[stage];
+    auto &r = st._requests[request];
+    auto &bound = st._boundBlobs[request];
+    auto setBlob = [&](const std::string &name, const Blob::Ptr &blob) {
+        auto it = bound.find(name);
+        if (it == bound.end() || it->second != blob) {
+            r->SetBlob(name.c_str(), blob);
+            bound[name] = blob;
+        }
+    };
+
+    // intermediate outputs stay in the blobs of the request, network outputs are written to the HETERO request
+    for (auto &&name : st._desc._oNames) {
+        auto it = job._blobs.find(name);
+        if (it != job._blobs.end()) {
+            setBlob(name, it->second);
+        }
+    }
+    for (auto &&name : st._desc._iNames) {
+        auto it = job._blobs.find(name);
+        if (it != job._blobs.end()) {
+            setBlob(name, it->second);
+        } else {
+            // the request of the producer is held by the job until this stage is done
+            size_t producer = _producers.at(name);
+            auto &producerRequest = _stages[producer]._requests[job._requests[producer]];
+            setBlob(name, producerRequest->GetBlob(name.c_str()));
+        }
+    }
+}
+
+void HeteroPipeline::onStageDone(size_t stage, int request, StatusCode status) {
+    std::map<std::string, InferenceEngineProfileInfo> perfCounts;
+    if (_perfCount && status == OK) {
+        perfCounts = _stages[stage]._requests[request]->GetPerformanceCounts();
+    }
+
+    StartList toStart;
+    Job::Ptr finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto job = _stages[stage]._jobs[request];
+        if (!job)
+            return;
+        job->_perfCounts[stage] = std::move(perfCounts);
+
+        bool last = status != OK || stage + 1 == _stages.size();
+        release(job, toStart, last, stage);
+        if (last) {
+            finished = job;
+        } else {
+            _stages[stage + 1]._queue.push_back(job);
+            schedule(stage + 1, toStart);
+        }
+    }
+    start(toStart);
+
+    if (finished) {
+        finished->_callback(status);
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the pipelined execution of subgraphs
+ * @file hetero_pipeline.hpp
+ */
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <ie_common.h>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp/ie_executable_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Pipelined execution of the subgraphs of HETERO executable network (HETERO_CONFIG_KEY(PIPELINE)).
+ * Every subgraph is a stage with its own pool of infer requests and a FIFO queue of the jobs waiting for a request
+ * of the stage, the pools are shared by all HETERO infer requests of the executable network. A job keeps the request
+ * of a stage only until the last stage consuming the intermediate outputs of this request is done, so the job of
+ * the next HETERO request runs the stage while the previous job runs the later stages.
+ * The queues are bounded by the number of HETERO requests as every request has at most one job in flight.
+ */
+class HeteroPipeline {
+public:
+    typedef std::shared_ptr<HeteroPipeline> Ptr;
+
+    struct StageDesc {
+        InferenceEngine::ExecutableNetwork::Ptr _network;
+        std::unordered_set<std::string> _iNames;
+        std::unordered_set<std::string> _oNames;
+    };
+
+    /**
+     * @brief The inference of one HETERO request. The blobs are network inputs (or their pre-processing ROI blobs)
+     * and outputs of the request, the callback is called once the last stage is done or any stage failed.
+     */
+    struct Job {
+        typedef std::shared_ptr<Job> Ptr;
+
+        InferenceEngine::BlobMap _blobs;
+        std::function<void(InferenceEngine::StatusCode)> _callback;
+        std::vector<int> _requests;  // index of the request held in every stage, -1 if none
+        // performance counters of every stage, collected only if PERF_COUNT is enabled
+        std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _perfCounts;
+    };
+
+    /**
+     * @brief Creates the pools of requests, stageRequests is the size of every pool,
+     * 0 means the OPTIMAL_NUMBER_OF_INFER_REQUESTS metric of the stage network
+     */
+    HeteroPipeline(const std::vector<StageDesc> &stages, unsigned int stageRequests, bool perfCount);
+
+    /**
+     * @brief Returns the last stage reading the outputs of every stage, the stage itself
+     * if its outputs are network outputs only
+     */
+    static std::vector<size_t> getLastUses(const std::vector<StageDesc> &stages);
+
+    // enqueues the job to the first stage
+    void submit(const Job::Ptr &job);
+
+    // returns the blob of the network input or output allocated like the one of the stage request
+    InferenceEngine::Blob::Ptr createBlob(const std::string &name) const;
+
+    // returns the number of requests of all stages
+    unsigned int getNumRequests() const;
+
+private:
+    struct Stage {
+        StageDesc _desc;
+        size_t _lastUse = 0;
+        std::vector<InferenceEngine::InferRequest::Ptr> _requests;
+        // the blobs set to every request by the last job, not to call SetBlob for the same blob again
+        std::vector<InferenceEngine::BlobMap> _boundBlobs;
+        std::vector<Job::Ptr> _jobs;
+        std::deque<int> _idle;
+        std::deque<Job::Ptr> _queue;
+    };
+    struct StartDesc {
+        size_t _stage;
+        int _request;
+        Job::Ptr _job;
+    };
+    typedef std::vector<StartDesc> StartList;
+
+    // assigns idle requests of the stage to the waiting jobs, must be called under the lock
+    void schedule(size_t stage, StartList &toStart);
+    // returns the requests of the job held in the stages to the pools, must be called under the lock
+    void release(const Job::Ptr &job, StartList &toStart, bool all, size_t doneStage);
+    // sets the blobs of the job and starts the requests outside of the lock
+    void start(const StartList &toStart);
+    void bind(size_t stage, int request, const Job &job);
+    void onStageDone(size_t stage, int request, InferenceEngine::StatusCode status);
+
+    std::mutex _mutex;
+    std::vector<Stage> _stages;
+    std::map<std::string, size_t> _producers;
+    std::map<std::string, InferenceEngine::TensorDesc> _blobDescs;
+    bool _perfCount;
+};
+
+}  // namespace HeteroPlugin
@@ -35,6 +35,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS] = "YES";
     _config[KEY_HETERO_DUMP_GRAPH_DOT] = NO;
+    _config[KEY_HETERO_PIPELINE] = NO;
+    _config[KEY_HETERO_PIPELINE_STAGE_REQUESTS] = "0";
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const ICore * core, InferenceEngine::ICNNNetwork &network,
@@ -116,6 +118,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE),
+            HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else {
@@ -129,6 +133,15 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        auto it = _config.find(KEY_HETERO_PIPELINE);
+        IE_ASSERT(it != _config.end());
+        bool pipeline = it->second == YES;
+        return { pipeline };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS)) {
+        auto it = _config.find(KEY_HETERO_PIPELINE_STAGE_REQUESTS);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
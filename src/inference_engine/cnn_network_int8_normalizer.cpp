@@ -1645,3 +1645,139 @@ void CNNNetworkInt8Normalizer::NormalizeNetwork(ICNNNetwork& network, ICNNNetwor
     saveGraphToDot(cnnn, file, precisionColoring);
 #endif
 }
+
+static Blob::Ptr getConstBlob(const DataWeakPtr& data) {
+    auto creator = data.lock()->getCreatorLayer().lock();
+    if (!creator || !CaselessEq<std::string>()(creator->type, "const"))
+        return nullptr;
+    auto blob = creator->blobs.find("custom");
+    if (blob == creator->blobs.end() || blob->second->getTensorDesc().getPrecision() != Precision::FP32)
+        return nullptr;
+    return blob->second;
+}
+
+bool CNNNetworkInt8Normalizer::FoldFakeQuantize(ICNNNetwork& network, ICNNNetworkStats& netStats) {
+    auto* networkImpl = dynamic_cast<CNNNetworkImpl*>(&network);
+    if (networkImpl == nullptr)
+        return false;
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    StatsMap statsMap = netStats.getNodesStats();
+    std::set<std::string> foldedProducers;
+    bool folded = false;
+
+    // the int8 layer quantizes its input by the statistic of the producer, so it rounds and clamps the data
+    // like the removed FakeQuantize. A layer staying in FP32 would get the data without the rounding and the clamp
+    auto quantizesInput = [&](const CNNLayerPtr& consumer, const std::string& producerName) {
+        auto level = consumer->params.find("quantization_level");
+        if (level != consumer->params.end() && (level->second == "FP32" || level->second == "FP16"))
+            return false;
+        // the same conditions as in DefinesExecutionPrecision
+        if (!CaselessEq<std::string>()(consumer->type, "convolution") &&
+            !(CaselessEq<std::string>()(consumer->type, "fullyconnected") && level != consumer->params.end()))
+            return false;
+        if (consumer->outData.size() != 1 || !canLayerBeI8(consumer))
+            return false;
+        for (const auto& insData : consumer->insData) {
+            auto creator = insData.lock()->getCreatorLayer().lock();
+            if (!creator || (creator->name != producerName && statsMap.find(creator->name) == statsMap.end()))
+                return false;
+        }
+        return true;
+    };
+
+    for (auto layer : CNNNetSortTopologically(network)) {
+        auto* quantize = dynamic_cast<QuantizeLayer*>(layer.get());
+        if (quantize == nullptr || layer->insData.size() != 5 || layer->outData.size() != 1)
+            continue;
+        // binarization is executed by binary convolutions, more levels don't fit 8 bits
+        if (quantize->levels <= 2 || quantize->levels > 256)
+            continue;
+
+        DataPtr input = layer->insData[0].lock();
+        DataPtr output = layer->outData[0];
+        CNNLayerPtr producer = input->getCreatorLayer().lock();
+        // quantized weights are left for the constant propagation, statistic can't describe a port of multi-output layer
+        if (!producer || CaselessEq<std::string>()(producer->type, "const") || producer->outData.size() != 1 ||
+            outputs.find(output->getName()) != outputs.end() || output->getInputTo().empty()) {
+            continue;
+        }
+        bool int8Consumers = true;
+        for (const auto& consumer : output->getInputTo()) {
+            if (!quantizesInput(consumer.second, producer->name)) {
+                int8Consumers = false;
+                break;
+            }
+        }
+        if (!int8Consumers)
+            continue;
+
+        const SizeVector& dims = input->getTensorDesc().getDims();
+        const size_t channels = dims.size() > 1 ? dims[1] : 1;
+        std::vector<Blob::Ptr> ranges;
+        for (size_t i = 1; i < layer->insData.size(); i++) {
+            Blob::Ptr blob = getConstBlob(layer->insData[i]);
+            if (!blob || (blob->size() != 1 && blob->size() != channels))
+                break;
+            ranges.push_back(blob);
+        }
+        if (ranges.size() != 4)
+            continue;
+
+        // int8 execution can only scale the data, so the output range must be the input one
+        auto rangeValue = [&](size_t idx, size_t c) {
+            return ranges[idx]->buffer().as<float*>()[ranges[idx]->size() == 1 ? 0 : c];
+        };
+        auto equal = [](float a, float b) {
+            return fabs(a - b) <= 1e-5f * fmax(1.f, fabs(a));
+        };
+        NetworkNodeStatsPtr stat = std::make_shared<NetworkNodeStats>();
+        bool foldable = true;
+        for (size_t c = 0; c < channels && foldable; c++) {
+            float inputLow = rangeValue(0, c), inputHigh = rangeValue(1, c);
+            foldable = inputLow < inputHigh && equal(inputLow, rangeValue(2, c)) && equal(inputHigh, rangeValue(3, c));
+            stat->_minOutputs.push_back(inputLow);
+            stat->_maxOutputs.push_back(inputHigh);
+        }
+        // the data quantized differently for different consumers can't have a single statistic
+        auto known = statsMap.find(producer->name);
+        if (foldable && known != statsMap.end() && foldedProducers.count(producer->name)) {
+            foldable = known->second->_minOutputs == stat->_minOutputs &&
+                       known->second->_maxOutputs == stat->_maxOutputs;
+        }
+        if (!foldable)
+            continue;
+
+        // consumers of the quantized data get the data of the producer
+        input->getInputTo().erase(layer->name);
+        for (const auto& consumer : output->getInputTo()) {
+            for (auto& insData : consumer.second->insData) {
+                if (insData.lock() == output)
+                    insData = input;
+            }
+            input->getInputTo()[consumer.first] = consumer.second;
+        }
+        for (size_t i = 1; i < layer->insData.size(); i++) {
+            DataPtr rangeData = layer->insData[i].lock();
+            rangeData->getInputTo().erase(layer->name);
+            if (rangeData->getInputTo().empty()) {
+                networkImpl->removeLayer(rangeData->getCreatorLayer().lock()->name);
+                networkImpl->removeData(rangeData->getName());
+            }
+        }
+        networkImpl->removeData(output->getName());
+        networkImpl->removeLayer(layer->name);
+        folded = true;
+
+        // statistic collected by calibration takes precedence
+        if (known == statsMap.end()) {
+            statsMap[producer->name] = stat;
+            foldedProducers.insert(producer->name);
+        }
+    }
+
+    if (folded)
+        netStats.setNodesStats(statsMap);
+    return folded;
+}
@@ -165,6 +165,14 @@ public:
     /** main function for calling of quantization */
     static void NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats);
 
+    /**
+     * Removes FakeQuantize layers keeping the range of the data and puts the ranges into the statistic
+     * of the quantized layers, so quantization aware trained network is normalized as a calibrated one.
+     * The layer is removed only if all its consumers are executed in int8 and quantize the data themselves.
+     * Returns true if any layer is removed
+     */
+    static bool FoldFakeQuantize(ICNNNetwork& network, ICNNNetworkStats& netStats);
+
 protected:
     /** Helper function to add scaleshifts and other layers for transformatin of topology */
     static void AddLayerToCNNNetworkBeforeLayer(CNNLayer::Ptr newLayer, CNNLayer::Ptr successor, size_t port);
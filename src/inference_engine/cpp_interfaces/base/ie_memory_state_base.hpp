@@ -12,10 +12,10 @@
 namespace InferenceEngine {
 
 /**
- * @brief default implementation for IMemoryState
+ * @brief default implementation for IMemoryState, SwapState reports NOT_IMPLEMENTED unless the implementation supports it
  */
 template <class T>
-class MemoryStateBase : public IMemoryState  {
+class MemoryStateBase : public IMemoryStateSwappable  {
 protected:
     std::shared_ptr<T> impl;
 
@@ -46,6 +46,10 @@ protected:
     StatusCode GetLastState(Blob::CPtr & lastState, ResponseDesc *resp) const noexcept override {
         TO_STATUS(lastState = impl->GetLastState());
     }
+
+    StatusCode SwapState(Blob::Ptr &state, ResponseDesc *resp) noexcept override {
+        TO_STATUS(impl->SwapState(state));
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -6,13 +6,18 @@
 #include <string>
 #include "cpp_interfaces/ie_executor_manager.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_lock_free_task_executor.hpp"
 
 namespace InferenceEngine {
 
-ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
+ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id, TaskExecutorType type) {
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
-        auto newExec = std::make_shared<TaskExecutor>(id);
+        ITaskExecutor::Ptr newExec;
+        if (type == TaskExecutorType::LOCK_FREE)
+            newExec = std::make_shared<LockFreeTaskExecutor>(id);
+        else
+            newExec = std::make_shared<TaskExecutor>(id);
         executors[id] = newExec;
         return newExec;
     }
@@ -30,8 +35,8 @@ void ExecutorManagerImpl::clear() {
 
 ExecutorManager *ExecutorManager::_instance = nullptr;
 
-ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id) {
-    return _impl.getExecutor(id);
+ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id, TaskExecutorType type) {
+    return _impl.getExecutor(id, type);
 }
 
 size_t ExecutorManager::getExecutorsNumber() {
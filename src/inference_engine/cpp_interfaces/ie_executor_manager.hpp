@@ -11,6 +11,14 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Implementation of the task executor created by ExecutorManager
+ */
+enum class TaskExecutorType {
+    MUTEX_QUEUE,  // TaskExecutor: queue guarded by mutex, working thread sleeps between tasks
+    LOCK_FREE     // LockFreeTaskExecutor: lock-free queue, working thread spins before sleep
+};
+
 /**
  * @class ExecutorManagerImpl
  * @brief This class contains implementation of ExecutorManager global instance to provide task executor objects.
@@ -19,7 +27,7 @@ namespace InferenceEngine {
  */
 class ExecutorManagerImpl {
 public:
-    ITaskExecutor::Ptr getExecutor(std::string id);
+    ITaskExecutor::Ptr getExecutor(std::string id, TaskExecutorType type = TaskExecutorType::MUTEX_QUEUE);
 
     // for tests purposes
     size_t getExecutorsNumber();
@@ -54,8 +62,9 @@ public:
     /**
      * @brief Returns executor by unique identificator
      * @param id unique identificator of device (Usually string representation of TargetDevice)
+     * @param type implementation of the executor, used if executor with such id doesn't exist yet
      */
-    ITaskExecutor::Ptr getExecutor(std::string id);
+    ITaskExecutor::Ptr getExecutor(std::string id, TaskExecutorType type = TaskExecutorType::MUTEX_QUEUE);
 
     // for tests purposes
     size_t getExecutorsNumber();
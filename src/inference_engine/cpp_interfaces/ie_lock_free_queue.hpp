@@ -0,0 +1,123 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace InferenceEngine {
+
+/**
+ * @class LockFreeQueue
+ * @brief Bounded multi-producer multi-consumer FIFO queue (D. Vyukov's algorithm).
+ * Each cell has a sequence number which tells producers and consumers whether the cell is free or filled for
+ * the current lap over the ring buffer, so push and pop take one CAS on the position without locks.
+ */
+template <typename T>
+class LockFreeQueue {
+public:
+    /**
+     * @param capacity - maximum number of elements, rounded up to the power of two
+     */
+    explicit LockFreeQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        _mask = size - 1;
+        _buffer.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            _buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    LockFreeQueue(const LockFreeQueue &) = delete;
+    LockFreeQueue &operator=(const LockFreeQueue &) = delete;
+
+    /**
+     * @brief Adds the element to the queue
+     * @return false if the queue is full
+     */
+    bool tryPush(T value) {
+        Cell *cell;
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_buffer[pos & _mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Takes the first element from the queue
+     * @return false if the queue is empty
+     */
+    bool tryPop(T &value) {
+        Cell *cell;
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_buffer[pos & _mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        // moved-from element must not hold resources until the cell is reused
+        cell->data = T();
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks if the first element is ready to be popped
+     */
+    bool empty() const {
+        size_t pos = _dequeuePos.load(std::memory_order_seq_cst);
+        return _buffer[pos & _mask].sequence.load(std::memory_order_seq_cst) != pos + 1;
+    }
+
+    size_t capacity() const {
+        return _mask + 1;
+    }
+
+private:
+    static const size_t kCacheLineSize = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> _buffer;
+    size_t _mask;
+    // positions are modified by different threads, padding keeps them in different cache lines
+    char _pad0[kCacheLineSize];
+    std::atomic<size_t> _enqueuePos;
+    char _pad1[kCacheLineSize - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> _dequeuePos;
+    char _pad2[kCacheLineSize - sizeof(std::atomic<size_t>)];
+};
+
+}  // namespace InferenceEngine
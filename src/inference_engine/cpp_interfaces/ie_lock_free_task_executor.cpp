@@ -0,0 +1,88 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <ie_profiling.hpp>
+#include "ie_task.hpp"
+#include "ie_lock_free_task_executor.hpp"
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <immintrin.h>
+#define IE_CPU_PAUSE() _mm_pause()
+#else
+#define IE_CPU_PAUSE() std::this_thread::yield()
+#endif
+
+namespace InferenceEngine {
+
+LockFreeTaskExecutor::LockFreeTaskExecutor(std::string name, size_t capacity, size_t spinCount)
+        : _taskQueue(capacity), _isStopped(false), _isSleeping(false),
+          // spinning makes no sense if it takes the only core from the producer
+          _spinCount(std::thread::hardware_concurrency() > 1 ? spinCount : 0), _name(name) {
+    _thread = std::thread([this] { run(); });
+}
+
+LockFreeTaskExecutor::~LockFreeTaskExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _isStopped = true;
+        _sleepCondVar.notify_all();
+    }
+    // working thread completes all queued tasks before exit
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void LockFreeTaskExecutor::run() {
+    annotateSetThreadName(("LockFreeTaskExecutor thread for " + _name).c_str());
+    for (;;) {
+        Task::Ptr currentTask;
+        if (_taskQueue.tryPop(currentTask)) {
+            currentTask->runNoThrowNoBusyCheck();
+            continue;
+        }
+        if (_isStopped)
+            break;
+
+        bool hasTask = false;
+        for (size_t i = 0; i < _spinCount && !hasTask; i++) {
+            IE_CPU_PAUSE();
+            hasTask = !_taskQueue.empty();
+        }
+        if (hasTask)
+            continue;
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _isSleeping = true;
+        // pairs with the fence in startTask: either producer sees the sleeping flag or we see the pushed task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        _sleepCondVar.wait(lock, [this] { return !_taskQueue.empty() || _isStopped; });
+        _isSleeping = false;
+    }
+}
+
+bool LockFreeTaskExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    const bool fromWorker = std::this_thread::get_id() == _thread.get_id();
+    while (!_taskQueue.tryPush(task)) {
+        // working thread is the only consumer: it can't wait for the free slot, the caller gets busy status
+        if (fromWorker) {
+            task->release();
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_isSleeping) {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _sleepCondVar.notify_one();
+    }
+    return true;
+}
+
+}  // namespace InferenceEngine
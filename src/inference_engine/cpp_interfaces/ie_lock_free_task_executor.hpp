@@ -0,0 +1,61 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include "ie_api.h"
+#include "cpp_interfaces/ie_task.hpp"
+#include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_lock_free_queue.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class LockFreeTaskExecutor
+ * @brief Task executor with a single working thread and a bounded lock-free queue of tasks.
+ * Working thread spins for a while on the empty queue before it goes to sleep, so tasks coming in a row are
+ * started without a wakeup and producers take a lock only to wake the sleeping thread.
+ */
+class INFERENCE_ENGINE_API_CLASS(LockFreeTaskExecutor) : public ITaskExecutor {
+public:
+    typedef std::shared_ptr<LockFreeTaskExecutor> Ptr;
+
+    /**
+     * @param name - name of the executor
+     * @param capacity - maximum number of tasks in the queue, startTask waits if the queue is full,
+     * startTask called from a task running in the executor returns false if the queue is full
+     * @param spinCount - number of checks of the empty queue before going to sleep, 0 to sleep immediately
+     */
+    explicit LockFreeTaskExecutor(std::string name = "Default", size_t capacity = 1024, size_t spinCount = 4000);
+
+    ~LockFreeTaskExecutor();
+
+    /**
+     * @brief Add task for execution and notify working thread about new task to start.
+     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+     * @param task - shared pointer to the task to start
+     *  @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(Task::Ptr task) override;
+
+private:
+    void run();
+
+    LockFreeQueue<Task::Ptr> _taskQueue;
+    std::atomic<bool> _isStopped;
+    std::atomic<bool> _isSleeping;
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCondVar;
+    size_t _spinCount;
+    std::string _name;
+    std::thread _thread;
+};
+
+}  // namespace InferenceEngine
@@ -78,6 +78,11 @@ bool Task::occupy() {
     return true;
 }
 
+void Task::release() {
+    std::unique_lock<std::mutex> guard(_taskStatusMutex);
+    _status = TS_INITIAL;
+}
+
 Task::Status Task::getStatus() {
     std::unique_lock<std::mutex> guard(_taskStatusMutex);
     return _status;
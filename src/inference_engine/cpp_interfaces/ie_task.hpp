@@ -74,6 +74,11 @@ public:
      */
     bool occupy();
 
+    /**
+     * @brief Releases the task occupied for launching if it could not be launched, so it can be started again
+     */
+    void release();
+
     Status getStatus();
 
     void checkException();
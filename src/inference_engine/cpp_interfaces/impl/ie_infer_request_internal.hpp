@@ -302,6 +302,7 @@ protected:
         // 2. color format specified:
         // 2.a. color format is not equal to network's expected (color conversion required)
         // 2.b. network's layout != blob's layout (reorder required)
+        // 3. batched blob is passed (images are pre-processed into items of the batch)
         const auto& preProcessInfo = info->getPreProcess();
         const auto inputColorFormat = preProcessInfo.getColorFormat();
         // FIXME: support other network's input formats once the API is ready. Assuming input is in
@@ -311,7 +312,8 @@ protected:
         const bool colorFormatSpecified = inputColorFormat != ColorFormat::RAW;
         return preProcessInfo.getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE
             || (colorFormatSpecified && inputColorFormat != networkColorFormat)
-            || (colorFormatSpecified && info->getLayout() != blob->getTensorDesc().getLayout());
+            || (colorFormatSpecified && info->getLayout() != blob->getTensorDesc().getLayout())
+            || blob->is<BatchedBlob>();
     }
 };
 
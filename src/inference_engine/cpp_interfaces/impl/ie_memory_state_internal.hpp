@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 
 
@@ -29,6 +30,9 @@ public:
     Blob::CPtr GetLastState() const override {
         return state;
     }
+    void SwapState(Blob::Ptr &newState) override {
+        std::swap(state, newState);
+    }
 };
 
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ie_blob.h>
+#include "cpp_interfaces/exception2status.hpp"
 
 #include <string>
 #include <memory>
@@ -22,6 +23,9 @@ public:
     virtual void Reset() = 0;
     virtual void SetState(Blob::Ptr newState) = 0;
     virtual Blob::CPtr GetLastState() const = 0;
+    virtual void SwapState(Blob::Ptr &state) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "SwapState is not implemented for the memory state";
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -28,4 +28,29 @@ bool with_cpu_x86_sse42() {
 #endif
 }
 
+bool with_cpu_x86_avx2() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX2);
+#else
+  #if defined(__AVX2__)
+      return true;
+  #else
+      return false;
+  #endif
+#endif
+}
+
+bool with_cpu_x86_avx512_core() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX512F) && cpu.has(Xbyak::util::Cpu::tAVX512BW) &&
+           cpu.has(Xbyak::util::Cpu::tAVX512DQ) && cpu.has(Xbyak::util::Cpu::tAVX512VL);
+#else
+  #if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+      return true;
+  #else
+      return false;
+  #endif
+#endif
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,447 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx2 {
+
+//------------------------------------------------------------------------------
+//
+// 3-channel (de)interleaving: the SSE 4.2 shuffles of 16 pixels applied
+// to both 128-bit lanes, so that the lanes keep 1st and 2nd 16 pixels
+//
+//------------------------------------------------------------------------------
+
+static inline
+void mm256_load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c) {
+    __m256i l0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __m256i l1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+    __m256i l2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 64));
+
+    // k-th lane of sj to be the 16 bytes at ptr + 48*k + 16*j
+    __m256i s0 = _mm256_permute2x128_si256(l0, l1, 0x30);
+    __m256i s1 = _mm256_permute2x128_si256(l0, l2, 0x21);
+    __m256i s2 = _mm256_permute2x128_si256(l1, l2, 0x30);
+
+    const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                                        0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                                        0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i a0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s0, s1, m0), s2, m1);
+    __m256i b0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s1, s2, m0), s0, m1);
+    __m256i c0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s2, s0, m0), s1, m1);
+
+    const __m256i sh_a = _mm256_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13,
+                                          0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+    const __m256i sh_b = _mm256_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14,
+                                          1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+    const __m256i sh_c = _mm256_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15,
+                                          2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+    a = _mm256_shuffle_epi8(a0, sh_a);
+    b = _mm256_shuffle_epi8(b0, sh_b);
+    c = _mm256_shuffle_epi8(c0, sh_c);
+}
+
+static inline
+void mm256_store_interleave(uint8_t* ptr, __m256i a, __m256i b, __m256i c) {
+    const __m256i sh_a = _mm256_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5,
+                                          0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5);
+    const __m256i sh_b = _mm256_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10,
+                                          5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10);
+    const __m256i sh_c = _mm256_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15,
+                                          10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15);
+    __m256i a0 = _mm256_shuffle_epi8(a, sh_a);
+    __m256i b0 = _mm256_shuffle_epi8(b, sh_b);
+    __m256i c0 = _mm256_shuffle_epi8(c, sh_c);
+
+    const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                                        0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                                        0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i v0 = _mm256_blendv_epi8(_mm256_blendv_epi8(a0, b0, m1), c0, m0);
+    __m256i v1 = _mm256_blendv_epi8(_mm256_blendv_epi8(b0, c0, m1), a0, m0);
+    __m256i v2 = _mm256_blendv_epi8(_mm256_blendv_epi8(c0, a0, m1), b0, m0);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr),      _mm256_permute2x128_si256(v0, v1, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 32), _mm256_permute2x128_si256(v2, v0, 0x30));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 64), _mm256_permute2x128_si256(v1, v2, 0x31));
+}
+
+static inline
+void mm256_load_deinterleave(const float* ptr, __m256& a, __m256& b, __m256& c) {
+    __m256 l0 = _mm256_loadu_ps(ptr);
+    __m256 l1 = _mm256_loadu_ps(ptr + 8);
+    __m256 l2 = _mm256_loadu_ps(ptr + 16);
+
+    // k-th lane of tj to be the 4 floats at ptr + 12*k + 4*j
+    __m256 t0 = _mm256_permute2f128_ps(l0, l1, 0x30);
+    __m256 t1 = _mm256_permute2f128_ps(l0, l2, 0x21);
+    __m256 t2 = _mm256_permute2f128_ps(l1, l2, 0x30);
+
+    __m256 at12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm256_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m256 bt01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m256 bt12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm256_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m256 ct01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm256_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+static inline
+void mm256_store_interleave(float* ptr, __m256 a, __m256 b, __m256 c) {
+    __m256 u0 = _mm256_shuffle_ps(a , b , _MM_SHUFFLE(0, 0, 0, 0));
+    __m256 u1 = _mm256_shuffle_ps(c , a , _MM_SHUFFLE(1, 1, 0, 0));
+    __m256 v0 = _mm256_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u2 = _mm256_shuffle_ps(b , c , _MM_SHUFFLE(1, 1, 1, 1));
+    __m256 u3 = _mm256_shuffle_ps(a , b , _MM_SHUFFLE(2, 2, 2, 2));
+    __m256 v1 = _mm256_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u4 = _mm256_shuffle_ps(c , a , _MM_SHUFFLE(3, 3, 2, 2));
+    __m256 u5 = _mm256_shuffle_ps(b , c , _MM_SHUFFLE(3, 3, 3, 3));
+    __m256 v2 = _mm256_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    _mm256_storeu_ps(ptr,      _mm256_permute2f128_ps(v0, v1, 0x20));
+    _mm256_storeu_ps(ptr + 8,  _mm256_permute2f128_ps(v2, v0, 0x30));
+    _mm256_storeu_ps(ptr + 16, _mm256_permute2f128_ps(v1, v2, 0x31));
+}
+
+// saturate 16 x int16 to 16 x uint8, keeping the order
+static inline __m128i mm256_pack_u8(__m256i a) {
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(a, a), 0xD8));
+}
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 8U)
+// Same arithmetic as the SSE 4.2 version, row by row: 16 pixels per iteration,
+// the last iteration overlaps the previous one if the width is not multiple of 16
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    GAPI_DbgAssert(inSz.width >= 16 && outSz.width >= 16);
+
+    for (int l = 0; l < lpi; l++) {
+        if (xRatioEq1 && yRatioEq1) {
+            memcpy(dst[l], src0[l], outSz.width);
+            continue;
+        }
+
+        const uint8_t *src = src0[l];
+
+        // vertical pass, straight to dst if width is not changed
+        if (!yRatioEq1) {
+            uint8_t *vdst = xRatioEq1 ? dst[l] : tmp;
+            __m256i b0 = _mm256_set1_epi16(beta[l]);
+
+            for (int w = 0; w < inSz.width; w += 16) {
+                w = std::min(w, inSz.width - 16);
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[l][w])));
+                __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src1[l][w])));
+                __m256i t = _mm256_add_epi16(_mm256_mulhrs_epi16(_mm256_sub_epi16(s0, s1), b0), s1);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&vdst[w]), mm256_pack_u8(t));
+            }
+
+            if (xRatioEq1)
+                continue;
+
+            src = tmp;
+        }
+
+        // horizontal pass
+        const __m256i lowBytes = _mm256_set1_epi16(0xFF);
+        for (int x = 0; x < outSz.width; x += 16) {
+            x = std::min(x, outSz.width - 16);
+            __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&alpha[x]));
+
+            // pairs of pixels src[sx] and src[sx + 1] as 16-bit words
+            const short *sx = &mapsx[x];
+            __m256i t = _mm256_setr_epi16(
+                *reinterpret_cast<const short*>(&src[sx[0]]),  *reinterpret_cast<const short*>(&src[sx[1]]),
+                *reinterpret_cast<const short*>(&src[sx[2]]),  *reinterpret_cast<const short*>(&src[sx[3]]),
+                *reinterpret_cast<const short*>(&src[sx[4]]),  *reinterpret_cast<const short*>(&src[sx[5]]),
+                *reinterpret_cast<const short*>(&src[sx[6]]),  *reinterpret_cast<const short*>(&src[sx[7]]),
+                *reinterpret_cast<const short*>(&src[sx[8]]),  *reinterpret_cast<const short*>(&src[sx[9]]),
+                *reinterpret_cast<const short*>(&src[sx[10]]), *reinterpret_cast<const short*>(&src[sx[11]]),
+                *reinterpret_cast<const short*>(&src[sx[12]]), *reinterpret_cast<const short*>(&src[sx[13]]),
+                *reinterpret_cast<const short*>(&src[sx[14]]), *reinterpret_cast<const short*>(&src[sx[15]]));
+
+            __m256i t0 = _mm256_and_si256(t, lowBytes);
+            __m256i t1 = _mm256_srli_epi16(t, 8);
+            __m256i d = _mm256_add_epi16(_mm256_mulhrs_epi16(_mm256_sub_epi16(t0, t1), a0), t1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[l][x]), mm256_pack_u8(d));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 32) {
+        for (; l < length; l += 32) {
+            l = std::min(l, length - 32);
+            __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+            __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+            __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in2[l]));
+            mm256_store_interleave(&out[3*l], r0, r1, r2);
+        }
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    if (length >= 8) {
+        for (; l < length; l += 8) {
+            l = std::min(l, length - 8);
+            __m256 r0 = _mm256_loadu_ps(&in0[l]);
+            __m256 r1 = _mm256_loadu_ps(&in1[l]);
+            __m256 r2 = _mm256_loadu_ps(&in2[l]);
+            mm256_store_interleave(&out[3*l], r0, r1, r2);
+        }
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 32) {
+        for (; l < length; l += 32) {
+            l = std::min(l, length - 32);
+            __m256i r0, r1, r2;
+            mm256_load_deinterleave(&in[3*l], r0, r1, r2);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), r0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), r1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out2[l]), r2);
+        }
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    int l = 0;
+
+    if (length >= 8) {
+        for (; l < length; l += 8) {
+            l = std::min(l, length - 8);
+            __m256 r0, r1, r2;
+            mm256_load_deinterleave(&in[3*l], r0, r1, r2);
+            _mm256_storeu_ps(&out0[l], r0);
+            _mm256_storeu_ps(&out1[l], r1);
+            _mm256_storeu_ps(&out2[l], r2);
+        }
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static const int ITUR_BT_601_CY = 1220542;
+static const int ITUR_BT_601_CUB = 2116026;
+static const int ITUR_BT_601_CUG = -409993;
+static const int ITUR_BT_601_CVG = -852492;
+static const int ITUR_BT_601_CVR = 1673527;
+static const int ITUR_BT_601_SHIFT = 20;
+
+static inline uchar saturateU8(int v) {
+    return static_cast<uchar>(std::min(std::max(v, 0), 255));
+}
+
+static inline void uvToRGBuv(const uchar u, const uchar v, int& ruv, int& guv, int& buv) {
+    int uu, vv;
+    uu = static_cast<int>(u) - 128;
+    vv = static_cast<int>(v) - 128;
+
+    ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+    guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+    buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+}
+
+static inline void yRGBuvToRGB(const uchar vy, const int ruv, const int guv, const int buv,
+                                uchar& r, uchar& g, uchar& b) {
+    int yy = static_cast<int>(vy);
+    int y = std::max(0, yy - 16) * ITUR_BT_601_CY;
+    r = saturateU8((y + ruv) >> ITUR_BT_601_SHIFT);
+    g = saturateU8((y + guv) >> ITUR_BT_601_SHIFT);
+    b = saturateU8((y + buv) >> ITUR_BT_601_SHIFT);
+}
+
+// 16 x int16 of y (already minus 16) plus the chroma term, as 16 x int16 in [0, 255]
+static inline __m256i yCUVtoChannel(__m256i y, const __m256i (&cuv)[2]) {
+    const __m256i vcy = _mm256_set1_epi32(ITUR_BT_601_CY);
+    __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(y));
+    __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(y, 1));
+    lo = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(lo, vcy), cuv[0]), ITUR_BT_601_SHIFT);
+    hi = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(hi, vcy), cuv[1]), ITUR_BT_601_SHIFT);
+    __m256i c = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+    return _mm256_min_epi16(_mm256_max_epi16(c, _mm256_setzero_si256()), _mm256_set1_epi16(255));
+}
+
+// 32 pixels of a channel: even and odd pixels share the chroma
+static inline __m256i yCUVtoChannel(__m256i yEven, __m256i yOdd, const __m256i (&cuv)[2]) {
+    return _mm256_or_si256(yCUVtoChannel(yEven, cuv), _mm256_slli_epi16(yCUVtoChannel(yOdd, cuv), 8));
+}
+
+void calculate_nv12_to_rgb(const  uchar **srcY,
+                           const  uchar *srcUV,
+                                  uchar **dstRGBx,
+                                    int width) {
+    int i = 0;
+
+    const __m256i lowBytes = _mm256_set1_epi16(0xFF);
+    const __m256i v128 = _mm256_set1_epi16(128);
+    const __m256i v16  = _mm256_set1_epi16(16);
+    const __m256i vshift = _mm256_set1_epi32(1 << (ITUR_BT_601_SHIFT - 1));
+    const __m256i vr = _mm256_set1_epi32(ITUR_BT_601_CVR);
+    const __m256i vg = _mm256_set1_epi32(ITUR_BT_601_CVG);
+    const __m256i ug = _mm256_set1_epi32(ITUR_BT_601_CUG);
+    const __m256i ub = _mm256_set1_epi32(ITUR_BT_601_CUB);
+
+    for ( ; i <= width - 32; i += 32) {
+        // 16 pairs of u, v
+        __m256i uv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcUV + i));
+        __m256i uu = _mm256_sub_epi16(_mm256_and_si256(uv, lowBytes), v128);
+        __m256i vv = _mm256_sub_epi16(_mm256_srli_epi16(uv, 8), v128);
+
+        __m256i ruv[2], guv[2], buv[2];
+        for (int k = 0; k < 2; k++) {
+            __m256i u32 = _mm256_cvtepi16_epi32(k == 0 ? _mm256_castsi256_si128(uu) : _mm256_extracti128_si256(uu, 1));
+            __m256i v32 = _mm256_cvtepi16_epi32(k == 0 ? _mm256_castsi256_si128(vv) : _mm256_extracti128_si256(vv, 1));
+            ruv[k] = _mm256_add_epi32(vshift, _mm256_mullo_epi32(vr, v32));
+            guv[k] = _mm256_add_epi32(_mm256_add_epi32(vshift, _mm256_mullo_epi32(vg, v32)), _mm256_mullo_epi32(ug, u32));
+            buv[k] = _mm256_add_epi32(vshift, _mm256_mullo_epi32(ub, u32));
+        }
+
+        for (int y = 0; y < 2; y++) {
+            __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcY[y] + i));
+            __m256i yEven = _mm256_subs_epu16(_mm256_and_si256(vy, lowBytes), v16);
+            __m256i yOdd  = _mm256_subs_epu16(_mm256_srli_epi16(vy, 8), v16);
+
+            __m256i r = yCUVtoChannel(yEven, yOdd, ruv);
+            __m256i g = yCUVtoChannel(yEven, yOdd, guv);
+            __m256i b = yCUVtoChannel(yEven, yOdd, buv);
+
+            mm256_store_interleave(dstRGBx[y] + 3*i, r, g, b);
+        }
+    }
+
+    for (; i < width; i += 2) {
+        uchar u = srcUV[i];
+        uchar v = srcUV[i + 1];
+        int ruv, guv, buv;
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar vy = srcY[y][i + x];
+                uchar r, g, b;
+                yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+                dstRGBx[y][3*(i + x)]     = r;
+                dstRGBx[y][3*(i + x) + 1] = g;
+                dstRGBx[y][3*(i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void copyRow_8U(const uint8_t in[],
+                 uint8_t out[],
+                 int length) {
+    int l = 0;
+
+    if (length >= 32) {
+        for (; l < length; l += 32) {
+            l = std::min(l, length - 32);
+            __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[l]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[l]), r);
+        }
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+void copyRow_32F(const float in[],
+                 float out[],
+                 int length) {
+    int l = 0;
+
+    if (length >= 8) {
+        for (; l < length; l += 8) {
+            l = std::min(l, length - 8);
+            _mm256_storeu_ps(&out[l], _mm256_loadu_ps(&in[l]));
+        }
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+}  // namespace avx2
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
@@ -0,0 +1,459 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512 F, BW, DQ, VL
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx512 {
+
+//------------------------------------------------------------------------------
+//
+// 3-channel (de)interleaving: the SSE 4.2 shuffles of 16 pixels applied
+// to each of four 128-bit lanes, so that k-th lane keeps k-th 16 pixels
+//
+//------------------------------------------------------------------------------
+
+// 12 chunks of 128 bits in l0, l1, l2 to lanes of s0, s1, s2: k-th lane of sj is (3*k + j)-th chunk
+static inline void mm512_chunks_deinterleave(__m512i l0, __m512i l1, __m512i l2,
+                                             __m512i& s0, __m512i& s1, __m512i& s2) {
+    s0 = _mm512_permutex2var_epi64(l0, _mm512_setr_epi64(0, 1, 6, 7, 12, 13, 0, 0), l1);
+    s0 = _mm512_mask_permutexvar_epi64(s0, 0xC0, _mm512_setr_epi64(0, 0, 0, 0, 0, 0, 2, 3), l2);
+    s1 = _mm512_permutex2var_epi64(l0, _mm512_setr_epi64(2, 3, 8, 9, 14, 15, 0, 0), l1);
+    s1 = _mm512_mask_permutexvar_epi64(s1, 0xC0, _mm512_setr_epi64(0, 0, 0, 0, 0, 0, 4, 5), l2);
+    s2 = _mm512_permutex2var_epi64(l0, _mm512_setr_epi64(4, 5, 10, 11, 0, 0, 0, 0), l1);
+    s2 = _mm512_mask_permutexvar_epi64(s2, 0xF0, _mm512_setr_epi64(0, 0, 0, 0, 0, 1, 6, 7), l2);
+}
+
+// the inverse of mm512_chunks_deinterleave
+static inline void mm512_chunks_interleave(__m512i v0, __m512i v1, __m512i v2,
+                                           __m512i& o0, __m512i& o1, __m512i& o2) {
+    o0 = _mm512_permutex2var_epi64(v0, _mm512_setr_epi64(0, 1, 8, 9, 0, 0, 2, 3), v1);
+    o0 = _mm512_mask_permutexvar_epi64(o0, 0x30, _mm512_setr_epi64(0, 0, 0, 0, 0, 1, 0, 0), v2);
+    o1 = _mm512_permutex2var_epi64(v1, _mm512_setr_epi64(2, 3, 10, 11, 0, 0, 4, 5), v2);
+    o1 = _mm512_mask_permutexvar_epi64(o1, 0x30, _mm512_setr_epi64(0, 0, 0, 0, 4, 5, 0, 0), v0);
+    o2 = _mm512_permutex2var_epi64(v2, _mm512_setr_epi64(4, 5, 14, 15, 0, 0, 6, 7), v0);
+    o2 = _mm512_mask_permutexvar_epi64(o2, 0x30, _mm512_setr_epi64(0, 0, 0, 0, 6, 7, 0, 0), v1);
+}
+
+// byte masks of the SSE 4.2 version, for each lane
+static const __mmask64 mask_m0 = 0x4924492449244924;  // bytes 2, 5, 8, 11, 14
+static const __mmask64 mask_m1 = 0x2492249224922492;  // bytes 1, 4, 7, 10, 13
+
+static inline
+void mm512_load_deinterleave(const uint8_t* ptr, __m512i& a, __m512i& b, __m512i& c) {
+    __m512i s0, s1, s2;
+    mm512_chunks_deinterleave(_mm512_loadu_si512(ptr), _mm512_loadu_si512(ptr + 64), _mm512_loadu_si512(ptr + 128),
+                              s0, s1, s2);
+
+    __m512i a0 = _mm512_mask_blend_epi8(mask_m1, _mm512_mask_blend_epi8(mask_m0, s0, s1), s2);
+    __m512i b0 = _mm512_mask_blend_epi8(mask_m1, _mm512_mask_blend_epi8(mask_m0, s1, s2), s0);
+    __m512i c0 = _mm512_mask_blend_epi8(mask_m1, _mm512_mask_blend_epi8(mask_m0, s2, s0), s1);
+
+    const __m512i sh_a = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13));
+    const __m512i sh_b = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14));
+    const __m512i sh_c = _mm512_broadcast_i32x4(_mm_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15));
+    a = _mm512_shuffle_epi8(a0, sh_a);
+    b = _mm512_shuffle_epi8(b0, sh_b);
+    c = _mm512_shuffle_epi8(c0, sh_c);
+}
+
+static inline
+void mm512_store_interleave(uint8_t* ptr, __m512i a, __m512i b, __m512i c) {
+    const __m512i sh_a = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5));
+    const __m512i sh_b = _mm512_broadcast_i32x4(_mm_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10));
+    const __m512i sh_c = _mm512_broadcast_i32x4(_mm_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15));
+    __m512i a0 = _mm512_shuffle_epi8(a, sh_a);
+    __m512i b0 = _mm512_shuffle_epi8(b, sh_b);
+    __m512i c0 = _mm512_shuffle_epi8(c, sh_c);
+
+    __m512i v0 = _mm512_mask_blend_epi8(mask_m0, _mm512_mask_blend_epi8(mask_m1, a0, b0), c0);
+    __m512i v1 = _mm512_mask_blend_epi8(mask_m0, _mm512_mask_blend_epi8(mask_m1, b0, c0), a0);
+    __m512i v2 = _mm512_mask_blend_epi8(mask_m0, _mm512_mask_blend_epi8(mask_m1, c0, a0), b0);
+
+    __m512i o0, o1, o2;
+    mm512_chunks_interleave(v0, v1, v2, o0, o1, o2);
+    _mm512_storeu_si512(ptr,       o0);
+    _mm512_storeu_si512(ptr + 64,  o1);
+    _mm512_storeu_si512(ptr + 128, o2);
+}
+
+static inline
+void mm512_load_deinterleave(const float* ptr, __m512& a, __m512& b, __m512& c) {
+    __m512i s0, s1, s2;
+    mm512_chunks_deinterleave(_mm512_castps_si512(_mm512_loadu_ps(ptr)),
+                              _mm512_castps_si512(_mm512_loadu_ps(ptr + 16)),
+                              _mm512_castps_si512(_mm512_loadu_ps(ptr + 32)),
+                              s0, s1, s2);
+    __m512 t0 = _mm512_castsi512_ps(s0);
+    __m512 t1 = _mm512_castsi512_ps(s1);
+    __m512 t2 = _mm512_castsi512_ps(s2);
+
+    __m512 at12 = _mm512_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm512_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m512 bt01 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m512 bt12 = _mm512_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm512_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m512 ct01 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm512_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+static inline
+void mm512_store_interleave(float* ptr, __m512 a, __m512 b, __m512 c) {
+    __m512 u0 = _mm512_shuffle_ps(a , b , _MM_SHUFFLE(0, 0, 0, 0));
+    __m512 u1 = _mm512_shuffle_ps(c , a , _MM_SHUFFLE(1, 1, 0, 0));
+    __m512 v0 = _mm512_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m512 u2 = _mm512_shuffle_ps(b , c , _MM_SHUFFLE(1, 1, 1, 1));
+    __m512 u3 = _mm512_shuffle_ps(a , b , _MM_SHUFFLE(2, 2, 2, 2));
+    __m512 v1 = _mm512_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m512 u4 = _mm512_shuffle_ps(c , a , _MM_SHUFFLE(3, 3, 2, 2));
+    __m512 u5 = _mm512_shuffle_ps(b , c , _MM_SHUFFLE(3, 3, 3, 3));
+    __m512 v2 = _mm512_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m512i o0, o1, o2;
+    mm512_chunks_interleave(_mm512_castps_si512(v0), _mm512_castps_si512(v1), _mm512_castps_si512(v2), o0, o1, o2);
+    _mm512_storeu_ps(ptr,      _mm512_castsi512_ps(o0));
+    _mm512_storeu_ps(ptr + 16, _mm512_castsi512_ps(o1));
+    _mm512_storeu_ps(ptr + 32, _mm512_castsi512_ps(o2));
+}
+
+// saturate 32 x int16 to 32 x uint8
+static inline __m256i mm512_pack_u8(__m512i a) {
+    return _mm512_cvtusepi16_epi8(_mm512_max_epi16(a, _mm512_setzero_si512()));
+}
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 8U)
+// Same arithmetic as the SSE 4.2 version, row by row: 32 pixels per iteration,
+// the last iteration overlaps the previous one if the width is not multiple of 32
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    GAPI_DbgAssert(inSz.width >= 32 && outSz.width >= 32);
+
+    for (int l = 0; l < lpi; l++) {
+        if (xRatioEq1 && yRatioEq1) {
+            memcpy(dst[l], src0[l], outSz.width);
+            continue;
+        }
+
+        const uint8_t *src = src0[l];
+
+        // vertical pass, straight to dst if width is not changed
+        if (!yRatioEq1) {
+            uint8_t *vdst = xRatioEq1 ? dst[l] : tmp;
+            __m512i b0 = _mm512_set1_epi16(beta[l]);
+
+            for (int w = 0; w < inSz.width; w += 32) {
+                w = std::min(w, inSz.width - 32);
+                __m512i s0 = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[l][w])));
+                __m512i s1 = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src1[l][w])));
+                __m512i t = _mm512_add_epi16(_mm512_mulhrs_epi16(_mm512_sub_epi16(s0, s1), b0), s1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&vdst[w]), mm512_pack_u8(t));
+            }
+
+            if (xRatioEq1)
+                continue;
+
+            src = tmp;
+        }
+
+        // horizontal pass
+        const __m512i lowBytes = _mm512_set1_epi16(0xFF);
+        for (int x = 0; x < outSz.width; x += 32) {
+            x = std::min(x, outSz.width - 32);
+            __m512i a0 = _mm512_loadu_si512(&alpha[x]);
+
+            // pairs of pixels src[sx] and src[sx + 1] as 16-bit words
+            __m256i t[2];
+            for (int h = 0; h < 2; h++) {
+                const short *sx = &mapsx[x + 16*h];
+                t[h] = _mm256_setr_epi16(
+                    *reinterpret_cast<const short*>(&src[sx[0]]),  *reinterpret_cast<const short*>(&src[sx[1]]),
+                    *reinterpret_cast<const short*>(&src[sx[2]]),  *reinterpret_cast<const short*>(&src[sx[3]]),
+                    *reinterpret_cast<const short*>(&src[sx[4]]),  *reinterpret_cast<const short*>(&src[sx[5]]),
+                    *reinterpret_cast<const short*>(&src[sx[6]]),  *reinterpret_cast<const short*>(&src[sx[7]]),
+                    *reinterpret_cast<const short*>(&src[sx[8]]),  *reinterpret_cast<const short*>(&src[sx[9]]),
+                    *reinterpret_cast<const short*>(&src[sx[10]]), *reinterpret_cast<const short*>(&src[sx[11]]),
+                    *reinterpret_cast<const short*>(&src[sx[12]]), *reinterpret_cast<const short*>(&src[sx[13]]),
+                    *reinterpret_cast<const short*>(&src[sx[14]]), *reinterpret_cast<const short*>(&src[sx[15]]));
+            }
+            __m512i pairs = _mm512_inserti64x4(_mm512_castsi256_si512(t[0]), t[1], 1);
+
+            __m512i t0 = _mm512_and_si512(pairs, lowBytes);
+            __m512i t1 = _mm512_srli_epi16(pairs, 8);
+            __m512i d = _mm512_add_epi16(_mm512_mulhrs_epi16(_mm512_sub_epi16(t0, t1), a0), t1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[l][x]), mm512_pack_u8(d));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 64) {
+        for (; l < length; l += 64) {
+            l = std::min(l, length - 64);
+            mm512_store_interleave(&out[3*l], _mm512_loadu_si512(&in0[l]),
+                                              _mm512_loadu_si512(&in1[l]),
+                                              _mm512_loadu_si512(&in2[l]));
+        }
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    if (length >= 16) {
+        for (; l < length; l += 16) {
+            l = std::min(l, length - 16);
+            mm512_store_interleave(&out[3*l], _mm512_loadu_ps(&in0[l]),
+                                              _mm512_loadu_ps(&in1[l]),
+                                              _mm512_loadu_ps(&in2[l]));
+        }
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 64) {
+        for (; l < length; l += 64) {
+            l = std::min(l, length - 64);
+            __m512i r0, r1, r2;
+            mm512_load_deinterleave(&in[3*l], r0, r1, r2);
+            _mm512_storeu_si512(&out0[l], r0);
+            _mm512_storeu_si512(&out1[l], r1);
+            _mm512_storeu_si512(&out2[l], r2);
+        }
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    int l = 0;
+
+    if (length >= 16) {
+        for (; l < length; l += 16) {
+            l = std::min(l, length - 16);
+            __m512 r0, r1, r2;
+            mm512_load_deinterleave(&in[3*l], r0, r1, r2);
+            _mm512_storeu_ps(&out0[l], r0);
+            _mm512_storeu_ps(&out1[l], r1);
+            _mm512_storeu_ps(&out2[l], r2);
+        }
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static const int ITUR_BT_601_CY = 1220542;
+static const int ITUR_BT_601_CUB = 2116026;
+static const int ITUR_BT_601_CUG = -409993;
+static const int ITUR_BT_601_CVG = -852492;
+static const int ITUR_BT_601_CVR = 1673527;
+static const int ITUR_BT_601_SHIFT = 20;
+
+static inline uchar saturateU8(int v) {
+    return static_cast<uchar>(std::min(std::max(v, 0), 255));
+}
+
+static inline void uvToRGBuv(const uchar u, const uchar v, int& ruv, int& guv, int& buv) {
+    int uu, vv;
+    uu = static_cast<int>(u) - 128;
+    vv = static_cast<int>(v) - 128;
+
+    ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+    guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+    buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+}
+
+static inline void yRGBuvToRGB(const uchar vy, const int ruv, const int guv, const int buv,
+                                uchar& r, uchar& g, uchar& b) {
+    int yy = static_cast<int>(vy);
+    int y = std::max(0, yy - 16) * ITUR_BT_601_CY;
+    r = saturateU8((y + ruv) >> ITUR_BT_601_SHIFT);
+    g = saturateU8((y + guv) >> ITUR_BT_601_SHIFT);
+    b = saturateU8((y + buv) >> ITUR_BT_601_SHIFT);
+}
+
+// 32 x int16 of y (already minus 16) plus the chroma term, as 32 x int16 in [0, 255]
+static inline __m512i yCUVtoChannel(__m512i y, const __m512i (&cuv)[2]) {
+    const __m512i vcy = _mm512_set1_epi32(ITUR_BT_601_CY);
+    __m512i lo = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(y));
+    __m512i hi = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(y, 1));
+    lo = _mm512_srai_epi32(_mm512_add_epi32(_mm512_mullo_epi32(lo, vcy), cuv[0]), ITUR_BT_601_SHIFT);
+    hi = _mm512_srai_epi32(_mm512_add_epi32(_mm512_mullo_epi32(hi, vcy), cuv[1]), ITUR_BT_601_SHIFT);
+    __m512i c = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtsepi32_epi16(lo)), _mm512_cvtsepi32_epi16(hi), 1);
+    return _mm512_min_epi16(_mm512_max_epi16(c, _mm512_setzero_si512()), _mm512_set1_epi16(255));
+}
+
+// 64 pixels of a channel: even and odd pixels share the chroma
+static inline __m512i yCUVtoChannel(__m512i yEven, __m512i yOdd, const __m512i (&cuv)[2]) {
+    return _mm512_or_si512(yCUVtoChannel(yEven, cuv), _mm512_slli_epi16(yCUVtoChannel(yOdd, cuv), 8));
+}
+
+void calculate_nv12_to_rgb(const  uchar **srcY,
+                           const  uchar *srcUV,
+                                  uchar **dstRGBx,
+                                    int width) {
+    int i = 0;
+
+    const __m512i lowBytes = _mm512_set1_epi16(0xFF);
+    const __m512i v128 = _mm512_set1_epi16(128);
+    const __m512i v16  = _mm512_set1_epi16(16);
+    const __m512i vshift = _mm512_set1_epi32(1 << (ITUR_BT_601_SHIFT - 1));
+    const __m512i vr = _mm512_set1_epi32(ITUR_BT_601_CVR);
+    const __m512i vg = _mm512_set1_epi32(ITUR_BT_601_CVG);
+    const __m512i ug = _mm512_set1_epi32(ITUR_BT_601_CUG);
+    const __m512i ub = _mm512_set1_epi32(ITUR_BT_601_CUB);
+
+    for ( ; i <= width - 64; i += 64) {
+        // 32 pairs of u, v
+        __m512i uv = _mm512_loadu_si512(srcUV + i);
+        __m512i uu = _mm512_sub_epi16(_mm512_and_si512(uv, lowBytes), v128);
+        __m512i vv = _mm512_sub_epi16(_mm512_srli_epi16(uv, 8), v128);
+
+        __m512i ruv[2], guv[2], buv[2];
+        for (int k = 0; k < 2; k++) {
+            __m512i u32 = _mm512_cvtepi16_epi32(k == 0 ? _mm512_castsi512_si256(uu) : _mm512_extracti64x4_epi64(uu, 1));
+            __m512i v32 = _mm512_cvtepi16_epi32(k == 0 ? _mm512_castsi512_si256(vv) : _mm512_extracti64x4_epi64(vv, 1));
+            ruv[k] = _mm512_add_epi32(vshift, _mm512_mullo_epi32(vr, v32));
+            guv[k] = _mm512_add_epi32(_mm512_add_epi32(vshift, _mm512_mullo_epi32(vg, v32)), _mm512_mullo_epi32(ug, u32));
+            buv[k] = _mm512_add_epi32(vshift, _mm512_mullo_epi32(ub, u32));
+        }
+
+        for (int y = 0; y < 2; y++) {
+            __m512i vy = _mm512_loadu_si512(srcY[y] + i);
+            __m512i yEven = _mm512_subs_epu16(_mm512_and_si512(vy, lowBytes), v16);
+            __m512i yOdd  = _mm512_subs_epu16(_mm512_srli_epi16(vy, 8), v16);
+
+            __m512i r = yCUVtoChannel(yEven, yOdd, ruv);
+            __m512i g = yCUVtoChannel(yEven, yOdd, guv);
+            __m512i b = yCUVtoChannel(yEven, yOdd, buv);
+
+            mm512_store_interleave(dstRGBx[y] + 3*i, r, g, b);
+        }
+    }
+
+    for (; i < width; i += 2) {
+        uchar u = srcUV[i];
+        uchar v = srcUV[i + 1];
+        int ruv, guv, buv;
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar vy = srcY[y][i + x];
+                uchar r, g, b;
+                yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+                dstRGBx[y][3*(i + x)]     = r;
+                dstRGBx[y][3*(i + x) + 1] = g;
+                dstRGBx[y][3*(i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void copyRow_8U(const uint8_t in[],
+                 uint8_t out[],
+                 int length) {
+    int l = 0;
+
+    if (length >= 64) {
+        for (; l < length; l += 64) {
+            l = std::min(l, length - 64);
+            _mm512_storeu_si512(&out[l], _mm512_loadu_si512(&in[l]));
+        }
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+void copyRow_32F(const float in[],
+                 float out[],
+                 int length) {
+    int l = 0;
+
+    if (length >= 16) {
+        for (; l < length; l += 16) {
+            l = std::min(l, length - 16);
+            _mm512_storeu_ps(&out[l], _mm512_loadu_ps(&in[l]));
+        }
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
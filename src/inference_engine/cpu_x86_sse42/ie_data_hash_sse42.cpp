@@ -0,0 +1,41 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_data_hash_sse42.hpp"
+
+#include <nmmintrin.h>  // SSE 4.2
+
+#include <cstring>
+
+namespace InferenceEngine {
+
+uint64_t data_hash_block_sse42(const uint8_t *data, size_t size) {
+    uint64_t crc0 = 0xFFFFFFFFu;
+    uint64_t crc1 = 0xFFFFFFFFu;
+
+    // two independent chains hide the latency of crc32 instruction
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint64_t w0, w1;
+        std::memcpy(&w0, data + i, sizeof(w0));
+        std::memcpy(&w1, data + i + 8, sizeof(w1));
+#if defined(__x86_64__) || defined(_M_X64)
+        crc0 = _mm_crc32_u64(crc0, w0);
+        crc1 = _mm_crc32_u64(crc1, w1);
+#else
+        crc0 = _mm_crc32_u32(_mm_crc32_u32(static_cast<uint32_t>(crc0), static_cast<uint32_t>(w0)),
+                             static_cast<uint32_t>(w0 >> 32));
+        crc1 = _mm_crc32_u32(_mm_crc32_u32(static_cast<uint32_t>(crc1), static_cast<uint32_t>(w1)),
+                             static_cast<uint32_t>(w1 >> 32));
+#endif
+    }
+    uint32_t tail = static_cast<uint32_t>(crc0);
+    for (; i < size; i++) {
+        tail = _mm_crc32_u8(tail, data[i]);
+    }
+
+    return (static_cast<uint64_t>(~tail) << 32) | static_cast<uint32_t>(~crc1);
+}
+
+}  // namespace InferenceEngine
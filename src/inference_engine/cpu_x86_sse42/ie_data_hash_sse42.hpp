@@ -0,0 +1,24 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// CRC32C of the data block with SSE 4.2 instructions (w/o threads)
+//
+//------------------------------------------------------------------------
+
+/**
+ * Computes two CRC32C sums: the first over even 8-byte words and the tail, the second over odd 8-byte words
+ * Result is bit exact with data_hash_block_ref
+ */
+uint64_t data_hash_block_sse42(const uint8_t *data, size_t size);
+
+}  // namespace InferenceEngine
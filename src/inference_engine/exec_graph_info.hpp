@@ -39,4 +39,9 @@ static const char OUTPUT_LAYOUTS[] = "outputLayouts";
  * @brief A general key for CNNLayer::params map. Used to get an execution order of primitive.
  */
 static const char EXECUTION_ORDER[] = "execOrder";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get whether the primitive works in place on the memory
+ *        of its inputs or outputs ("true") or writes its outputs to separate memory ("false").
+ */
+static const char IN_PLACE[] = "inPlace";
 }  // namespace ExecGraphInfoSerialization
@@ -13,7 +13,30 @@
 namespace InferenceEngine {
 
 Blob::Ptr make_shared_blob(const Blob::Ptr &inputBlob, const ROI &roi) {
-    // reject compound blobs
+    // the ROI of an NV12 blob is the pair of ROIs of its planes, the UV plane is subsampled by 2
+    if (inputBlob->is<NV12Blob>()) {
+        if (roi.posX % 2 || roi.posY % 2 || roi.sizeX % 2 || roi.sizeY % 2) {
+            THROW_IE_EXCEPTION << "ROI of NV12 blob must have even coordinates and sizes";
+        }
+        auto nv12Blob = inputBlob->as<NV12Blob>();
+        const ROI uvRoi = {roi.id, roi.posX / 2, roi.posY / 2, roi.sizeX / 2, roi.sizeY / 2};
+        return make_shared_blob<NV12Blob>(make_shared_blob(nv12Blob->y(), roi),
+                                          make_shared_blob(nv12Blob->uv(), uvRoi));
+    }
+
+    // the same for I420 blob with U and V planes subsampled by 2
+    if (inputBlob->is<I420Blob>()) {
+        if (roi.posX % 2 || roi.posY % 2 || roi.sizeX % 2 || roi.sizeY % 2) {
+            THROW_IE_EXCEPTION << "ROI of I420 blob must have even coordinates and sizes";
+        }
+        auto i420Blob = inputBlob->as<I420Blob>();
+        const ROI uvRoi = {roi.id, roi.posX / 2, roi.posY / 2, roi.sizeX / 2, roi.sizeY / 2};
+        return make_shared_blob<I420Blob>(make_shared_blob(i420Blob->y(), roi),
+                                          make_shared_blob(i420Blob->u(), uvRoi),
+                                          make_shared_blob(i420Blob->v(), uvRoi));
+    }
+
+    // reject other compound blobs
     if (inputBlob->is<CompoundBlob>()) {
         THROW_IE_EXCEPTION << "Compound blobs do not support ROI";
     }
@@ -61,4 +84,13 @@ Blob::Ptr make_shared_blob(const Blob::Ptr &inputBlob, const ROI &roi) {
     return make_blob_with_precision(tDesc, inputBlob->buffer());
 }
 
+BatchedBlob::Ptr make_shared_blob(const Blob::Ptr &inputBlob, const std::vector<ROI> &rois) {
+    std::vector<Blob::Ptr> blobs;
+    blobs.reserve(rois.size());
+    for (const auto &roi : rois) {
+        blobs.push_back(make_shared_blob(inputBlob, roi));
+    }
+    return make_shared_blob<BatchedBlob>(std::move(blobs));
+}
+
 }  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 #include "parsers.h"
 #include <ie_cnn_net_reader_impl.h>
 #include "ie_format_parser.h"
+#include "mmap_allocator.hpp"
 #include <file_utils.h>
 #include <ie_plugin.hpp>
 #include "xml_parse_utils.h"
@@ -73,9 +74,17 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
     auto ulFileSize = static_cast<size_t>(fileSize);
 
     try {
-        TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C)));
+        // Layers' blobs are proxies to the weights blob, so mapping the file avoids a private copy of the weights:
+        // pages are loaded on demand and stay shared in the page cache
+        TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C),
+                                                          details::CreateMmapAllocator(filepath)));
         weightsPtr->allocate();
-        FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
+        if (weightsPtr->buffer() == nullptr) {
+            // mapping is not possible (e.g. empty file), read it into the memory
+            weightsPtr.reset(new TBlob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C)));
+            weightsPtr->allocate();
+            FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
+        }
         return SetWeights(weightsPtr, resp);
     } catch (const InferenceEngineException& ex) {
         return DescriptionBuffer(resp) << ex.what();
@@ -8,6 +8,7 @@
  */
 
 #include "ie_compound_blob.h"
+#include "debug.h"
 
 #include <memory>
 #include <utility>
@@ -92,6 +93,128 @@ void verifyNV12BlobInput(const Blob::Ptr& y, const Blob::Ptr& uv) {
             << yDims[3] << "(Y plane) and " << uvDims[3] << "(UV plane)";
     }
 }
+
+void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr& v) {
+    // Y, U and V must be valid pointers
+    if (y == nullptr || u == nullptr || v == nullptr) {
+        THROW_IE_EXCEPTION << "Y, U and V planes must be valid Blob objects";
+    }
+
+    // Y, U and V must be MemoryBlob objects
+    if (!y->is<MemoryBlob>() || !u->is<MemoryBlob>() || !v->is<MemoryBlob>()) {
+        THROW_IE_EXCEPTION << "Y, U and V planes must be MemoryBlob objects";
+    }
+
+    // check tensor descriptor parameters
+    const auto& yDesc = y->getTensorDesc();
+    const auto& uDesc = u->getTensorDesc();
+    const auto& vDesc = v->getTensorDesc();
+
+    // check precision
+    if (yDesc.getPrecision() != Precision::U8 || uDesc.getPrecision() != Precision::U8 ||
+        vDesc.getPrecision() != Precision::U8) {
+        THROW_IE_EXCEPTION << "Y, U and V planes precision must be U8, actual: " << yDesc.getPrecision()
+                           << "(Y plane), " << uDesc.getPrecision() << "(U plane) and "
+                           << vDesc.getPrecision() << "(V plane)";
+    }
+
+    // check layout
+    if (yDesc.getLayout() != Layout::NHWC || uDesc.getLayout() != Layout::NHWC ||
+        vDesc.getLayout() != Layout::NHWC) {
+        THROW_IE_EXCEPTION << "Y, U and V planes layout must be NHWC, actual: " << yDesc.getLayout()
+                           << "(Y plane), " << uDesc.getLayout() << "(U plane) and "
+                           << vDesc.getLayout() << "(V plane)";
+    }
+
+    // check dimensions
+    const auto& yDims = yDesc.getDims();
+    const auto& uDims = uDesc.getDims();
+    const auto& vDims = vDesc.getDims();
+    if (yDims.size() != 4 || uDims.size() != 4 || vDims.size() != 4) {
+        THROW_IE_EXCEPTION << "Y, U and V planes dimension sizes must be 4, actual: " << yDims.size()
+                           << "(Y plane), " << uDims.size() << "(U plane) and " << vDims.size() << "(V plane)";
+    }
+
+    // U and V planes have the same dimensions
+    if (uDims != vDims) {
+        THROW_IE_EXCEPTION << "U and V planes must have the same dimensions, actual: "
+                           << details::dumpVec(uDims) << "(U plane) and " << details::dumpVec(vDims) << "(V plane)";
+    }
+
+    // check batch size
+    if (yDims[0] != uDims[0]) {
+        THROW_IE_EXCEPTION << "Y, U and V planes must have the same batch size";
+    }
+
+    // check number of channels
+    if (yDims[1] != 1 || uDims[1] != 1) {
+        THROW_IE_EXCEPTION << "Y, U and V planes must have 1 channel, actual: " << yDims[1]
+                           << "(Y plane) and " << uDims[1] << "(U and V planes)";
+    }
+
+    // check height
+    if (yDims[2] != 2 * uDims[2]) {
+        THROW_IE_EXCEPTION
+            << "The height of the Y plane must be equal to (2 * the height of the U and V planes), actual: "
+            << yDims[2] << "(Y plane) and " << uDims[2] << "(U and V planes)";
+    }
+
+    // check width
+    if (yDims[3] != 2 * uDims[3]) {
+        THROW_IE_EXCEPTION
+            << "The width of the Y plane must be equal to (2 * the width of the U and V planes), actual: "
+            << yDims[3] << "(Y plane) and " << uDims[3] << "(U and V planes)";
+    }
+}
+
+TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from an empty vector of blobs";
+    }
+
+    // Cannot create a batched blob from nullptr Blob objects
+    if (std::any_of(blobs.begin(), blobs.end(),
+                    [] (const Blob::Ptr& blob) { return blob == nullptr; })) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from nullptr Blob objects";
+    }
+
+    // images are either all NV12 blobs, all I420 blobs or all memory blobs, other compound blobs
+    // are not allowed
+    const bool nv12 = blobs[0]->is<NV12Blob>();
+    const bool i420 = blobs[0]->is<I420Blob>();
+    for (const auto& blob : blobs) {
+        if (nv12 != blob->is<NV12Blob>() || i420 != blob->is<I420Blob>()) {
+            THROW_IE_EXCEPTION << "Cannot create a batched blob from images of different color formats";
+        }
+        if (!nv12 && !i420 && !blob->is<MemoryBlob>()) {
+            THROW_IE_EXCEPTION << "Batched blob images must be MemoryBlob, NV12Blob or I420Blob objects";
+        }
+    }
+
+    // every image is one item of the batch
+    for (const auto& blob : blobs) {
+        const auto& dims = nv12 ? blob->as<NV12Blob>()->y()->getTensorDesc().getDims()
+                         : i420 ? blob->as<I420Blob>()->y()->getTensorDesc().getDims()
+                                : blob->getTensorDesc().getDims();
+        if (dims.size() != 4 || dims[0] != 1) {
+            THROW_IE_EXCEPTION << "Batched blob images must be 4D blobs of the batch size 1, actual dims: "
+                               << details::dumpVec(dims);
+        }
+    }
+
+    if (nv12 || i420) {
+        return TensorDesc(Precision::U8, {}, Layout::NCHW);
+    }
+
+    const auto& desc = blobs[0]->getTensorDesc();
+    for (const auto& blob : blobs) {
+        if (blob->getTensorDesc().getPrecision() != desc.getPrecision() ||
+            blob->getTensorDesc().getLayout() != desc.getLayout()) {
+            THROW_IE_EXCEPTION << "Batched blob images must have the same precision and layout";
+        }
+    }
+    return TensorDesc(desc.getPrecision(), {}, desc.getLayout());
+}
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob() : Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -218,4 +341,68 @@ const Blob::Ptr& NV12Blob::uv() const noexcept {
     return _blobs[1];
 }
 
+I420Blob::I420Blob(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr& v) {
+    // verify data is correct
+    verifyI420BlobInput(y, u, v);
+    // set blobs
+    _blobs.emplace_back(y);
+    _blobs.emplace_back(u);
+    _blobs.emplace_back(v);
+    tensorDesc = TensorDesc(Precision::U8, {}, Layout::NCHW);
+}
+
+I420Blob::I420Blob(Blob::Ptr&& y, Blob::Ptr&& u, Blob::Ptr&& v) {
+    // verify data is correct
+    verifyI420BlobInput(y, u, v);
+    // set blobs
+    _blobs.emplace_back(std::move(y));
+    _blobs.emplace_back(std::move(u));
+    _blobs.emplace_back(std::move(v));
+    tensorDesc = TensorDesc(Precision::U8, {}, Layout::NCHW);
+}
+
+Blob::Ptr& I420Blob::y() noexcept {
+    // NOTE: Y plane is a memory blob, which is checked in the constructor
+    return _blobs[0];
+}
+
+const Blob::Ptr& I420Blob::y() const noexcept {
+    // NOTE: Y plane is a memory blob, which is checked in the constructor
+    return _blobs[0];
+}
+
+Blob::Ptr& I420Blob::u() noexcept {
+    // NOTE: U plane is a memory blob, which is checked in the constructor
+    return _blobs[1];
+}
+
+const Blob::Ptr& I420Blob::u() const noexcept {
+    // NOTE: U plane is a memory blob, which is checked in the constructor
+    return _blobs[1];
+}
+
+Blob::Ptr& I420Blob::v() noexcept {
+    // NOTE: V plane is a memory blob, which is checked in the constructor
+    return _blobs[2];
+}
+
+const Blob::Ptr& I420Blob::v() const noexcept {
+    // NOTE: V plane is a memory blob, which is checked in the constructor
+    return _blobs[2];
+}
+
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs) {
+    // verify data is correct
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = blobs;
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs) {
+    // verify data is correct
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = std::move(blobs);
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,94 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_data_hash.hpp"
+#include "cpu_detector.hpp"
+#include "ie_parallel.hpp"
+#ifdef HAVE_SSE
+#include "ie_data_hash_sse42.hpp"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace InferenceEngine {
+
+namespace {
+
+// Fixed block size keeps the hash independent of the number of threads
+const size_t kBlockSize = 256 * 1024;
+
+class CRC32CTable {
+public:
+    CRC32CTable() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0x82F63B78u : 0u) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint32_t update(uint32_t crc, const uint8_t *data, size_t size) const {
+        for (size_t i = 0; i < size; i++)
+            crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+        return crc;
+    }
+
+private:
+    uint32_t table[256];
+};
+
+// Finalizer of MurmurHash3, spreads the block sums over all bits before combining
+inline uint64_t mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+}  // namespace
+
+uint64_t data_hash_block_ref(const uint8_t *data, size_t size) {
+    static const CRC32CTable crc32c;
+
+    uint32_t crc0 = 0xFFFFFFFFu;
+    uint32_t crc1 = 0xFFFFFFFFu;
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        crc0 = crc32c.update(crc0, data + i, 8);
+        crc1 = crc32c.update(crc1, data + i + 8, 8);
+    }
+    crc0 = crc32c.update(crc0, data + i, size - i);
+
+    return (static_cast<uint64_t>(~crc0) << 32) | static_cast<uint32_t>(~crc1);
+}
+
+uint64_t data_hash(const void* data, size_t size) {
+    const auto *bytes = static_cast<const uint8_t *>(data);
+
+    uint64_t (*hash_block)(const uint8_t *, size_t) = data_hash_block_ref;
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42())
+        hash_block = data_hash_block_sse42;
+#endif
+
+    const size_t blocks = (size + kBlockSize - 1) / kBlockSize;
+    std::vector<uint64_t> block_hashes(blocks);
+    parallel_for(blocks, [&](size_t b) {
+        const size_t offset = b * kBlockSize;
+        block_hashes[b] = hash_block(bytes + offset, std::min(kBlockSize, size - offset));
+    });
+
+    uint64_t hash = mix(static_cast<uint64_t>(size));
+    for (auto block_hash : block_hashes)
+        hash = mix(hash ^ block_hash) + 0x9e3779b97f4a7c15ull;
+
+    return hash;
+}
+
+}  // namespace InferenceEngine
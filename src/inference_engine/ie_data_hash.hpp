@@ -0,0 +1,33 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes 64-bit hash of the data content (e.g. to find identical weights).
+ * Data is split into fixed size blocks which are hashed in parallel with CRC32C, using SSE4.2 instructions
+ * if CPU supports them. The result depends on the data only, so it is the same for any CPU and number of threads.
+ * @param data pointer to the data
+ * @param size size of the data in bytes
+ * @return hash value
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) data_hash(const void* data, size_t size);
+
+/**
+ * @brief Computes two CRC32C sums of the data block without SSE 4.2 instructions and threads:
+ * the first over even 8-byte words and the tail, the second over odd 8-byte words
+ * @param data pointer to the block
+ * @param size size of the block in bytes
+ * @return the first sum in the high 32 bits and the second one in the low 32 bits
+ */
+uint64_t data_hash_block_ref(const uint8_t* data, size_t size);
+
+}  // namespace InferenceEngine
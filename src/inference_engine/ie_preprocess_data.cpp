@@ -13,6 +13,7 @@
 #include "ie_compound_blob.h"
 
 #include <algorithm>
+#include <cstring>
 
 namespace InferenceEngine {
 
@@ -745,6 +746,21 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
 
 using namespace Resize;
 
+// items of the network's input batch past the images of a batched blob would keep the data of
+// the previous request, so they are zeroed
+static void zeroBatchTail(Blob::Ptr &outBlob, int batchSize) {
+    const auto &desc = outBlob->getTensorDesc();
+    const size_t N = desc.getDims()[0];
+    if (static_cast<size_t>(batchSize) >= N) {
+        return;
+    }
+
+    const auto &blocking = desc.getBlockingDesc();
+    const size_t itemSize = blocking.getStrides()[0] * outBlob->element_size();
+    auto data = outBlob->buffer().as<uint8_t*>() + blocking.getOffsetPadding() * outBlob->element_size();
+    std::memset(data + batchSize * itemSize, 0, (N - batchSize) * itemSize);
+}
+
 void PreProcessData::setRoiBlob(const Blob::Ptr &blob) {
     _roiBlob = blob;
 }
@@ -769,15 +785,25 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
+    // the dynamic batch limits the items read by the network, otherwise the whole batch is read
+    const bool wholeBatch = batchSize < 0;
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
 
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
     if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+        if (wholeBatch && _roiBlob->is<BatchedBlob>()) {
+            zeroBatchTail(outBlob, batchSize);
+        }
         return;
     }
 
+    if (_roiBlob->is<BatchedBlob>()) {
+        THROW_IE_EXCEPTION << "Batched blob pre-processing is unsupported in this mode. "
+                              "Use default pre-processing instead to process batched blobs.";
+    }
+
     if (batchSize > 1) {
         THROW_IE_EXCEPTION << "Batch pre-processing is unsupported in this mode. "
                               "Use default pre-processing instead to process batches.";
@@ -125,6 +125,19 @@ std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const Blob::Ptr& blob,
     return result;
 }
 
+// Y plane and chroma planes of NV12 or I420 blob, empty for other blobs
+std::vector<Blob::Ptr> yuv_planes(const Blob::Ptr& blob) {
+    if (blob->is<NV12Blob>()) {
+        const auto nv12 = blob->as<NV12Blob>();
+        return {nv12->y(), nv12->uv()};
+    }
+    if (blob->is<I420Blob>()) {
+        const auto i420 = blob->as<I420Blob>();
+        return {i420->y(), i420->u(), i420->v()};
+    }
+    return {};
+}
+
 template<typename... Ts, int... IIs>
 std::vector<cv::GMat> to_vec_impl(std::tuple<Ts...> &&gmats, cv::detail::Seq<IIs...>) {
     return { std::get<IIs>(gmats)... };
@@ -180,6 +193,12 @@ std::vector<cv::GMat> merge(const std::vector<cv::GMat>& inputs,
     return interleaved;
 }
 
+// U and V planes of I420 are interleaved into the UV plane of NV12 first: the chroma is a quarter
+// of the image, and the fluid backend maps the ROI of a single chroma input of the 4:2:0 kernels only
+cv::GMat I420toRGB(const cv::GMat &y, const cv::GMat &u, const cv::GMat &v) {
+    return gapi::NV12toRGB::on(y, gapi::Merge2::on(u, v));
+}
+
 // validate input/output ColorFormat-related parameters
 void validateColorFormats(const G::Desc &in_desc,
                           const G::Desc &out_desc,
@@ -213,6 +232,13 @@ void validateColorFormats(const G::Desc &in_desc,
                                                       << " color format";
                 break;
             }
+            case ColorFormat::I420: {
+                if (desc.d.C != 3) THROW_IE_EXCEPTION << desc_prefix << " tensor descriptor "
+                                                      << "has invalid number of channels "
+                                                      << desc.d.C << " for " << fmt
+                                                      << " color format";
+                break;
+            }
             default: break;
         }
     };
@@ -230,8 +256,8 @@ void validateColorFormats(const G::Desc &in_desc,
         THROW_IE_EXCEPTION << "Network's expected color format is unspecified";
     }
 
-    if (output_color_format == ColorFormat::NV12) {
-        THROW_IE_EXCEPTION << "NV12 network's color format is not supported [by G-API]";
+    if (output_color_format == ColorFormat::NV12 || output_color_format == ColorFormat::I420) {
+        THROW_IE_EXCEPTION << output_color_format << " network's color format is not supported [by G-API]";
     }
 
     verify_layout(in_layout, "Input blob");
@@ -353,6 +379,24 @@ class PlanarColorConversions {
         return planes;
     }
 
+    static std::vector<cv::GMat> I420toRGB(const std::vector<cv::GMat>& inputs,
+                                           Layout,
+                                           Layout,
+                                           ResizeAlgorithm) {
+        // in_layout is always NCHW
+        auto interleaved_rgb = ::InferenceEngine::I420toRGB(inputs[0], inputs[1], inputs[2]);
+        return split({interleaved_rgb}, 3);
+    }
+
+    static std::vector<cv::GMat> I420toBGR(const std::vector<cv::GMat>& inputs,
+                                           Layout in_layout,
+                                           Layout out_layout,
+                                           ResizeAlgorithm algorithm) {
+        auto planes = I420toRGB(inputs, in_layout, out_layout, algorithm);
+        std::reverse(planes.begin(), planes.end());
+        return planes;
+    }
+
 public:
     PlanarColorConversions() {
         m_conversions = {
@@ -363,7 +407,9 @@ public:
             { {ColorFormat::RGBX, ColorFormat::BGR}, dropLastChanAndReverse },
             { {ColorFormat::BGRX, ColorFormat::RGB}, dropLastChanAndReverse },
             { {ColorFormat::NV12, ColorFormat::BGR}, NV12toBGR },
-            { {ColorFormat::NV12, ColorFormat::RGB}, NV12toRGB }
+            { {ColorFormat::NV12, ColorFormat::RGB}, NV12toRGB },
+            { {ColorFormat::I420, ColorFormat::BGR}, I420toBGR },
+            { {ColorFormat::I420, ColorFormat::RGB}, I420toRGB }
         };
     }
 
@@ -429,11 +475,12 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     }
 
     // specific pre-processing case:
-    // 1. Requires interleaved image of type CV_8UC3 (except for NV12 input)
+    // 1. Requires interleaved image of type CV_8UC3 (except for NV12 and I420 input)
     // 2. Supports bilinear resize only
-    // 3. Supports NV12 -> RGB/BGR color transformations
+    // 3. Supports NV12 and I420 -> RGB/BGR color transformations
     const bool nv12_input = (input_color_format == ColorFormat::NV12);
-    const bool specific_nv12_input_handling = nv12_input
+    const bool i420_input = (input_color_format == ColorFormat::I420);
+    const bool specific_nv12_input_handling = (nv12_input || i420_input)
         && (output_color_format == ColorFormat::RGB || output_color_format == ColorFormat::BGR);
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_nv12_input_handling)
                                         && (in_desc.d.C == 3 || specific_nv12_input_handling)
@@ -446,10 +493,12 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         const auto input_sz = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
         const auto scale_sz = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
 
-        // convert color format to RGB in case of NV12 input
+        // convert color format to RGB in case of NV12 or I420 input
         std::vector<cv::GMat> color_converted_input;
         if (nv12_input) {
             color_converted_input.emplace_back(gapi::NV12toRGB::on(inputs[0], inputs[1]));
+        } else if (i420_input) {
+            color_converted_input.emplace_back(I420toRGB(inputs[0], inputs[1], inputs[2]));
         } else {
             color_converted_input = inputs;
         }
@@ -458,7 +507,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             color_converted_input[0], precision, input_sz, scale_sz, cv::INTER_LINEAR));
 
         // if color conversion is done, output is RGB. but if BGR is required, reverse the planes
-        if (nv12_input && output_color_format == ColorFormat::BGR) {
+        if ((nv12_input || i420_input) && output_color_format == ColorFormat::BGR) {
             std::reverse(planes.begin(), planes.end());
         }
 
@@ -514,25 +563,31 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr std::size_t PreprocEngine::_graphsCapacity;
+
+PreprocEngine::PreprocEngine() {}
+
+PreprocEngine::GraphCacheStats PreprocEngine::getGraphCacheStats() const {
+    GraphCacheStats stats;
+    stats.hits = _cacheHits;
+    stats.misses = _cacheMisses;
+    stats.reshapes = _cacheReshapes;
+    stats.evictions = _cacheEvictions;
+    return stats;
+}
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -599,10 +654,23 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob or an NV12 blob
-    const bool nv12_blob = src->is<NV12Blob>();
-    if (!src->is<MemoryBlob>() && !nv12_blob) {
-        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob or NV12Blob";
+    // every image of a batched blob is pre-processed into its own item of the dst batch
+    if (src->is<BatchedBlob>()) {
+        const auto &dst_dims = dst->getTensorDesc().getDims();
+        if (!dst_dims.empty() && src->size() > dst_dims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Batched blob has " << src->size()
+                               << " images but network's input batch size is " << dst_dims[0];
+        }
+        for (size_t i = 0; i < src->size(); i++) {
+            checkApplicabilityGAPI(src->as<BatchedBlob>()->getBlob(i), dst);
+        }
+        return;
+    }
+
+    // src is either a memory blob or an NV12 or I420 blob
+    const bool yuv_blob = src->is<NV12Blob>() || src->is<I420Blob>();
+    if (!src->is<MemoryBlob>() && !yuv_blob) {
+        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
     }
 
     // dst is always a memory blob
@@ -614,7 +682,7 @@ void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr
     const auto &dst_dims = dst->getTensorDesc().getDims();
 
     // dimensions sizes must be equal if both blobs are memory blobs
-    if (!nv12_blob && src_dims.size() != dst_dims.size()) {
+    if (!yuv_blob && src_dims.size() != dst_dims.size()) {
         THROW_IE_EXCEPTION << "Preprocessing is not applicable. Source and destination blobs "
                               "have different number of dimensions.";
     }
@@ -632,12 +700,77 @@ void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr
     }
 }
 
+PreprocEngine::CompiledGraph& PreprocEngine::getGraph(std::list<CompiledGraph> &graphs, const CallDesc &call,
+                                                     bool omp_serial, std::size_t slices, bool reshape_first,
+                                                     Update &update) {
+    for (auto it = graphs.begin(); it != graphs.end(); ++it) {
+        if (it->serial == omp_serial && it->call == call) {
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_cache_hit);
+            _cacheHits++;
+            graphs.splice(graphs.begin(), graphs, it);
+            update = Update::NOTHING;
+            return graphs.front();
+        }
+    }
+
+    IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_cache_miss);
+    _cacheMisses++;
+    if (reshape_first) {
+        // the least recently used graph differing only in the input size is reshaped
+        // instead of the compilation of a new one
+        for (auto it = graphs.rbegin(); it != graphs.rend(); ++it) {
+            const bool compiled = std::all_of(it->slices.begin(), it->slices.end(),
+                                              [](const cv::GCompiled &c) { return static_cast<bool>(c); });
+            if (it->serial == omp_serial && compiled && Update::RESHAPE == needUpdate(it->call, call)) {
+                it->call = call;
+                graphs.splice(graphs.begin(), graphs, std::next(it).base());
+                update = Update::RESHAPE;
+                _cacheReshapes++;
+                _cacheEvictions++;
+                return graphs.front();
+            }
+        }
+    }
+
+    update = Update::REBUILD;
+    if (graphs.size() < _graphsCapacity) {
+        graphs.push_front(CompiledGraph{call, omp_serial, {}, std::vector<cv::GCompiled>(slices),
+                                        std::vector<cv::gapi::own::Rect>(slices)});
+        return graphs.front();
+    }
+
+    // the least recently used graph is reshaped instead of the compilation if only sizes differ
+    auto& graph = graphs.back();
+    if (graph.serial == omp_serial) {
+        update = needUpdate(graph.call, call);
+    }
+    if (Update::REBUILD == update) {
+        graph.computation = Opt<cv::GComputation>();
+        graph.slices.assign(graph.slices.size(), cv::GCompiled());
+    } else {
+        _cacheReshapes++;
+    }
+    _cacheEvictions++;
+    graph.call = call;
+    graph.serial = omp_serial;
+    graphs.splice(graphs.begin(), graphs, std::prev(graphs.end()));
+    return graphs.front();
+}
+
 int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     if (batch == 0) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedBlob>()) {
+        // every image of the batched blob is one item of the batch
+        const auto images = static_cast<int>(blob->size());
+        if (batch > images) {
+            THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
+                                << " is greater than the number of images in batched blob " << images;
+        }
+        batch = batch < 0 ? images : batch;
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -652,7 +785,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::executeGraph(CompiledGraph& graph,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -675,47 +808,47 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+        IE_ASSERT(static_cast<std::size_t>(slice_n) < graph.slices.size());
+        auto& compiled = graph.slices[slice_n];
 
-            using cv::gapi::own::Rect;
+        using cv::gapi::own::Rect;
 
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
+        // current design implies all images in batch are equal
+        const auto& input_plane_mats = batched_input_plane_mats[0];
+        const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+        auto lines_per_thread = output_plane_mats[0].rows / total_slices;
+        const auto remainder = output_plane_mats[0].rows % total_slices;
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
+        // remainder shows how many threads must calculate 1 additional row. now these additions
+        // must also be addressed in rect's Y coordinate:
+        int roi_y = 0;
+        if (slice_n < remainder) {
+            lines_per_thread++;  // 1 additional row
+            roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+        } else {
+            // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+            roi_y =
+                remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+        }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+        if (lines_per_thread <= 0) return;  // no job for current thread
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
-            std::vector<Rect> rois(output_plane_mats.size(), roi);
+        auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+        if (Update::REBUILD == update || Update::RESHAPE == update || !compiled || !(graph.rois[slice_n] == roi)) {
+            //  need to compile (or reshape) own object for a particular ROI
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
 
-            // TODO: make a ROI a runtime argument to avoid
-            // recompilations
+            // output ROIs are compile arguments in this G-API version, so a compiled slice is
+            // reshaped when its ROI changes. The reshape doesn't rebuild the graph
+            std::vector<Rect> rois(output_plane_mats.size(), roi);
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descr_of(input_plane_mats), std::move(args));
+            if (Update::REBUILD == update || !compiled) {
+                compiled = graph.computation.value().compile(descr_of(input_plane_mats), std::move(args));
             } else {
-                IE_ASSERT(compiled);
                 compiled.reshape(descr_of(input_plane_mats), std::move(args));
             }
+            graph.rois[slice_n] = roi;
         }
 
         for (int i = 0; i < batch_size; ++i) {
@@ -772,50 +905,46 @@ bool PreprocEngine::preprocessBlob(const MemoryBlob::Ptr &inBlob, MemoryBlob::Pt
                                             out_desc_ie.getDims(),
                                             out_fmt },
                                   algorithm };
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(in_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt,
-                           get_cv_depth(in_desc_ie)));
-        }
+    Update update;
+    auto& graph = getGraph(_graphs, thisCall, omp_serial, parallel_get_max_threads(), false, update);
+
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
+        graph.computation = cv::util::make_optional(
+            buildGraph(in_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt,
+                       get_cv_depth(in_desc_ie)));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob, batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(graph, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
 }
 
-bool PreprocEngine::preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+bool PreprocEngine::preprocessBlob(const std::vector<Blob::Ptr> &yuvPlanes, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
     int batch_size) {
 
-    const auto& y_blob = inBlob->y();
-    const auto& uv_blob = inBlob->uv();
-    if (!y_blob || !uv_blob) {
-        THROW_IE_EXCEPTION << "Invalid underlying blobs in NV12Blob";
+    if (std::any_of(yuvPlanes.begin(), yuvPlanes.end(), [](const Blob::Ptr &plane) { return !plane; })) {
+        THROW_IE_EXCEPTION << "Invalid underlying blobs in " << in_fmt << " blob";
     }
 
+    const auto& y_blob = yuvPlanes[0];
     const auto& in_desc_ie_y = y_blob->getTensorDesc();
     const auto& out_desc_ie = outBlob->getTensorDesc();
-    validateTensorDesc(in_desc_ie_y);
-    validateTensorDesc(uv_blob->getTensorDesc());
+    for (const auto &plane : yuvPlanes) {
+        validateTensorDesc(plane->getTensorDesc());
+    }
     validateTensorDesc(out_desc_ie);
 
     const auto in_layout = Layout::NCHW;
@@ -839,8 +968,8 @@ bool PreprocEngine::preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
-    // use Y plane tensor descriptor's dims for tracking if update is needed. Y and UV planes are
-    // strictly bound to each other: if one is changed, the other must be changed as well. precision
+    // use Y plane tensor descriptor's dims for tracking if update is needed. Chroma planes are
+    // strictly bound to Y plane: if one is changed, the others must be changed as well. precision
     // is always U8 and layout is always planar (NCHW)
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie_y.getPrecision(),
                                             in_layout,
@@ -851,52 +980,184 @@ bool PreprocEngine::preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr
                                             out_desc_ie.getDims(),
                                             out_fmt },
                                   algorithm };
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed?
-            auto nv12_desc = G::Desc{};
-            nv12_desc.d = in_desc_y.d;
-            nv12_desc.d.C = 2;
-            _lastComputation = cv::util::make_optional(
-                buildGraph(nv12_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt,
-                           CV_8U));
-        }
+    Update update;
+    auto& graph = getGraph(_graphs, thisCall, omp_serial, parallel_get_max_threads(), false, update);
+
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed?
+        // the number of "channels" is the number of planes: 2 for NV12 and 3 for I420
+        auto yuv_desc = G::Desc{};
+        yuv_desc.d = in_desc_y.d;
+        yuv_desc.d.C = static_cast<int>(yuvPlanes.size());
+        graph.computation = cv::util::make_optional(
+            buildGraph(yuv_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt,
+                       CV_8U));
     }
 
-    // convert Y and UV plane blobs to Mats _separately_
-    auto batched_y_plane_mats = bind_to_blob(y_blob, batch_size);
-    auto batched_uv_plane_mats = bind_to_blob(uv_blob, batch_size);
-
-    // combine corresponding Y and UV mats into 2-element vectors of (Y, UV) pairs
+    // convert plane blobs to Mats _separately_ and combine corresponding Mats into vectors of
+    // (Y, UV) pairs or (Y, U, V) triples. Planes are not copied, Mats refer to the blobs memory
     std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
-    for (size_t i = 0; i < batch_size; ++i) {
-        auto& input = batched_input_plane_mats[i];
-        input.emplace_back(std::move(batched_y_plane_mats[i][0]));
-        input.emplace_back(std::move(batched_uv_plane_mats[i][0]));
+    for (const auto &plane : yuvPlanes) {
+        auto batched_plane_mats = bind_to_blob(plane, batch_size);
+        for (int i = 0; i < batch_size; ++i) {
+            batched_input_plane_mats[i].emplace_back(std::move(batched_plane_mats[i][0]));
+        }
     }
 
     // process output blob as usual
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(graph, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
 }
 
+bool PreprocEngine::preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size) {
+    return preprocessBlob(std::vector<Blob::Ptr>{inBlob->y(), inBlob->uv()}, outBlob, algorithm,
+        in_fmt, out_fmt, omp_serial, batch_size);
+}
+
+bool PreprocEngine::preprocessBlob(const I420Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size) {
+    return preprocessBlob(std::vector<Blob::Ptr>{inBlob->y(), inBlob->u(), inBlob->v()}, outBlob,
+        algorithm, in_fmt, out_fmt, omp_serial, batch_size);
+}
+
+bool PreprocEngine::preprocessBlob(const BatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size) {
+
+    const auto& out_desc_ie = outBlob->getTensorDesc();
+    validateTensorDesc(out_desc_ie);
+
+    const auto out_layout = out_desc_ie.getLayout();
+    const G::Desc out_desc = G::decompose(out_desc_ie);
+
+    // every image is pre-processed into its own item of the network's input batch
+    if (inBlob->size() > static_cast<size_t>(out_desc.d.N)) {
+        THROW_IE_EXCEPTION  << "Input blob batch size is invalid: (images in batched blob) "
+                            << inBlob->size() << " > " << out_desc.d.N << " (expected by network)";
+    }
+
+    const bool yuv = in_fmt == ColorFormat::NV12 || in_fmt == ColorFormat::I420;
+    for (size_t i = 0; i < inBlob->size(); i++) {
+        const auto item = inBlob->getBlob(i);
+        const bool expected = in_fmt == ColorFormat::NV12 ? item->is<NV12Blob>()
+                            : in_fmt == ColorFormat::I420 ? item->is<I420Blob>()
+                                                          : item->is<MemoryBlob>();
+        if (!expected) {
+            THROW_IE_EXCEPTION  << "Unsupported batched blob image for color format " << in_fmt
+                                << ": expected " << (in_fmt == ColorFormat::NV12 ? "NV12Blob"
+                                                   : in_fmt == ColorFormat::I420 ? "I420Blob" : "MemoryBlob");
+        }
+        if (yuv) {
+            for (const auto &plane : yuv_planes(item)) {
+                validateTensorDesc(plane->getTensorDesc());
+            }
+        } else {
+            validateTensorDesc(item->getTensorDesc());
+        }
+    }
+
+    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+
+    const auto max_threads = static_cast<std::size_t>(parallel_get_max_threads());
+    if (_itemGraphs.size() < max_threads) {
+        _itemGraphs.resize(max_threads);
+    }
+
+    // Images differ in sizes, so they are distributed between threads instead of rows of the
+    // output: each thread crops, converts and resizes its images as a whole using its own graphs.
+    // Only pixels of the image (ROI of the frame) are read, the rest of the frame is not converted
+    parallel_nt_static(thread_num, [&, this](int ithr, const int nthr) {
+        IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
+
+        auto& graphs = _itemGraphs[ithr];
+        for (int i = ithr; i < batch_size; i += nthr) {
+            const auto item = inBlob->getBlob(i);
+
+            // the image is processed as the YUV blob or the memory blob of the batch size 1
+            std::vector<cv::gapi::own::Mat> input_plane_mats;
+            TensorDesc in_desc_ie;
+            G::Desc in_desc;
+            Layout in_layout;
+            if (yuv) {
+                const auto planes = yuv_planes(item);
+                for (const auto &plane : planes) {
+                    input_plane_mats.emplace_back(std::move(bind_to_blob(plane, 1)[0][0]));
+                }
+                in_desc_ie = planes[0]->getTensorDesc();
+                in_desc.d = G::decompose(in_desc_ie).d;
+                in_desc.d.C = static_cast<int>(planes.size());
+                in_layout = Layout::NCHW;
+            } else {
+                input_plane_mats = std::move(bind_to_blob(item, 1)[0]);
+                in_desc_ie = item->getTensorDesc();
+                in_desc = G::decompose(in_desc_ie);
+                in_layout = in_desc_ie.getLayout();
+            }
+
+            CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                                    in_layout,
+                                                    in_desc_ie.getDims(),
+                                                    in_fmt },
+                                          BlobDesc{ out_desc_ie.getPrecision(),
+                                                    out_layout,
+                                                    out_desc_ie.getDims(),
+                                                    out_fmt },
+                                          algorithm };
+            Update update;
+            auto& compiled = getGraph(graphs, thisCall, omp_serial, 1, true, update).slices[0];
+            if (Update::REBUILD == update || Update::RESHAPE == update) {
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+                auto args = cv::compile_args(gapi::preprocKernels());
+                if (Update::REBUILD == update) {
+                    auto computation = buildGraph(in_desc,
+                                                  out_desc,
+                                                  in_layout,
+                                                  out_layout,
+                                                  algorithm,
+                                                  in_fmt,
+                                                  out_fmt,
+                                                  get_cv_depth(in_desc_ie));
+                    compiled = computation.compile(descr_of(input_plane_mats), std::move(args));
+                } else {
+                    IE_ASSERT(compiled);
+                    compiled.reshape(descr_of(input_plane_mats), std::move(args));
+                }
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : batched_output_plane_mats[i]) { call_outs.emplace_back(&m);}
+
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_graph);
+            compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
+
+    return true;
+}
+
 bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
     if (!useGAPI()) {
@@ -911,18 +1172,17 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    // images of a batched blob have the input color format
+    if (inBlob->is<BatchedBlob>()) {
+        return preprocessBlob(as<BatchedBlob>(inBlob), outMemoryBlob, algorithm, in_fmt, out_fmt,
+            omp_serial, batch_size);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
-    // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
-    if (in_fmt != ColorFormat::NV12) {
-        auto inMemoryBlob = as<MemoryBlob>(inBlob);
-        if (!inMemoryBlob) {
-            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
-                                << ": expected MemoryBlob";
-        }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
-    } else {
+    // if input color format is NV12 or I420, NV12Blob or I420Blob is expected. otherwise, a
+    // MemoryBlob is expected
+    if (in_fmt == ColorFormat::NV12) {
         auto inNV12Blob = as<NV12Blob>(inBlob);
         if (!inNV12Blob) {
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
@@ -930,6 +1190,22 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
             batch_size);
+    } else if (in_fmt == ColorFormat::I420) {
+        auto inI420Blob = as<I420Blob>(inBlob);
+        if (!inI420Blob) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": expected I420Blob";
+        }
+        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size);
+    } else {
+        auto inMemoryBlob = as<MemoryBlob>(inBlob);
+        if (!inMemoryBlob) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": expected MemoryBlob";
+        }
+        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size);
     }
 }
 }  // namespace InferenceEngine
@@ -8,6 +8,8 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <atomic>
+#include <list>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -25,18 +27,49 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // graph compiled for the call, one object per thread slice of the output. The output ROI of
+    // a slice is applied at run time: the slice is reshaped if it was compiled for another ROI,
+    // e.g. when the call runs on a different number of threads
+    struct CompiledGraph {
+        CallDesc call;
+        bool serial;
+        Opt<cv::GComputation> computation;
+        std::vector<cv::GCompiled> slices;
+        std::vector<cv::gapi::own::Rect> rois;
+    };
+
+    // compiled graphs, the most recently used first. Input blobs (and their ROIs) are bound
+    // to the graph at run time, so ROIs of the same size share the graph
+    std::list<CompiledGraph> _graphs;
+    static constexpr std::size_t _graphsCapacity = 8;
+
+    // graphs of the batched blob images, one cache per thread since the images are processed
+    // in parallel and every image is processed by a single thread as a whole. ROIs usually
+    // differ in sizes, so a cached graph is reshaped on a miss if only the input size differs
+    std::vector<std::list<CompiledGraph>> _itemGraphs;
 
     ProfilingTask _perf_graph_building {"Preproc Graph Building"};
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
     ProfilingTask _perf_exec_graph {"Preproc Exec Graph"};
     ProfilingTask _perf_graph_compiling {"Preproc Graph compiling"};
+    ProfilingTask _perf_graph_cache_hit {"Preproc Graph cache hit"};
+    ProfilingTask _perf_graph_cache_miss {"Preproc Graph cache miss"};
+
+    // the caches of the batched blob images are used by several threads at once
+    std::atomic<std::size_t> _cacheHits {0};
+    std::atomic<std::size_t> _cacheMisses {0};
+    std::atomic<std::size_t> _cacheReshapes {0};
+    std::atomic<std::size_t> _cacheEvictions {0};
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
+
+    // returns the graph of the call, the least recently used one is replaced if the cache is full.
+    // If reshape_first is set, a graph differing only in the input size is reshaped before that
+    CompiledGraph& getGraph(std::list<CompiledGraph> &graphs, const CallDesc &call, bool omp_serial,
+                            std::size_t slices, bool reshape_first, Update &update);
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
+    void executeGraph(CompiledGraph& graph,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -47,12 +80,37 @@ class PreprocEngine {
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
+    // Y plane and chroma planes (UV for NV12, U and V for I420) of the YUV 4:2:0 input
+    bool preprocessBlob(const std::vector<Blob::Ptr> &yuvPlanes, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size);
+
     bool preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
+    bool preprocessBlob(const I420Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size);
+
+    bool preprocessBlob(const BatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size);
+
 public:
+    // counters of the compiled graphs caches since the engine is created
+    struct GraphCacheStats {
+        std::size_t hits = 0;       // the cached graph of the call is used as is
+        std::size_t misses = 0;     // the graph of the call is compiled or reshaped
+        std::size_t reshapes = 0;   // misses served by the reshape of a cached graph
+        std::size_t evictions = 0;  // the graph of another call is replaced by the graph of the call
+    };
+
+    // the number of graphs kept in a cache
+    static constexpr std::size_t graphsCapacity() { return _graphsCapacity; }
+
     PreprocEngine();
+    GraphCacheStats getGraphCacheStats() const;
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
@@ -10,6 +10,12 @@
 #if MANUAL_SIMD
   #include "cpu_detector.hpp"
   #include "ie_preprocess_gapi_kernels_sse42.hpp"
+  #ifdef HAVE_AVX2
+    #include "ie_preprocess_gapi_kernels_avx2.hpp"
+  #endif
+  #ifdef HAVE_AVX512
+    #include "ie_preprocess_gapi_kernels_avx512.hpp"
+  #endif
 #endif
 
 #include <opencv2/gapi/opencv_includes.hpp>
@@ -29,6 +35,39 @@ namespace kernels {
 template<typename T, int chs> static
 void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int length) {
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx512::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx512::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<const float*>(ins[2]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx2::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx2::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
+                                 reinterpret_cast<const float*>(ins[1]),
+                                 reinterpret_cast<const float*>(ins[2]),
+                                 reinterpret_cast<float*>(out), length);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
             mergeRow_8UC2(ins[0], ins[1], out, length);
@@ -87,6 +126,41 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
 template<typename T, int chs> static
 void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx512::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx512::splitRow_32FC3(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   reinterpret_cast<float*>(outs[2]),
+                                   length);
+            return;
+        }
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx2::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx2::splitRow_32FC3(reinterpret_cast<const float*>(in),
+                                 reinterpret_cast<float*>(outs[0]),
+                                 reinterpret_cast<float*>(outs[1]),
+                                 reinterpret_cast<float*>(outs[2]),
+                                 length);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
             splitRow_8UC2(in, outs[0], outs[1], length);
@@ -270,6 +344,37 @@ GAPI_FLUID_KERNEL(FSplit4, Split4, false) {
 template<typename T>
 static void chanToPlaneRow(const uint8_t* in, int chan, int chs, uint8_t* out, int length) {
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value && chs == 1) {
+            avx512::copyRow_8U(in, out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 1) {
+            avx512::copyRow_32F(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(out),
+                                length);
+            return;
+        }
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 1) {
+            avx2::copyRow_8U(in, out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 1) {
+            avx2::copyRow_32F(reinterpret_cast<const float*>(in),
+                              reinterpret_cast<float*>(out),
+                              length);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 1) {
             copyRow_8U(in, out, length);
@@ -577,6 +682,37 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
     }
 
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value && inSz.width >= 32 && outSz.width >= 32) {
+            avx512::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                     reinterpret_cast<const uint8_t**>(src0),
+                                     reinterpret_cast<const uint8_t**>(src1),
+                                     reinterpret_cast<const short*>(alpha),
+                                     reinterpret_cast<const short*>(mapsx),
+                                     reinterpret_cast<const short*>(beta),
+                                     reinterpret_cast<uint8_t*>(tmp),
+                                     inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && inSz.width >= 16 && outSz.width >= 16) {
+            avx2::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                   reinterpret_cast<const uint8_t**>(src0),
+                                   reinterpret_cast<const uint8_t**>(src1),
+                                   reinterpret_cast<const short*>(alpha),
+                                   reinterpret_cast<const short*>(mapsx),
+                                   reinterpret_cast<const short*>(beta),
+                                   reinterpret_cast<uint8_t*>(tmp),
+                                   inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
             if (inSz.width >= 16 && outSz.width >= 8) {
@@ -1595,6 +1731,18 @@ GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
         int buf_width = out.length();
 
         #if MANUAL_SIMD
+          #ifdef HAVE_AVX512
+            if (with_cpu_x86_avx512_core()) {
+                avx512::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
+                return;
+            }
+          #endif
+          #ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx2::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
+                return;
+            }
+          #endif
             calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
         #else
             calculate_nv12_to_rgb_fallback(y_rows, uv_row, out_rows, buf_width);
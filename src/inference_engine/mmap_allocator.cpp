@@ -0,0 +1,95 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#include <details/ie_irelease.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+MmapAllocator::MmapAllocator(const std::string &path) : _path(path) {}
+
+#ifdef _WIN32
+
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+
+    HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    void *data = nullptr;
+    // PAGE_WRITECOPY + FILE_MAP_COPY is a private copy-on-write mapping
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (mapping != nullptr) {
+        data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+
+    if (data != nullptr)
+        _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    return UnmapViewOfFile(handle) != 0;
+}
+
+#else
+
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    void *data = nullptr;
+    struct stat st = {};
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= size) {
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+            data = nullptr;
+    }
+    // mapping holds its own reference to the file
+    close(fd);
+
+    if (data != nullptr)
+        _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    return munmap(handle, _size) == 0;
+}
+
+#endif
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string &path) {
+    return shared_from_irelease(new MmapAllocator(path));
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,54 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Allocator which maps a file into the memory instead of allocating it.
+ * Mapping is private: pages are read from the file on demand and shared with other processes via the page cache,
+ * data written to the blob is copied on write and never goes to the file.
+ */
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string &path);
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Maps the first size bytes of the file, the file must not be smaller
+     */
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::string _path;
+    size_t _size = 0;
+};
+
+/**
+ * @brief Creates a blob allocator mapping the given file
+ * @param path path to the file
+ * @return shared pointer to the allocator
+ */
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string &path);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -39,6 +39,45 @@ void NetworkSerializer::serialize(
     const std::string &xmlPath,
     const std::string &binPath,
     const InferenceEngine::ICNNNetwork& network) {
+    std::ofstream ofsBin;
+    if (!binPath.empty()) {
+        ofsBin.open(binPath, std::ofstream::out | std::ofstream::binary);
+        if (!ofsBin) {
+            THROW_IE_EXCEPTION << "File '" << binPath << "' is not opened as out file stream";
+        }
+    }
+
+    pugi::xml_document doc;
+    serialize(doc, binPath.empty() ? nullptr : &ofsBin, network);
+
+    if (ofsBin.is_open()) {
+        ofsBin.close();
+        if (!ofsBin.good()) {
+            THROW_IE_EXCEPTION << "Error during '" << binPath << "' closing";
+        }
+    }
+
+    if (!doc.save_file(xmlPath.c_str())) {
+        THROW_IE_EXCEPTION << "file '" << xmlPath << "' was not serialized";
+    }
+}
+
+void NetworkSerializer::serialize(
+    std::ostream &xmlStream,
+    std::ostream &binStream,
+    const InferenceEngine::ICNNNetwork& network) {
+    pugi::xml_document doc;
+    serialize(doc, &binStream, network);
+    doc.save(xmlStream);
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Error during IR xml writing";
+    }
+}
+
+void NetworkSerializer::serialize(
+    pugi::xml_document &doc,
+    std::ostream *binStream,
+    const InferenceEngine::ICNNNetwork& network) {
     const std::vector<CNNLayerPtr> ordered = CNNNetSortTopologically(network);
 
     // A flag for serializing executable graph information (not complete IR)
@@ -55,16 +94,8 @@ void NetworkSerializer::serialize(
         }
     }
 
-    bool dumpWeights = !execGraphInfoSerialization & !binPath.empty();
-    std::ofstream ofsBin;
-    if (dumpWeights) {
-        ofsBin.open(binPath, std::ofstream::out | std::ofstream::binary);
-        if (!ofsBin) {
-            THROW_IE_EXCEPTION << "File '" << binPath << "' is not opened as out file stream";
-        }
-    }
+    bool dumpWeights = !execGraphInfoSerialization && binStream != nullptr;
 
-    pugi::xml_document doc;
     pugi::xml_node netXml = doc.append_child("net");
     netXml.append_attribute("name").set_value(network.getName().c_str());
 
@@ -144,21 +175,14 @@ void NetworkSerializer::serialize(
                 data.append_attribute("size").set_value(dataSize);
 
                 dataOffset += dataSize;
-                ofsBin.write(dataPtr, dataSize);
-                if (!ofsBin.good()) {
-                    THROW_IE_EXCEPTION << "Error during '" << binPath << "' writing";
+                binStream->write(dataPtr, dataSize);
+                if (!binStream->good()) {
+                    THROW_IE_EXCEPTION << "Error during weights writing";
                 }
             }
         }
     }
 
-    if (dumpWeights) {
-        ofsBin.close();
-        if (!ofsBin.good()) {
-            THROW_IE_EXCEPTION << "Error during '" << binPath << "' closing";
-        }
-    }
-
     pugi::xml_node edges = netXml.append_child("edges");
 
     for (const auto &ord : ordered) {
@@ -205,10 +229,6 @@ void NetworkSerializer::serialize(
         updatePreProcInfo(network, netXml);
         updateStatisticsInfo(network, netXml);
     }
-
-    if (!doc.save_file(xmlPath.c_str())) {
-        THROW_IE_EXCEPTION << "file '" << xmlPath << "' was not serialized";
-    }
 }
 
 void NetworkSerializer::updateStdLayerParams(const CNNLayer::Ptr &layer) {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 #include "xml_parse_utils.h"
@@ -14,11 +15,16 @@ namespace details {
 /**
 * Class for serialization of model been presented as ICNNNetwork to the disk
 */
-class NetworkSerializer {
+class INFERENCE_ENGINE_API_CLASS(NetworkSerializer) {
 public:
     static void serialize(const std::string &xmlPath, const std::string &binPath, const InferenceEngine::ICNNNetwork& network);
+    /**
+    * @brief Serializes the IR into the given streams, weights are written only for non executable graph networks
+    */
+    static void serialize(std::ostream &xmlStream, std::ostream &binStream, const InferenceEngine::ICNNNetwork& network);
 
 private:
+    static void serialize(pugi::xml_document &doc, std::ostream *binStream, const InferenceEngine::ICNNNetwork& network);
     static void updateStdLayerParams(const InferenceEngine::CNNLayer::Ptr &layer);
     static void updatePreProcInfo(const InferenceEngine::ICNNNetwork& network, pugi::xml_node &netXml);
     static void updateStatisticsInfo(const InferenceEngine::ICNNNetwork& network, pugi::xml_node &netXml);
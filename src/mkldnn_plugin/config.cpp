@@ -53,7 +53,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
-            if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
+            streamsCalibration = false;
+            if (val == PluginConfigParams::CPU_THROUGHPUT_CALIBRATE) {
+                // the number of streams is selected when the network is loaded
+                streamsCalibration = true;
+                throughputStreams = 1;
+            } else if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
                 throughputStreams = MKLDNNPlugin::cpu::getNumberOfCPUSockets();
             } else if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO) {
                 const int sockets = MKLDNNPlugin::cpu::getNumberOfCPUSockets();
@@ -74,7 +79,7 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 } catch (const std::exception&) {
                     THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
                                        << ". Expected only positive numbers (#streams) or "
-                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO";
+                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO/CPU_THROUGHPUT_CALIBRATE";
                 }
                 if (val_i > 0)
                     throughputStreams = val_i;
@@ -99,6 +104,36 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_STREAMS_WORK_STEALING) {
+            if (val == PluginConfigParams::YES) streamsWorkStealing = true;
+            else if (val == PluginConfigParams::NO) streamsWorkStealing = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_STREAMS_WORK_STEALING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_CALIBRATION_LATENCY_BOUND) {
+            float val_f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CALIBRATION_LATENCY_BOUND
+                                   << ". Expected only non-negative numbers (milliseconds)";
+            }
+            if (val_f < 0.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CALIBRATION_LATENCY_BOUND
+                                   << ". Expected only non-negative numbers (milliseconds)";
+            calibrationLatencyBound = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_CALIBRATION_CACHE) {
+            // empty string means that results are not persisted
+            calibrationCache = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_BUCKETS) {
+            // the format is checked against the network inputs when it's loaded
+            shapeBuckets = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -107,8 +142,10 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
         }
         _config.clear();
     }
-    if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
+    if (exclusiveAsyncRequests) {  // Exclusive request feature disables the streams
         throughputStreams = 1;
+        streamsCalibration = false;
+    }
 
     updateProperties();
 }
@@ -131,10 +168,26 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (parallelBranches == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+
+        if (streamsWorkStealing == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_STREAMS_WORK_STEALING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_STREAMS_WORK_STEALING, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
-        _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(throughputStreams) });
+        if (streamsCalibration == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::CPU_THROUGHPUT_CALIBRATE });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(throughputStreams) });
+        _config.insert({ PluginConfigParams::KEY_CPU_CALIBRATION_LATENCY_BOUND, std::to_string(calibrationLatencyBound) });
+        _config.insert({ PluginConfigParams::KEY_CPU_CALIBRATION_CACHE, calibrationCache });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(threadsNum) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_BUCKETS, shapeBuckets });
     }
 }
 
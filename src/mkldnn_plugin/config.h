@@ -18,10 +18,16 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
+    bool streamsWorkStealing = false;
+    bool streamsCalibration = false;
     std::string dumpToDot = "";
+    std::string shapeBuckets = "";
+    std::string calibrationCache = "";
     int batchLimit = 0;
     int throughputStreams = 1;
     int threadsNum = 0;
+    float calibrationLatencyBound = 0.f;
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
@@ -26,6 +26,16 @@ void MeanImage::Load(const MKLDNNDims& inputDims, InputInfo::Ptr inputInfo) {
 
     ResponseDesc resp;
 
+    scaleValues.clear();
+    for (unsigned channel = 0; channel < inChannels; channel++) {
+        if (pp[channel]->stdScale != 1.f) {
+            scaleValues.resize(inChannels);
+            for (unsigned c = 0; c < inChannels; c++)
+                scaleValues[c] = pp[c]->stdScale;
+            break;
+        }
+    }
+
     switch (pp.getMeanVariant()) {
         case MEAN_VALUE: {
             // mean image common value per channel (1x1xC)
@@ -108,4 +118,15 @@ void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input, InferenceEng
             });
         }
     }
+
+    if (!scaleValues.empty()) {
+        int C = inputDims[1];
+        int HW = inputDims.size() / MB / C;
+        parallel_for2d(MB, C, [&](int mb, int c) {
+            for (int i = 0; i < HW; i++) {
+                int idx = layout == NHWC ? (mb * HW + i) * C + c : (mb * C + c) * HW + i;
+                input[idx] *= scaleValues[c];
+            }
+        });
+    }
 }
@@ -20,6 +20,72 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void Subtract(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * Converts the input to FP32, changes its layout and applies mean and scale in one pass over the data.
+     * Both layouts must be NCHW or NHWC.
+     */
+    template<typename T>
+    void Convert(const MKLDNNDims &inputDims, const T *input, InferenceEngine::Layout inLayout,
+                 float *output, InferenceEngine::Layout outLayout) {
+        IE_ASSERT(input != nullptr && output != nullptr);
+
+        if (inputDims.ndims() != 4) {
+            THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+        }
+
+        if ((inLayout != InferenceEngine::NCHW && inLayout != InferenceEngine::NHWC) ||
+            (outLayout != InferenceEngine::NCHW && outLayout != InferenceEngine::NHWC)) {
+            THROW_IE_EXCEPTION << "Expecting input layout NCHW or NHWC.";
+        }
+
+        const size_t MB = inputDims[0];
+        const size_t C = inputDims[1];
+        const size_t HW = inputDims.size() / MB / C;
+        const float *meanImage = meanBuffer && meanBuffer->size() ? meanBuffer->readOnly().as<const float *>() : nullptr;
+
+        // inner loops go over contiguous memory without branches, so compiler vectorizes them
+        if (inLayout == InferenceEngine::NCHW && outLayout == InferenceEngine::NCHW) {
+            InferenceEngine::parallel_for2d(MB, C, [&](size_t mb, size_t c) {
+                const T *src = input + (mb * C + c) * HW;
+                float *dst = output + (mb * C + c) * HW;
+                const float scale = channelScale(c);
+                if (meanImage) {
+                    const float *mean = meanImage + c * HW;
+                    for (size_t i = 0; i < HW; i++)
+                        dst[i] = (static_cast<float>(src[i]) - mean[i]) * scale;
+                } else {
+                    const float mean = channelMean(c);
+                    for (size_t i = 0; i < HW; i++)
+                        dst[i] = (static_cast<float>(src[i]) - mean) * scale;
+                }
+            });
+        } else if (inLayout == InferenceEngine::NHWC && outLayout == InferenceEngine::NHWC) {
+            InferenceEngine::parallel_for2d(MB, HW, [&](size_t mb, size_t i) {
+                const T *src = input + (mb * HW + i) * C;
+                float *dst = output + (mb * HW + i) * C;
+                for (size_t c = 0; c < C; c++)
+                    dst[c] = (static_cast<float>(src[c]) - mean(c, i, HW, meanImage)) * channelScale(c);
+            });
+        } else if (inLayout == InferenceEngine::NHWC) {
+            // NHWC -> NCHW: each thread writes C rows of the output plane
+            InferenceEngine::parallel_for2d(MB, C, [&](size_t mb, size_t c) {
+                const T *src = input + mb * HW * C + c;
+                float *dst = output + (mb * C + c) * HW;
+                const float scale = channelScale(c);
+                for (size_t i = 0; i < HW; i++)
+                    dst[i] = (static_cast<float>(src[i * C]) - mean(c, i, HW, meanImage)) * scale;
+            });
+        } else {
+            // NCHW -> NHWC
+            InferenceEngine::parallel_for2d(MB, HW, [&](size_t mb, size_t i) {
+                const T *src = input + mb * C * HW + i;
+                float *dst = output + (mb * HW + i) * C;
+                for (size_t c = 0; c < C; c++)
+                    dst[c] = (static_cast<float>(src[c * HW]) - mean(c, i, HW, meanImage)) * channelScale(c);
+            });
+        }
+    }
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void Subtract(const MKLDNNDims &inputDims, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
@@ -72,7 +138,21 @@ public:
     }
 
 private:
+    float channelMean(size_t c) const {
+        return meanValues.empty() ? 0.f : meanValues[c];
+    }
+
+    float channelScale(size_t c) const {
+        return scaleValues.empty() ? 1.f : scaleValues[c];
+    }
+
+    float mean(size_t c, size_t i, size_t HW, const float *meanImage) const {
+        return meanImage ? meanImage[c * HW + i] : channelMean(c);
+    }
+
     std::vector<float> meanValues;
+    // per channel multipliers applied after mean subtraction, empty if all of them are 1
+    std::vector<float> scaleValues;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
@@ -7,6 +7,14 @@
 #include "ie_parallel.hpp"
 #include "omp_manager.h"
 
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+#if defined(_WIN32) || defined(WIN32)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 using namespace MKLDNNPlugin;
 namespace MKLDNNPlugin {
 namespace cpu {
@@ -43,5 +51,27 @@ int getNumberOfCPUSockets() {return 1;}
 int getNumberOfCPUCores()   {return parallel_get_max_threads();}
 #endif
 
+std::string getCPUBrandString() {
+    std::string brand_string;
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+    unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
+    unsigned int regs[4];
+    for (auto addr : addr_list) {
+        regs[0] = addr;
+#if defined(_WIN32) || defined(WIN32)
+        __cpuid(reinterpret_cast<int*>(regs), regs[0]);
+#else
+        __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+        char *ch = reinterpret_cast<char*>(&regs[0]);
+        for (size_t j = 0; j < sizeof(regs); j++)
+            brand_string += ch[j];
+    }
+#else
+    brand_string = "Non Intel Architecture";
+#endif
+    return brand_string;
+}
+
 }  // namespace cpu
 }  // namespace MKLDNNPlugin
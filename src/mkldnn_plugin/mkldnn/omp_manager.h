@@ -8,6 +8,8 @@
  */
 #pragma once
 
+#include <string>
+
 namespace MKLDNNPlugin {
 namespace cpu {
 
@@ -17,6 +19,8 @@ int getNumberOfCPUSockets();
 // numbers of CPU physical cores on Linux (which is considered to be more performance friendly for servers)
 // (on other OSes it simply relies on the original parallel API of choice, which usually use the logical cores )
 int getNumberOfCPUCores();
+// processor brand string as reported by CPUID ("Non Intel Architecture" on other platforms)
+std::string getCPUBrandString();
 
 }  // namespace cpu
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -21,3 +21,16 @@ void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer() {
     Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
     _callbackManager.enableCallback();
 }
+
+// the same as the default one, but the blobs are checked against the shape buckets of the request
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    auto mkldnnRequest = std::dynamic_pointer_cast<MKLDNNInferRequest>(_syncRequest);
+    if (!mkldnnRequest) {
+        AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+        return;
+    }
+    mkldnnRequest->checkShapeBucketsBlobs();
+    _callbackManager.reset();
+    initNextAsyncTask();
+    startAsyncTask();
+}
@@ -21,6 +21,8 @@ public:
     ~MKLDNNAsyncInferRequest() override;
 
     void Infer() override;
+
+    void StartAsync_ThreadUnsafe() override;
 };
 
 }  // namespace MKLDNNPlugin
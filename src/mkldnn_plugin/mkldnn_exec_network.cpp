@@ -14,6 +14,7 @@
 #include <cpp_interfaces/ie_executor_manager.hpp>
 
 #include <algorithm>
+#include <fstream>
 #include <unordered_set>
 
 using namespace MKLDNNPlugin;
@@ -21,6 +22,25 @@ using namespace MKLDNNPlugin::cpu;
 using namespace InferenceEngine;
 using InferenceEngine::details::CNNNetworkInt8Normalizer;
 
+namespace {
+
+// int8 normalization changes the network with the statistic or FakeQuantize layers only,
+// the unroll passes change it with the recurrent layers only
+bool isChangedByLoadPasses(ICNNNetwork &network) {
+    ICNNNetworkStats* stats = nullptr;
+    if (network.getStats(&stats, nullptr) == StatusCode::OK && stats && !stats->isEmpty())
+        return true;
+    for (details::CNNNetworkIterator it(&network); it != details::CNNNetworkIterator(); it++) {
+        CNNLayer *layer = (*it).get();
+        if (dynamic_cast<QuantizeLayer*>(layer) || dynamic_cast<InferenceEngine::TensorIterator*>(layer) ||
+                dynamic_cast<RNNCellBase*>(layer))
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -32,7 +52,8 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     const MKLDNNGraphCache::Ptr& graphCache) : extensionManager(extMgr) {
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
@@ -48,11 +69,32 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         itLayer++;
     }
 
+    // the network is exported as it is before the int8 normalization and unroll passes, so a copy is kept
+    // only if they change it (layers and data are cloned while blobs are shared)
+    exportNetwork = isChangedByLoadPasses(*clonedNetwork) ? cloneNet(*clonedNetwork) : clonedNetwork;
+
+    // ranges of FakeQuantize layers become the statistic of the cloned network, so quantization aware
+    // trained networks are executed in int8 like the calibrated ones
+    ICNNNetworkStats* clonedStats = nullptr;
+    if (clonedNetwork->getStats(&clonedStats, nullptr) == StatusCode::OK && clonedStats &&
+            CNNNetworkInt8Normalizer::FoldFakeQuantize(*clonedNetwork, *clonedStats)) {
+        s = StatusCode::OK;
+        pstats = clonedStats;
+    }
+
     if (s == StatusCode::OK && pstats && !pstats->isEmpty()) {
         CNNNetworkInt8Normalizer cnnorm;
         cnnorm.NormalizeNetwork(*clonedNetwork, *pstats);
     }
 
+    // graphs of shape buckets are compiled from the network reshaped before the unroll passes
+    InferenceEngine::details::CNNNetworkImplPtr bucketsNetwork;
+    if (!cfg.shapeBuckets.empty()) {
+        if (cfg.throughputStreams > 1)
+            THROW_IE_EXCEPTION << "Shape buckets are not supported for multiple CPU streams";
+        bucketsNetwork = cloneNet(*clonedNetwork);
+    }
+
     MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*clonedNetwork));
 
     if (cfg.batchLimit > 1) {
@@ -75,18 +117,52 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
     std::vector<Task::Ptr> tasks;
     const int workers_per_socket = std::max(1, static_cast<int>(std::ceil(static_cast<float>(cfg.throughputStreams)/sockets)));
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // streams of the socket share one arena sized for all of them, so the threads not needed by idle streams
+    // pick up the parallel work of the busy ones. The concurrency of the arena bounds the threads of this network
+    // only, a slot is reserved for the worker thread of every stream to enter the arena without waiting
+    const bool workStealing = cfg.streamsWorkStealing && cfg.throughputStreams > 1;
+    std::vector<std::shared_ptr<tbb::task_arena>> sharedArenas;
+    std::vector<std::shared_ptr<tbb::task_scheduler_observer>> sharedObservers;
+    if (workStealing) {
+        for (int first_stream = 0; first_stream < cfg.throughputStreams; first_stream += workers_per_socket) {
+            const int group_streams = std::min(workers_per_socket, cfg.throughputStreams - first_stream);
+            std::shared_ptr<tbb::task_arena> arena(new tbb::task_arena(threads_per_stream * group_streams, group_streams));
+            sharedArenas.push_back(arena);
+            if (bPinningRequested) {
+                // the index of the thread in the arena is below its concurrency, so the threads of the group
+                // are pinned to the cores of the group only
+                std::shared_ptr<tbb::task_scheduler_observer> observer(
+                        new pinning_observer(*arena, first_stream, threads_per_stream));
+                observer->observe(true);
+                sharedObservers.push_back(observer);
+            } else {
+                sharedObservers.push_back(nullptr);
+            }
+        }
+    }
+#endif
     for (int n = 0; n < cfg.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
         graphs.push_back(_graph);
+        const int socket = n / workers_per_socket;
         auto task = std::make_shared<InferenceEngine::Task>([=, &cfg]() {
-            _graph->CreateArena(threads_per_stream);
-
-            if (bPinningRequested) {
-                _graph->CreateObserver(n, threads_per_stream);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+            if (workStealing) {
+                _graph->ShareArena(sharedArenas[socket], sharedObservers[socket]);
+            } else {
+#endif
+                _graph->CreateArena(threads_per_stream);
+
+                if (bPinningRequested) {
+                    _graph->CreateObserver(n, threads_per_stream);
+                }
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
             }
+#endif
 
             _graph->setConfig(cfg);
-            int socket = n / workers_per_socket;
+            _graph->setGraphCache(graphCache);
             _graph->CreateGraph(static_cast<ICNNNetwork&>(*clonedNetwork), extensionManager, socket);
             if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
                 MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
@@ -99,9 +175,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks);
     } else {
         if (cfg.exclusiveAsyncRequests) {
-            // special case when all InferRequests are muxed into a single queue
+            // special case when all InferRequests are muxed into a single queue,
+            // producers of all the requests push to the queue without taking a lock
             ExecutorManager *executorManager = ExecutorManager::getInstance();
-            _taskExecutor = executorManager->getExecutor("CPU");
+            _taskExecutor = executorManager->getExecutor("CPU", TaskExecutorType::LOCK_FREE);
         }
         _taskExecutor->startTask(tasks[0]);
         Task::Status sts = tasks[0]->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
@@ -109,6 +186,40 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     for (auto t : tasks)
         t->checkException();
 
+    if (bucketsNetwork) {
+        // the states of the memory layers are kept by the graph of the network shapes only
+        for (auto &node : graphs[0]->GetNodes()) {
+            if (node->getType() == MemoryInput)
+                THROW_IE_EXCEPTION << "Shape buckets are not supported for networks with memory layers";
+        }
+
+        MKLDNNShapeBuckets::Shapes networkShapes;
+        InputsDataMap inputs;
+        bucketsNetwork->getInputsInfo(inputs);
+        for (const auto &input : inputs)
+            networkShapes[input.first] = input.second->getTensorDesc().getDims();
+
+        auto extMgr = extensionManager;
+        auto compiler = [=](const MKLDNNShapeBuckets::Shapes &shapes) {
+            auto network = cloneNet(*bucketsNetwork);
+            ResponseDesc resp;
+            if (network->reshape(shapes, &resp) != StatusCode::OK)
+                THROW_IE_EXCEPTION << "Cannot reshape the network to the shape bucket: " << resp.msg;
+            MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*network));
+
+            // weights are shared with the other graphs by MKLDNNWeightsSharing
+            auto graph = std::make_shared<MKLDNNGraph>();
+            graph->CreateArena(threads_per_stream);
+            if (bPinningRequested)
+                graph->CreateObserver(0, threads_per_stream);
+            graph->setConfig(cfg);
+            graph->CreateGraph(static_cast<ICNNNetwork&>(*network), extMgr);
+            return graph;
+        };
+        shapeBuckets = std::make_shared<MKLDNNShapeBuckets>(MKLDNNShapeBuckets::Parse(cfg.shapeBuckets, networkShapes),
+                                                            networkShapes, graphs[0], compiler);
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -123,7 +234,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store, graphs[0]->GetEdges()));
             }
         }
     }
@@ -149,6 +260,7 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
         if (!mkldnnSyncRequest)
             THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
         mkldnnSyncRequest->SetGraph(graphs[0]);
+        mkldnnSyncRequest->SetShapeBuckets(shapeBuckets);
     }
 }
 
@@ -156,6 +268,17 @@ void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &grap
     graphPtr = graphs[0]->dump();
 }
 
+void MKLDNNExecNetwork::Export(const std::string &modelFileName) {
+    std::ofstream modelFile(modelFileName, std::ios::out | std::ios::binary);
+    if (!modelFile.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " for CPU executable network export";
+
+    MKLDNNGraphCache graphCache;
+    graphs[0]->ExportCache(graphCache);
+    MKLDNNModelSerial::Export(modelFile, *exportNetwork, _networkInputs, _networkOutputs,
+                              graphs[0]->getProperty()._config, graphCache);
+}
+
 void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     Config engConfig = graphs[0]->getProperty();
     auto option = engConfig._config.find(name);
@@ -175,6 +298,18 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(MEMORY_ARENA_SIZE));
+        metrics.push_back(METRIC_KEY(MEMORY_ARENA_SIZE_GREEDY));
+        metrics.push_back(METRIC_KEY(MEMORY_ARENA_LOWER_BOUND));
+        if (std::dynamic_pointer_cast<MultiWorkerTaskExecutor>(_taskExecutor)) {
+            metrics.push_back(METRIC_KEY(STREAMS_UTILIZATION));
+            metrics.push_back(METRIC_KEY(STREAMS_EXECUTED_REQUESTS));
+        }
+        if (shapeBuckets) {
+            metrics.push_back(METRIC_KEY(SHAPE_BUCKETS_HITS));
+            metrics.push_back(METRIC_KEY(SHAPE_BUCKETS_MISSES));
+            metrics.push_back(METRIC_KEY(SHAPE_BUCKETS_PADDED_REQUESTS));
+        }
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -187,6 +322,32 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
         IE_ASSERT(option != engConfig._config.end());
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(std::stoi(option->second)));
+    } else if (name == METRIC_KEY(MEMORY_ARENA_SIZE)) {
+        result = IE_SET_METRIC(MEMORY_ARENA_SIZE, static_cast<uint64_t>(graphs[0]->GetMemoryArenaInfo().size));
+    } else if (name == METRIC_KEY(MEMORY_ARENA_SIZE_GREEDY)) {
+        result = IE_SET_METRIC(MEMORY_ARENA_SIZE_GREEDY, static_cast<uint64_t>(graphs[0]->GetMemoryArenaInfo().greedySize));
+    } else if (name == METRIC_KEY(MEMORY_ARENA_LOWER_BOUND)) {
+        result = IE_SET_METRIC(MEMORY_ARENA_LOWER_BOUND, static_cast<uint64_t>(graphs[0]->GetMemoryArenaInfo().lowerBound));
+    } else if ((name == METRIC_KEY(STREAMS_UTILIZATION) || name == METRIC_KEY(STREAMS_EXECUTED_REQUESTS))
+               && std::dynamic_pointer_cast<MultiWorkerTaskExecutor>(_taskExecutor)) {
+        auto utilization = std::dynamic_pointer_cast<MultiWorkerTaskExecutor>(_taskExecutor)->getStreamsUtilization();
+        if (name == METRIC_KEY(STREAMS_UTILIZATION)) {
+            std::vector<float> busyRatio;
+            for (auto &stream : utilization)
+                busyRatio.push_back(stream.busyRatio);
+            result = IE_SET_METRIC(STREAMS_UTILIZATION, busyRatio);
+        } else {
+            std::vector<uint64_t> executedTasks;
+            for (auto &stream : utilization)
+                executedTasks.push_back(stream.executedTasks);
+            result = IE_SET_METRIC(STREAMS_EXECUTED_REQUESTS, executedTasks);
+        }
+    } else if (name == METRIC_KEY(SHAPE_BUCKETS_HITS) && shapeBuckets) {
+        result = IE_SET_METRIC(SHAPE_BUCKETS_HITS, shapeBuckets->GetStatistics().hits);
+    } else if (name == METRIC_KEY(SHAPE_BUCKETS_MISSES) && shapeBuckets) {
+        result = IE_SET_METRIC(SHAPE_BUCKETS_MISSES, shapeBuckets->GetStatistics().misses);
+    } else if (name == METRIC_KEY(SHAPE_BUCKETS_PADDED_REQUESTS) && shapeBuckets) {
+        result = IE_SET_METRIC(SHAPE_BUCKETS_PADDED_REQUESTS, shapeBuckets->GetStatistics().padded);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -8,6 +8,9 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_model_serial.h"
+#include "mkldnn_shape_buckets.h"
+#include <cnn_network_impl.hpp>
 
 #include <vector>
 #include <memory>
@@ -27,9 +30,11 @@ public:
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr& extMgr);
+                      const MKLDNNExtensionManager::Ptr& extMgr,
+                      const MKLDNNGraphCache::Ptr& graphCache = nullptr);
 
     virtual ~MKLDNNExecNetwork() {
+        shapeBuckets.reset();
         graphs.clear();
         extensionManager.reset();
     }
@@ -42,12 +47,18 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    void Export(const std::string &modelFileName) override;
+
     std::vector<IMemoryStateInternal::Ptr> QueryState() override;
 
 protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<MKLDNNGraph::Ptr> graphs;
     std::vector<IMemoryStateInternal::Ptr> memoryStates;
+    // graphs of the input shapes besides the network ones, compiled on demand (single stream only)
+    MKLDNNShapeBuckets::Ptr shapeBuckets;
+    // network the graphs are compiled from, before int8 normalization and unroll passes (used for Export)
+    InferenceEngine::details::CNNNetworkImplPtr exportNetwork;
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
 };
@@ -339,6 +339,8 @@ void MKLDNNGraph::InitGraph() {
 
     SortTopologically();
 
+    InitExecutionStages();
+
     Allocate();
 
     CreatePrimitives();
@@ -369,6 +371,13 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+    // compiled state of imported network is needed for primitives creation only
+    if (graphCache) {
+        for (auto &graphNode : graphNodes)
+            graphNode->setCachedState(nullptr, 0);
+        graphCache.reset();
+    }
+
 #if !defined(NDEBUG) && defined(PRINT_GRAPH_INFO)
     for (auto &graphNode : graphNodes) {
         std::cout << "name: " << graphNode->getName() << " [ ";
@@ -408,7 +417,13 @@ void MKLDNNGraph::InitNodes() {
     }
 
     for (auto &node : graphNodes) {
-        node->selectOptimalPrimitiveDescriptor();
+        const MKLDNNGraphCache::NodeState *state = graphCache ? graphCache->find(node->getName()) : nullptr;
+        if (state && state->selectedPrimitiveDescriptor >= 0 &&
+                state->selectedPrimitiveDescriptor < node->getSupportedPrimitiveDescriptors().size()) {
+            node->selectPrimitiveDescriptorByIndex(state->selectedPrimitiveDescriptor);
+        } else {
+            node->selectOptimalPrimitiveDescriptor();
+        }
     }
 }
 
@@ -476,6 +491,69 @@ void MKLDNNGraph::InitEdges() {
     }
 }
 
+void MKLDNNGraph::InitExecutionStages() {
+    executionStages.clear();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return;
+
+    // Memory layers pass the state outside of the data flow, so they rely on the sequential order
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    // Stage of the node is the length of the longest path to it from the graph inputs.
+    // Nodes of the same stage don't depend on each other.
+    for (auto &node : graphNodes) {
+        int stage = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            stage = std::max(stage, node->getParentEdgeAt(i)->getParent()->execStage + 1);
+        node->execStage = stage;
+
+        if (executionStages.size() <= static_cast<size_t>(stage))
+            executionStages.resize(stage + 1);
+        executionStages[stage].push_back(node);
+    }
+
+    bool hasParallelStage = false;
+    for (auto &stage : executionStages) {
+        size_t toExecute = std::count_if(stage.begin(), stage.end(),
+                                         [](const MKLDNNNodePtr &node) { return !node->isConstant(); });
+        hasParallelStage |= toExecute > 1;
+    }
+    if (!hasParallelStage)
+        executionStages.clear();
+#endif
+}
+
+void MKLDNNGraph::InitLoopInvariantNodes(const std::unordered_set<MKLDNNNode*> &variantNodes) {
+    loopInvariantNodes.clear();
+    if (loopInvariantInputs.empty())
+        return;
+
+    for (auto &input : inputNodes) {
+        if (loopInvariantInputs.find(input.first) != loopInvariantInputs.end() &&
+                variantNodes.find(input.second.get()) == variantNodes.end())
+            loopInvariantNodes.insert(input.second.get());
+    }
+
+    // nodes are sorted topologically, so parents are already visited
+    for (auto &node : graphNodes) {
+        if (node->isConstant() || node->getParentEdges().empty() || variantNodes.find(node.get()) != variantNodes.end() ||
+                node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            continue;
+
+        bool isInvariant = true;
+        for (size_t i = 0; isInvariant && i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            isInvariant = parent->isConstant() || loopInvariantNodes.find(parent.get()) != loopInvariantNodes.end();
+        }
+        if (isInvariant)
+            loopInvariantNodes.insert(node.get());
+    }
+}
+
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
@@ -548,6 +626,33 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
+    // Loop invariant data is computed on the first iteration only, so the nodes executed on every iteration
+    // can't share memory with it. Such invariant nodes are moved to the variant ones with all their consumers.
+    std::unordered_set<MKLDNNNode*> variantNodes;
+    for (bool changed = true; changed;) {
+        changed = false;
+        InitLoopInvariantNodes(variantNodes);
+        if (loopInvariantNodes.empty())
+            break;
+
+        for (auto &claster : edge_clasters) {
+            bool withVariant = false;
+            for (auto &edge : claster) {
+                auto parent = edge->getParent();
+                withVariant |= !parent->isConstant() && !IsLoopInvariant(parent);
+            }
+            if (!withVariant)
+                continue;
+
+            for (auto &edge : claster) {
+                if (IsLoopInvariant(edge->getParent())) {
+                    variantNodes.insert(edge->getParent().get());
+                    changed = true;
+                }
+            }
+        }
+    }
+
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
@@ -555,8 +660,9 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // nodes of the same stage may be executed simultaneously, so stage is a time unit for parallel execution
+            int e_start = IsParallelExecution() ? edge->getParent()->execStage : edge->getParent()->execIndex;
+            int e_finish = IsParallelExecution() ? edge->getChild()->execStage : edge->getChild()->execIndex;
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -583,6 +689,9 @@ void MKLDNNGraph::AllocateWithReuse() {
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
+
+            // loop invariant data is read on all iterations
+            isConst |= IsLoopInvariant(edge->getParent()) && !IsLoopInvariant(edge->getChild());
         }
 
         if (reuse_io_tensors) {
@@ -598,8 +707,17 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    // the best fit placement is not always better than the greedy one, so take the smallest of both
+    MemorySolver greedySolver(boxes);
+    MemorySolver bestFitSolver(boxes, MemorySolver::Strategy::BEST_FIT);
+    int64_t greedySize = greedySolver.solve();
+    int64_t bestFitSize = bestFitSolver.solve();
+    MemorySolver &memSolver = bestFitSize <= greedySize ? bestFitSolver : greedySolver;
+    size_t total_size = static_cast<size_t>(std::min(greedySize, bestFitSize)) * alignment;
+
+    memArenaInfo.size = total_size;
+    memArenaInfo.greedySize = static_cast<size_t>(greedySize) * alignment;
+    memArenaInfo.lowerBound = static_cast<size_t>(memSolver.maxDepth()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -648,6 +766,8 @@ void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::Crea
     for (auto& node : graphNodes) {
         // disable caching if graph was created only once
         node->enableWeightCaching(weights_caching);
+        if (graphCache)
+            node->setCachedState(graphCache->find(node->getName()), graphCache->getId());
         node->createPrimitive();
     }
 }
@@ -655,6 +775,14 @@ void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::Crea
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
+    if (in->getTensorDesc().getPrecision() == Precision::U16) {
+        // U16 is unsupported by mkldnn, so the data is converted to FP32 in the buffer of the graph
+        auto iconv = GetConvertedInput(name, in->getTensorDesc());
+        copyToFloat<uint16_t>(iconv->buffer().as<float *>(), in.get());
+        PushInputData(name, iconv);
+        return;
+    }
+
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
@@ -662,6 +790,10 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
+        if (ext_data_ptr != inter_data_ptr && PushInputDataWithMean(name, in)) {
+            return;
+        }
+
         if (ext_data_ptr != inter_data_ptr) {
             auto l = in->getTensorDesc().getLayout();
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
@@ -674,8 +806,11 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
 
         // todo: make sure 'name' exists in this map...
         if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
+            // input with mean image is FP32 inside the graph, integer data is converted by the reorder above
+            auto &inter_mem = input->second->getChildEdgeAt(0)->getMemory();
+            if (inter_mem.GetDataType() == mkldnn::memory::f32) {
+                auto inter_layout = inter_mem.GetFormat() == mkldnn::memory::nhwc ? NHWC : NCHW;
+                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), inter_layout);
             } else {
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
             }
@@ -685,6 +820,55 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+InferenceEngine::Blob::Ptr MKLDNNGraph::GetConvertedInput(const std::string& name, const TensorDesc& desc) {
+    auto &iconv = convertedInputs[name];
+    if (!iconv || iconv->getTensorDesc().getDims() != desc.getDims()
+               || iconv->getTensorDesc().getLayout() != desc.getLayout()) {
+        iconv = make_shared_blob<float>({Precision::FP32, desc.getDims(), desc.getLayout()});
+        iconv->allocate();
+    }
+    return iconv;
+}
+
+bool MKLDNNGraph::PushInputDataWithMean(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+    auto meanImage = _meanImages.find(name);
+    if (meanImage == _meanImages.end())
+        return false;
+
+    auto &inter_mem = inputNodes[name]->getChildEdgeAt(0)->getMemory();
+    const MKLDNNDims &dims = inputNodes[name]->getChildEdgeAt(0)->getDims();
+    auto inter_format = inter_mem.GetFormat();
+    if (inter_mem.GetDataType() != mkldnn::memory::f32 || dims.ndims() != 4 ||
+        (inter_format != mkldnn::memory::nchw && inter_format != mkldnn::memory::nhwc) ||
+        in->size() != static_cast<size_t>(dims.size()))
+        return false;
+
+    auto in_layout = in->getTensorDesc().getLayout();
+    if (in_layout == CHW)
+        in_layout = NCHW;
+    if (in_layout != NCHW && in_layout != NHWC)
+        return false;
+
+    auto inter_layout = inter_format == mkldnn::memory::nhwc ? NHWC : NCHW;
+    auto *inter_data = reinterpret_cast<float *>(inter_mem.GetData());
+    switch (in->getTensorDesc().getPrecision()) {
+        case Precision::FP32:
+            meanImage->second.Convert(dims, in->cbuffer().as<const float *>(), in_layout, inter_data, inter_layout);
+            return true;
+        case Precision::U8:
+            meanImage->second.Convert(dims, in->cbuffer().as<const uint8_t *>(), in_layout, inter_data, inter_layout);
+            return true;
+        case Precision::I8:
+            meanImage->second.Convert(dims, in->cbuffer().as<const int8_t *>(), in_layout, inter_data, inter_layout);
+            return true;
+        case Precision::I16:
+            meanImage->second.Convert(dims, in->cbuffer().as<const int16_t *>(), in_layout, inter_data, inter_layout);
+            return true;
+        default:
+            return false;
+    }
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
@@ -735,6 +919,12 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    if (IsParallelExecution()) {
+        InferStages(batch);
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
         PERF(graphNodes[i]);
@@ -755,6 +945,49 @@ void MKLDNNGraph::Infer(int batch) {
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::InferLoopVariant(int batch) {
+    if (!IsReady()) {
+        THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
+    }
+
+    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    for (auto &node : graphNodes) {
+        if (node->isConstant() || IsLoopInvariant(node))
+            continue;
+
+        PERF(node);
+
+        if (batch > 0)
+            node->setDynamicBatchLim(batch);
+
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        node->execute(stream);
+    }
+
+    if (infer_count != -1) infer_count++;
+}
+
+void MKLDNNGraph::InferStages(int batch) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    for (auto &stage : executionStages) {
+        // nodes use nested parallel_for, so TBB balances the threads of the arena between branches and node internals
+        tbb::parallel_for(size_t(0), stage.size(), [&](size_t i) {
+            auto &node = stage[i];
+            PERF(node);
+
+            if (batch > 0)
+                node->setDynamicBatchLim(batch);
+
+            if (!node->isConstant()) {
+                IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+                mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+                node->execute(stream);
+            }
+        });
+    }
+#endif
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -868,6 +1101,28 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         getPerfMapFor(perfMap, graphNodes[i]);
     }
 
+    if (IsParallelExecution()) {
+        // Pseudo counter for the parallel execution: real time is the length of the critical path
+        // (the slowest node of each stage), cpu time is the total time of all nodes
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["critical_path"];
+        pc.execution_index = i++;
+        pc.cpu_uSec = pc.realTime_uSec = 0;
+        for (auto &stage : executionStages) {
+            long long stageTime = 0;
+            for (auto &node : stage) {
+                auto nodeTime = static_cast<long long>(node->PerfCounter().avg());
+                stageTime = std::max(stageTime, nodeTime);
+                pc.cpu_uSec += nodeTime;
+            }
+            pc.realTime_uSec += stageTime;
+        }
+        pc.status = pc.realTime_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                         : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        std::string("parallel_stages_" + std::to_string(executionStages.size()))
+                .copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("CriticalPath").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    }
+
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
@@ -883,6 +1138,18 @@ Config MKLDNNGraph::getProperty() {
     return config;
 }
 
+void MKLDNNGraph::ExportCache(MKLDNNGraphCache &cache) const {
+    for (auto &node : graphNodes) {
+        MKLDNNGraphCache::NodeState state;
+        state.selectedPrimitiveDescriptor = node->selectedPrimitiveDescriptorIndex;
+        for (auto &memory : node->internalBlobMemory) {
+            auto data = static_cast<const uint8_t *>(memory->GetData());
+            state.internalBlobs.emplace_back(data, data + memory->GetPrimitiveDescriptor().get_size());
+        }
+        cache.add(node->getName(), std::move(state));
+    }
+}
+
 void MKLDNNGraph::getInputBlobs(InferenceEngine::BlobMap &resp) {
     for (auto &it : inputNodes) {
         MKLDNNInputNode* node = dynamic_cast<MKLDNNInputNode*>(it.second.get());
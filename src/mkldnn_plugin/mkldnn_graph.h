@@ -16,6 +16,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <set>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 
@@ -40,6 +42,10 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    void setGraphCache(const MKLDNNGraphCache::Ptr &cache) {
+        graphCache = cache;
+    }
+    void ExportCache(MKLDNNGraphCache &cache) const;
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
@@ -56,10 +62,26 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    // returns FP32 blob to convert the input unsupported by mkldnn (U16) in PushInputData,
+    // shared by all requests running on the graph
+    InferenceEngine::Blob::Ptr GetConvertedInput(const std::string& name, const InferenceEngine::TensorDesc& desc);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
 
+    // Inputs of the TensorIterator body keeping the same data during all iterations, must be set before CreateGraph().
+    // Nodes depending only on them and on constants are loop invariant and their outputs aren't reused by other nodes.
+    void SetLoopInvariantInputs(const std::vector<std::string> &names) {
+        loopInvariantInputs = std::set<std::string>(names.begin(), names.end());
+    }
+
+    bool IsLoopInvariant(const MKLDNNNodePtr &node) const {
+        return loopInvariantNodes.find(node.get()) != loopInvariantNodes.end();
+    }
+
+    // executes all nodes except the loop invariant ones, their outputs are kept from the previous Infer()
+    void InferLoopVariant(int batch = -1);
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -78,6 +100,21 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    bool IsParallelExecution() const {
+        return !executionStages.empty();
+    }
+
+    // sizes in bytes of the memory shared by intermediate tensors
+    struct MemoryArenaInfo {
+        size_t size = 0;          // size taken by the graph
+        size_t greedySize = 0;    // size which the greedy by size placement requires
+        size_t lowerBound = 0;    // max size of tensors alive at the same time
+    };
+
+    const MemoryArenaInfo& GetMemoryArenaInfo() const {
+        return memArenaInfo;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -86,10 +123,20 @@ public:
         #if IE_THREAD == IE_THREAD_OMP
         omp_set_num_threads(threads_per_stream);
         #elif(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-        ptrArena = std::unique_ptr<tbb::task_arena>(new tbb::task_arena(threads_per_stream));
+        ptrArena = std::shared_ptr<tbb::task_arena>(new tbb::task_arena(threads_per_stream));
         #endif
     }
 
+    #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the arena (and the observer pinning its threads) is shared by the streams borrowing threads of each other,
+    // the observer stays enabled while the graphs exist: switching it per request would affect the other streams
+    void ShareArena(const std::shared_ptr<tbb::task_arena> &arena,
+                    const std::shared_ptr<tbb::task_scheduler_observer> &observer) {
+        ptrArena = arena;
+        ptrSharedObserver = observer;
+    }
+    #endif
+
     void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1) {
         #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         ptrObserver
@@ -130,10 +177,15 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionStages.clear();
+        memArenaInfo = MemoryArenaInfo();
+        loopInvariantNodes.clear();
+        convertedInputs.clear();
         _meanImages.clear();
     }
     Status status;
     Config config;
+    MKLDNNGraphCache::Ptr graphCache;
 
     // For dumping purposes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
@@ -142,18 +194,26 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MemoryArenaInfo memArenaInfo;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    // groups of independent nodes, filled only if parallel execution of branches is enabled
+    std::vector<std::vector<MKLDNNNodePtr>> executionStages;
 
     std::map<std::string, MeanImage> _meanImages;
+    std::map<std::string, InferenceEngine::Blob::Ptr> convertedInputs;
     std::string _name;
 
+    std::set<std::string> loopInvariantInputs;
+    std::unordered_set<MKLDNNNode*> loopInvariantNodes;
+
     #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-    std::unique_ptr<tbb::task_arena> ptrArena;
+    std::shared_ptr<tbb::task_arena> ptrArena;
     std::unique_ptr<tbb::task_scheduler_observer> ptrObserver;
+    std::shared_ptr<tbb::task_scheduler_observer> ptrSharedObserver;
     #endif
     mkldnn::engine eng;
 
@@ -162,10 +222,16 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitEdges();
+    void InitExecutionStages();
+    void InitLoopInvariantNodes(const std::unordered_set<MKLDNNNode*> &variantNodes);
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
 
+    void InferStages(int batch);
+    // fills the input converting it and applying the mean image in one pass, returns false if it's not applicable
+    bool PushInputDataWithMean(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
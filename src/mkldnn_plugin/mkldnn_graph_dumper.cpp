@@ -171,6 +171,15 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     }
 
     layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
+
+    // e.g. the concatenations which are not in-place copy their inputs
+    bool inPlace = false;
+    const auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+    for (const auto &inConf : config.inConfs)
+        inPlace = inPlace || inConf.inPlace >= 0;
+    for (const auto &outConf : config.outConfs)
+        inPlace = inPlace || outConf.inPlace >= 0;
+    layer->params[ExecGraphInfoSerialization::IN_PLACE] = inPlace ? "true" : "false";
 }
 
 void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
@@ -15,6 +15,7 @@
 #include "nodes/mkldnn_conv_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "nodes/mkldnn_generic_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -56,12 +57,18 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseGenericAndPostOps(graph);
+    graph.RemoveDroppedNodes();
+
     RemoveIdentityOperator(graph);
     graph.RemoveDroppedNodes();
 
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseEltwiseChains(graph);
+    graph.RemoveDroppedNodes();
+
 
     graph.RemoveDroppedEdges();
 }
@@ -677,6 +684,140 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
     }
 }
 
+/*
+ *  Activations, ScaleShifts and FakeQuantizes following an extension layer are applied by
+ *  the extension implementation to its output if all implementations of the layer support them.
+ */
+void MKLDNNGraphOptimizer::FuseGenericAndPostOps(MKLDNNGraph &graph) {
+    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
+        auto& edges = graph.GetEdges();
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            if ((*it) == edge) {
+                edges.erase(it);
+                return;
+            }
+        }
+    };
+
+    auto& graphNodes = graph.GetNodes();
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto* genericNode = dynamic_cast<MKLDNNGenericNode *>(graphNodes[i].get());
+        if (genericNode == nullptr)
+            continue;
+
+        // chains like Normalize -> ScaleShift -> ReLU are fused node by node
+        while (genericNode->getChildEdges().size() == 1) {
+            auto child = genericNode->getChildEdgeAt(0)->getChild();
+            if (!genericNode->canFuse(child))
+                break;
+
+            genericNode->fusePostOp(child);
+
+            // the constant ranges of Quantize are kept by the post operation
+            auto parents = child->parentEdges;
+            for (size_t j = 0; j < parents.size(); j++) {
+                auto p_edge = parents[j].lock();
+                if (p_edge->getParent() == graphNodes[i])
+                    continue;
+
+                p_edge->drop();
+                removeEdge(graph, p_edge);
+            }
+
+            graph.DropNode(child);
+        }
+    }
+}
+
+/*
+ *  Before:                            After:
+ *
+ *     ***   ***                          ***   ***   ***
+ *      |     |                            |     |     |
+ *   +=========+                        +===============+
+ *   | Eltwise |                        |    Eltwise    |
+ *   +=========+   ***                  |       +       |
+ *        |         |                   |     [Relu]    |
+ *     [Relu]       |                   |       +       |
+ *        |         |                   |    Eltwise    |
+ *      +=============+                 +===============+
+ *      |   Eltwise   |                         |
+ *      +=============+                        ***
+ *             |
+ *            ***
+ *
+ *  The whole chain is computed by the JIT kernel of the first Eltwise node in a single pass over memory.
+ */
+void MKLDNNGraphOptimizer::FuseEltwiseChains(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
+        for (auto a : algs) {
+            if (alg == a) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto isFusingSupported = [&](MKLDNNNodePtr activation) {
+        if (!activation->getCnnLayer() || activation->getCnnLayer()->precision != Precision::FP32)
+            return false;
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(activation.get());
+
+        return activationNode &&
+            isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_tanh, eltwise_elu, eltwise_square, eltwise_abs,
+                                                     eltwise_sqrt, eltwise_linear, eltwise_bounded_relu, eltwise_soft_relu,
+                                                     eltwise_logistic, eltwise_clamp, eltwise_exp});
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(graphNodes[i]);
+        if (!eltwise || eltwise->isDropped() || !eltwise->isJitSupported())
+            continue;
+
+        while (eltwise->getChildEdges().size() == 1) {
+            auto child = eltwise->getChildEdgeAt(0)->getChild();
+
+            if (child->getType() == Activation) {
+                if (!isFusingSupported(child))
+                    break;
+
+                eltwise->fuseWith(child);
+                graph.DropNode(child);
+                continue;
+            }
+
+            auto childEltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(child);
+            if (!childEltwise || childEltwise->getParentEdges().size() != 2 || !childEltwise->isJitSupported() ||
+                    eltwise->getParentEdges().size() + 1 > MKLDNNEltwiseNode::maxJitInputs ||
+                    childEltwise->getChildEdgeAt(0)->getDims() != eltwise->getChildEdgeAt(0)->getDims())
+                break;
+
+            auto peerEdge = childEltwise->getParentEdgeAt(0)->getParent() == eltwise ?
+                            childEltwise->getParentEdgeAt(1) : childEltwise->getParentEdgeAt(0);
+            auto peer = peerEdge->getParent();
+            // the peer input has to be ready before the fused chain is started
+            if (peer == eltwise || is_data_dependency(eltwise, peer))
+                break;
+
+            auto peerDims = peerEdge->getDims();
+            int peerPort = peerEdge->getInputNum();
+            peerEdge->drop();
+
+            MKLDNNEdgePtr edgePtr(new MKLDNNEdge(peer, eltwise, peerPort, eltwise->getParentEdges().size()));
+            graph.GetEdges().push_back(edgePtr);
+            eltwise->addEdge(edgePtr);
+            eltwise->inDims.push_back(peerDims);
+
+            eltwise->fuseWith(child);
+            graph.DropNode(child);
+        }
+    }
+}
+
 void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
         bool toDrop = false;
@@ -27,6 +27,8 @@ private:
     void FuseBatchNormWithScale(MKLDNNGraph& graph);
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
     void FuseFullyConnectedAndActivation(MKLDNNGraph &graph);
+    void FuseEltwiseChains(MKLDNNGraph &graph);
+    void FuseGenericAndPostOps(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
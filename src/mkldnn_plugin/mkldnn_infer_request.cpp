@@ -37,22 +37,25 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     if (!graph || !graph->IsReady()) {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
-    auto infer = [this] {
+    InferenceEngine::BlobMap padded;
+    if (shapeBuckets)
+        padded = selectShapeBucket();
+
+    auto infer = [this, &padded] {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
         changeDefaultPtr();
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                    << input.first;
             }
+            auto paddedInput = padded.find(input.first);
+            if (paddedInput != padded.end())
+                input.second = paddedInput->second;
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
                     pushInput<float>(input.first, input.second);
@@ -64,53 +67,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                     pushInput<int8_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                      input.second->getTensorDesc().getDims(),
-                                                                      input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    // U16 is unsupported by mkldnn, the graph converts it to FP32 in its own buffer
+                    pushInput<uint16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
+                    // If a mean image exists, the input reorder converts I16 to FP32 in place of the graph input
+                    pushInput<int16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    // The same for U8: the conversion is fused with the layout change in the input reorder
+                    pushInput<uint8_t>(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
@@ -128,6 +94,69 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 #endif
 }
 
+InferenceEngine::BlobMap MKLDNNPlugin::MKLDNNInferRequest::selectShapeBucket() {
+    MKLDNNShapeBuckets::Shapes shapes, bucketShapes;
+    for (const auto& input : _inputs)
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    graph = shapeBuckets->GetGraph(shapes, bucketShapes);
+
+    InferenceEngine::BlobMap padded;
+    for (const auto& input : _inputs) {
+        const auto& desc = input.second->getTensorDesc();
+        const auto& dims = bucketShapes[input.first];
+        if (desc.getDims() == dims)
+            continue;
+
+        InferenceEngine::TensorDesc paddedDesc(desc.getPrecision(), dims, desc.getLayout());
+        auto& paddedInput = paddedInputs[input.first];
+        if (!paddedInput || paddedInput->getTensorDesc() != paddedDesc) {
+            paddedInput = make_blob_with_precision(paddedDesc);
+            paddedInput->allocate();
+        }
+        MKLDNNShapeBuckets::Pad(input.second, paddedInput);
+        padded[input.first] = paddedInput;
+    }
+
+    // outputs of other shapes are replaced, so the outputs of the bucket are got by GetBlob() after the inference
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (const auto& it : blobs) {
+        auto output = _outputs.find(it.first);
+        if (output == _outputs.end() || output->second->getTensorDesc().getDims() == it.second->getTensorDesc().getDims())
+            continue;
+
+        output->second = make_blob_with_precision(it.second->getTensorDesc());
+        output->second->allocate();
+        if (it.second->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+                !graph->getProperty().batchLimit) {
+            externalPtr[it.first] = output->second->buffer();
+        } else {
+            externalPtr.erase(it.first);
+        }
+    }
+    return padded;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::Infer() {
+    checkShapeBucketsBlobs();
+    InferImpl();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkShapeBucketsBlobs() const {
+    if (!shapeBuckets) {
+        checkBlobs();
+        return;
+    }
+    // the shapes of the inputs are checked by the shape buckets, the outputs are replaced if their shapes differ
+    for (auto const &input : _inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        checkBlob(input.second, input.first, true,
+                  shapeBuckets->IsCovered(input.first, dims) ? dims : InferenceEngine::SizeVector());
+    }
+    for (auto const &output : _outputs)
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
@@ -152,7 +181,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            const auto& dims = data->getTensorDesc().getDims();
+            checkBlob(data, name, true,
+                      shapeBuckets && shapeBuckets->IsCovered(name, dims) ? dims : InferenceEngine::SizeVector());
             return;
         }
 
@@ -182,7 +213,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            // outputs have the shapes of the graph of the last used shape bucket
+            checkBlob(data, name, false, shapeBuckets ? blobs[name]->getTensorDesc().getDims() : InferenceEngine::SizeVector());
             return;
         }
 
@@ -234,12 +266,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             _preProcData[name].setRoiBlob(data);
         } else {
             size_t inputSize = InferenceEngine::details::product(foundInput->getTensorDesc().getDims());
-            if (dataSize != inputSize) {
+            const bool bucketed = shapeBuckets && shapeBuckets->IsCovered(name, data->getTensorDesc().getDims());
+            if (dataSize != inputSize && !bucketed) {
                 THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims() && !bucketed) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
             }
 
@@ -288,6 +321,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (input != graph->inputNodes.end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
+            // the blob smaller than the input of the shape bucket is padded into another one
+            if (shapeBuckets && _inputs[it.first]->getTensorDesc().getDims() !=
+                    input->second->getChildEdgeAt(0)->getDims().ToSizeVector())
+                continue;
             // Input cannot be in-place with other primitives
             bool canBeInPlace = true;
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
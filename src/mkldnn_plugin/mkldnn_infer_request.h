@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_shape_buckets.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -40,11 +41,23 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void SetShapeBuckets(const MKLDNNShapeBuckets::Ptr& buckets) {
+        shapeBuckets = buckets;
+    }
+
+    // the blobs of the shape buckets don't have the shapes of the network, the other checks are the common ones
+    void Infer() override;
+    void checkShapeBucketsBlobs() const;
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
     void changeDefaultPtr();
+    // switches to the graph of the shape bucket of the inputs, returns the padded inputs to push instead of the set ones
+    InferenceEngine::BlobMap selectShapeBucket();
     MKLDNNGraph::Ptr graph;
     std::map<std::string, void*> externalPtr;
+    MKLDNNShapeBuckets::Ptr shapeBuckets;
+    InferenceEngine::BlobMap paddedInputs;
 };
 }  // namespace MKLDNNPlugin
@@ -814,8 +814,9 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
     }
 
     if (notDefault) {
+        // the i-th blocked dimension is the order[i] dimension of the tensor, as in the cast to TensorDesc
         for (size_t i = 0; i < strides.size() && i < desc.data.ndims; i++) {
-            desc.data.layout_desc.blocking.strides[0][i] = static_cast<ptrdiff_t>(strides[order[i]]);
+            desc.data.layout_desc.blocking.strides[0][order[i]] = static_cast<ptrdiff_t>(strides[i]);
         }
     }
 }
@@ -7,12 +7,15 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Strategy strategy) : _boxes(boxes), _strategy(strategy) {
     int max_ts = 0;
     for (const Box &box : _boxes) max_ts = std::max(std::max(max_ts, box.start), box.finish);
     for (Box &box : _boxes) if (box.finish == -1) box.finish = max_ts;
@@ -53,6 +56,11 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
 
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+    _offsets.clear();
+    return _strategy == Strategy::BEST_FIT ? solveBestFit() : solveGreedyBySize();
+}
+
+int64_t MemorySolver::solveGreedyBySize() {
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
@@ -91,6 +99,61 @@ int64_t MemorySolver::solve() {
     return _min_required;
 }
 
+int64_t MemorySolver::solveBestFit() {
+    typedef std::function<bool(const Box&, const Box&)> Order;
+    auto duration = [](const Box& b) { return static_cast<int64_t>(b.finish - b.start + 1); };
+    const std::vector<Order> orders = {
+        [](const Box& l, const Box& r) { return l.size > r.size; },
+        [&](const Box& l, const Box& r) { return l.size * duration(l) > r.size * duration(r); },
+        [&](const Box& l, const Box& r) { return duration(l) > duration(r) || (duration(l) == duration(r) && l.size > r.size); },
+        [](const Box& l, const Box& r) { return l.start < r.start || (l.start == r.start && l.size > r.size); }
+    };
+
+    int64_t best_required = -1;
+    std::vector<Box> boxes = _boxes;
+    std::vector<int64_t> offsets(boxes.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) on the Mem axis
+    for (const auto &order : orders) {
+        std::stable_sort(boxes.begin(), boxes.end(), order);
+
+        int64_t required = 0;
+        for (size_t i = 0; i < boxes.size(); i++) {
+            const Box &box = boxes[i];
+            // memory taken by placed boxes which are alive at the same time
+            busy.clear();
+            for (size_t j = 0; j < i; j++) {
+                if (boxes[j].start <= box.finish && box.start <= boxes[j].finish)
+                    busy.emplace_back(offsets[j], offsets[j] + boxes[j].size);
+            }
+            std::sort(busy.begin(), busy.end());
+
+            // the smallest gap which fits the box, or the top of busy memory
+            int64_t best_offset = -1, best_gap = std::numeric_limits<int64_t>::max();
+            int64_t gap_begin = 0;
+            for (const auto &b : busy) {
+                if (b.first > gap_begin) {
+                    int64_t gap = b.first - gap_begin;
+                    if (gap >= box.size && gap < best_gap) {
+                        best_gap = gap;
+                        best_offset = gap_begin;
+                    }
+                }
+                gap_begin = std::max(gap_begin, b.second);
+            }
+            offsets[i] = best_offset != -1 ? best_offset : gap_begin;
+            required = std::max(required, offsets[i] + box.size);
+        }
+
+        if (best_required == -1 || required < best_required) {
+            best_required = required;
+            for (size_t i = 0; i < boxes.size(); i++)
+                _offsets[boxes[i].id] = offsets[i];
+        }
+    }
+
+    return std::max<int64_t>(best_required, 0);
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
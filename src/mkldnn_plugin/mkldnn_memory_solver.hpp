@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -63,7 +64,22 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief Algorithm of box placement */
+    enum class Strategy {
+        /**
+         * Boxes are placed from the biggest one, each box is lifted up
+         * over all intersecting boxes placed before.
+         */
+        GREEDY_BY_SIZE,
+        /**
+         * Each box is placed into the smallest gap between boxes alive at the same time
+         * which fits it. Several orders of placement are tried (by size, by live time,
+         * by size * live time, by start time), the best one is taken.
+         */
+        BEST_FIT
+    };
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Strategy strategy = Strategy::GREEDY_BY_SIZE);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -82,11 +98,14 @@ public:
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
+    Strategy _strategy;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveGreedyBySize();
+    int64_t solveBestFit();
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,11 +4,38 @@
 
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
+#include <blob_factory.hpp>
+
+#include <cstring>
 
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+MKLDNNMemoryState::MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage, const std::vector<MKLDNNEdgePtr> &edges) :
+        name(name), storage(storage) {
+    // The state is kept in an immortal edge cluster, so all the memories pointing into its range
+    // are the state itself or in-place views on it.
+    auto *begin = static_cast<uint8_t *>(storage->GetData());
+    auto *end = begin + storage->GetSize();
+    for (auto &edge : edges) {
+        auto memory = edge->getMemoryPtr();
+        if (!memory || !memory->GetPrimitivePtr() || memory->GetPrimitive().get_data_handle() == nullptr)
+            continue;
+        auto *data = static_cast<uint8_t *>(memory->GetData());
+        auto *dataEnd = data + memory->GetSize();
+        if (data >= begin && dataEnd <= end) {
+            bool known = false;
+            for (auto &view : views)
+                known = known || view.first == memory;
+            if (!known)
+                views.emplace_back(memory, static_cast<size_t>(data - begin));
+        } else if (data < end && dataEnd > begin) {
+            swappable = false;
+        }
+    }
+}
+
 std::string  MKLDNNMemoryState::GetName() const {
     return name;
 }
@@ -27,9 +54,41 @@ void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
     storage->SetData(data_type, data_layout, data_ptr, data_size);
 }
 
+TensorDesc MKLDNNMemoryState::getStateDesc() const {
+    return MKLDNNMemoryDesc(storage->GetDescriptor());
+}
+
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    // a copy, the state memory is overwritten by the next inference. SwapState gives the memory without copies
+    auto lastState = make_blob_with_precision(getStateDesc());
+    lastState->allocate();
+    memcpy(lastState->buffer(), storage->GetData(), storage->GetSize());
+    return lastState;
+}
+
+void  MKLDNNMemoryState::SwapState(Blob::Ptr &state) {
+    if (!swappable)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Memory state " << name
+                           << " shares the memory with other tensors and cannot be swapped";
+    if (!state)
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Cannot swap memory state " << name << " with an empty blob";
+
+    auto desc = getStateDesc();
+    const auto &stateDesc = state->getTensorDesc();
+    if (stateDesc.getPrecision() != desc.getPrecision() || stateDesc.getDims() != desc.getDims() ||
+            stateDesc.getBlockingDesc() != desc.getBlockingDesc() || state->byteSize() != storage->GetSize())
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob does not match the precision, dimensions or layout "
+                           << "of memory state " << name;
+    auto *data = state->buffer().as<uint8_t *>();
+    if (data == nullptr)
+        THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Cannot swap memory state " << name << " with not allocated blob";
+
+    Blob::Ptr previous = holder ? holder : make_blob_with_precision(desc, storage->GetData());
+    for (auto &view : views)
+        view.first->GetPrimitivePtr()->set_data_handle(data + view.second);
+
+    holder = state;
+    state = previous;
 }
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
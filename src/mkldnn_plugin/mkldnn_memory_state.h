@@ -6,24 +6,35 @@
 
 #include "cpp_interfaces/impl/ie_memory_state_internal.hpp"
 #include "mkldnn_memory.h"
+#include "mkldnn_edge.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
 public:
-    MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name), storage(storage) {}
+    MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage, const std::vector<MKLDNNEdgePtr> &edges);
 
     std::string GetName() const override;
     void Reset() override;
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetLastState() const override;
+    void SwapState(InferenceEngine::Blob::Ptr &state) override;
 
 private:
+    InferenceEngine::TensorDesc getStateDesc() const;
+
     std::string name;
     MKLDNNMemoryPtr storage;
+    // memories of the graph placed in the state storage with their byte offsets, they are rebound on swap
+    std::vector<std::pair<MKLDNNMemoryPtr, size_t>> views;
+    // the state storage cannot be rebound if it is a part of a bigger tensor
+    bool swappable = true;
+    // the blob owning the currently bound memory, nullptr while the graph memory is used
+    InferenceEngine::Blob::Ptr holder;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
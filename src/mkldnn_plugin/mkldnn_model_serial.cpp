@@ -0,0 +1,246 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_model_serial.h"
+#include "mkldnn/omp_manager.h"
+
+#include <ie_icnn_net_reader.h>
+#include <details/ie_exception.hpp>
+#include <network_serializer.h>
+
+#include <sstream>
+#include <cstring>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+struct ModelHeader {
+    // 'MKLD' in ascii
+    char magic[4] = {'M', 'K', 'L', 'D'};
+    // allows to skip extra fields appended by newer versions of the format
+    uint32_t headerSize = sizeof(ModelHeader);
+    uint16_t major = 1u;
+    // explicit padding, the header is written as is and must have no uninitialized bytes
+    uint16_t reserved = 0u;
+    uint32_t minor = 0u;
+};
+static_assert(sizeof(ModelHeader) == 16, "ModelHeader must have no implicit padding");
+
+template <class T>
+inline void writeBits(const T & obj, std::ostream & os) {
+    os.write(reinterpret_cast<const char *>(&obj), sizeof(T));
+}
+
+template <class T>
+inline void readBits(T & obj, std::istream & is) {
+    is.read(reinterpret_cast<char *>(&obj), sizeof(T));
+}
+
+inline void writeString(const std::string & str, std::ostream & os) {
+    writeBits(static_cast<uint64_t>(str.size()), os);
+    os.write(str.data(), str.size());
+}
+
+// sizes are read from the file, so they are checked against the rest of the stream before the allocation
+inline uint64_t readSize(std::istream & is) {
+    uint64_t size = 0ull;
+    readBits(size, is);
+    const auto pos = is.tellg();
+    if (pos != std::istream::pos_type(-1)) {
+        is.seekg(0, std::ios_base::end);
+        const auto end = is.tellg();
+        is.seekg(pos);
+        if (size > static_cast<uint64_t>(end - pos)) {
+            THROW_IE_EXCEPTION << "Imported file is truncated or corrupted";
+        }
+    }
+    return size;
+}
+
+inline std::string readString(std::istream & is) {
+    const uint64_t size = readSize(is);
+    std::string str(size, '\0');
+    is.read(&str[0], size);
+    return str;
+}
+
+}  // namespace
+
+void MKLDNNModelSerial::Export(std::ostream &os,
+                               const ICNNNetwork &network,
+                               const InputsDataMap &inputs,
+                               const OutputsDataMap &outputs,
+                               const std::map<std::string, std::string> &config,
+                               const MKLDNNGraphCache &graphCache) {
+    ModelHeader header{};
+    writeBits(header, os);
+    writeString(cpu::getCPUBrandString(), os);
+
+    writeBits(static_cast<uint32_t>(config.size()), os);
+    for (const auto &item : config) {
+        writeString(item.first, os);
+        writeString(item.second, os);
+    }
+
+    writeBits(static_cast<uint32_t>(inputs.size()), os);
+    for (const auto &input : inputs) {
+        writeString(input.first, os);
+        writeString(input.second->getPrecision().name(), os);
+        writeBits(static_cast<int32_t>(input.second->getLayout()), os);
+    }
+
+    writeBits(static_cast<uint32_t>(outputs.size()), os);
+    for (const auto &output : outputs) {
+        writeString(output.first, os);
+        writeString(output.second->getPrecision().name(), os);
+        writeBits(static_cast<int32_t>(output.second->getLayout()), os);
+    }
+
+    std::stringstream xml, bin;
+    details::NetworkSerializer::serialize(xml, bin, network);
+    writeString(xml.str(), os);
+    writeString(bin.str(), os);
+
+    writeBits(static_cast<uint32_t>(graphCache.getNodes().size()), os);
+    for (const auto &node : graphCache.getNodes()) {
+        writeString(node.first, os);
+        writeBits(static_cast<int32_t>(node.second.selectedPrimitiveDescriptor), os);
+        writeBits(static_cast<uint32_t>(node.second.internalBlobs.size()), os);
+        for (const auto &blob : node.second.internalBlobs) {
+            writeBits(static_cast<uint64_t>(blob.size()), os);
+            os.write(reinterpret_cast<const char *>(blob.data()), blob.size());
+        }
+    }
+
+    if (!os.good()) {
+        THROW_IE_EXCEPTION << "Error during CPU executable network export";
+    }
+}
+
+MKLDNNModelSerial::Model MKLDNNModelSerial::Import(std::istream &is) {
+    auto exceptions = is.exceptions();
+    is.exceptions(std::istream::failbit);
+    try {
+        auto model = ImportImpl(is);
+        is.exceptions(exceptions);
+        return model;
+    } catch (const std::ios_base::failure &) {
+        is.clear();
+        is.exceptions(exceptions);
+        THROW_IE_EXCEPTION << "Imported file is truncated or corrupted";
+    } catch (...) {
+        is.clear();
+        is.exceptions(exceptions);
+        throw;
+    }
+}
+
+MKLDNNModelSerial::Model MKLDNNModelSerial::ImportImpl(std::istream &is) {
+    ModelHeader header;
+    readBits(header, is);
+    if (std::memcmp(header.magic, ModelHeader().magic, sizeof(header.magic)) != 0) {
+        THROW_IE_EXCEPTION << "Imported file is not a CPU executable network";
+    }
+    if (header.major != ModelHeader().major) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: major version " << header.major
+                           << " while " << ModelHeader().major << " is expected";
+    }
+    if (header.headerSize < sizeof(header)) {
+        THROW_IE_EXCEPTION << "Unsupported header size minimal value is : " << sizeof(header)
+                           << ", but read: " << header.headerSize;
+    }
+    // forward compatible
+    if (header.headerSize > sizeof(header)) {
+        is.seekg(header.headerSize - sizeof(header), std::ios_base::cur);
+    }
+
+    Model model;
+    const bool sameCPU = readString(is) == cpu::getCPUBrandString();
+
+    uint32_t count = 0u;
+    readBits(count, is);
+    for (uint32_t i = 0; i < count; i++) {
+        auto key = readString(is);
+        model.config[key] = readString(is);
+    }
+
+    struct PortInfo {
+        Precision precision;
+        Layout layout;
+    };
+    std::map<std::string, PortInfo> inputsInfo, outputsInfo;
+    auto readPorts = [&is](std::map<std::string, PortInfo> &ports) {
+        uint32_t count = 0u;
+        readBits(count, is);
+        for (uint32_t i = 0; i < count; i++) {
+            auto name = readString(is);
+            auto precision = Precision::FromStr(readString(is));
+            int32_t layout = 0;
+            readBits(layout, is);
+            ports[name] = {precision, static_cast<Layout>(layout)};
+        }
+    };
+    readPorts(inputsInfo);
+    readPorts(outputsInfo);
+
+    auto xml = readString(is);
+    auto bin = readString(is);
+
+    std::shared_ptr<ICNNNetReader> reader(CreateCNNNetReader(), [](ICNNNetReader *p) { p->Release(); });
+    ResponseDesc resp;
+    if (reader->ReadNetwork(xml.data(), xml.size(), &resp) != OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+    TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {bin.size()}, Layout::C});
+    weights->allocate();
+    if (!bin.empty())
+        std::memcpy(weights->buffer(), bin.data(), bin.size());
+    if (reader->SetWeights(weights, &resp) != OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+    model.network = CNNNetwork(reader);
+
+    for (auto &input : model.network.getInputsInfo()) {
+        auto info = inputsInfo.find(input.first);
+        if (info == inputsInfo.end())
+            THROW_IE_EXCEPTION << "Imported network has no info for input " << input.first;
+        input.second->setPrecision(info->second.precision);
+        input.second->setLayout(info->second.layout);
+    }
+    for (auto &output : model.network.getOutputsInfo()) {
+        auto info = outputsInfo.find(output.first);
+        if (info == outputsInfo.end())
+            THROW_IE_EXCEPTION << "Imported network has no info for output " << output.first;
+        output.second->setPrecision(info->second.precision);
+        output.second->setLayout(info->second.layout);
+    }
+
+    auto graphCache = std::make_shared<MKLDNNGraphCache>();
+    readBits(count, is);
+    for (uint32_t i = 0; i < count; i++) {
+        auto name = readString(is);
+        MKLDNNGraphCache::NodeState state;
+        int32_t selected = -1;
+        readBits(selected, is);
+        state.selectedPrimitiveDescriptor = selected;
+        uint32_t blobs = 0u;
+        readBits(blobs, is);
+        for (uint32_t j = 0; j < blobs; j++) {
+            std::vector<uint8_t> data(readSize(is));
+            is.read(reinterpret_cast<char *>(data.data()), data.size());
+            state.internalBlobs.push_back(std::move(data));
+        }
+        graphCache->add(name, std::move(state));
+    }
+    // primitive descriptors and weights layouts depend on the ISA, so compiled state is reused on the same CPU only
+    if (sameCPU)
+        model.graphCache = graphCache;
+
+    return model;
+}
+
+}  // namespace MKLDNNPlugin
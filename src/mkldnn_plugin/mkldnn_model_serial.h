@@ -0,0 +1,89 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+#include <atomic>
+#include <istream>
+#include <ostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Compiled state of graph nodes (selected primitive descriptors and reordered weights).
+ * Graphs restored from an exported blob use it to skip descriptor selection and weights reordering.
+ */
+class MKLDNNGraphCache {
+public:
+    typedef std::shared_ptr<MKLDNNGraphCache> Ptr;
+
+    MKLDNNGraphCache() : id(nextId()) {}
+
+    struct NodeState {
+        int selectedPrimitiveDescriptor = -1;
+        std::vector<std::vector<uint8_t>> internalBlobs;
+    };
+
+    const NodeState* find(const std::string& nodeName) const {
+        auto found = nodes.find(nodeName);
+        return found == nodes.end() ? nullptr : &found->second;
+    }
+
+    void add(const std::string& nodeName, NodeState state) {
+        nodes[nodeName] = std::move(state);
+    }
+
+    const std::map<std::string, NodeState>& getNodes() const {
+        return nodes;
+    }
+
+    // unique within the process, identifies the imported weights for MKLDNNWeightsSharing
+    uint64_t getId() const {
+        return id;
+    }
+
+private:
+    static uint64_t nextId() {
+        static std::atomic<uint64_t> counter(0);
+        return counter++;
+    }
+
+    const uint64_t id;
+    std::map<std::string, NodeState> nodes;
+};
+
+/**
+ * @brief Serialization of the CPU executable network: IR of the network the graph was compiled from,
+ * plugin config, inputs/outputs info and the compiled graph state.
+ */
+class MKLDNNModelSerial {
+public:
+    struct Model {
+        InferenceEngine::CNNNetwork network;
+        std::map<std::string, std::string> config;
+        // nullptr if blob was exported on a different CPU and compiled state is not applicable
+        MKLDNNGraphCache::Ptr graphCache;
+    };
+
+    static void Export(std::ostream &os,
+                       const InferenceEngine::ICNNNetwork &network,
+                       const InferenceEngine::InputsDataMap &inputs,
+                       const InferenceEngine::OutputsDataMap &outputs,
+                       const std::map<std::string, std::string> &config,
+                       const MKLDNNGraphCache &graphCache);
+
+    static Model Import(std::istream &is);
+
+private:
+    // reads the model from the stream with std::istream::failbit exceptions enabled
+    static Model ImportImpl(std::istream &is);
+};
+
+}  // namespace MKLDNNPlugin
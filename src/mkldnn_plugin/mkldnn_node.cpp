@@ -612,9 +612,18 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
+        const std::vector<uint8_t>* cachedBlob = nullptr;
+        if (cachedState && i < cachedState->internalBlobs.size())
+            cachedBlob = &cachedState->internalBlobs[i];
+
         auto create = [&] () {
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
             _ptr->Create(intDescs[i]);
+            if (cachedBlob && cachedBlob->size() == _ptr->GetPrimitiveDescriptor().get_size()) {
+                // already reordered on export
+                ie_memcpy(_ptr->GetData(), cachedBlob->size(), cachedBlob->data(), cachedBlob->size());
+                return _ptr;
+            }
             MKLDNNMemory memory(engine);
 
             auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
@@ -632,9 +641,15 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         };
 
         MKLDNNMemoryPtr ptr;
-        if (weight_caching) {
-            const uint64_t data_hash = Engine::GetWeightsSharing(socket)->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+        if (weight_caching && cachedBlob) {
+            // weights of an imported network are identified by the import itself, no need to hash them
+            const std::string string_hash = name + "_" + std::to_string(i)
+                                            + "_" + std::to_string(cachedBlob->size())
+                                            + "_import" + std::to_string(cachedStateId);
+
+            ptr = Engine::GetWeightsSharing(socket)->findOrCreate(string_hash, create);
+        } else if (weight_caching) {
+            const uint64_t data_hash = MKLDNNWeightsSharing::GetHash(getCnnLayer(), i, internalBlob);
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
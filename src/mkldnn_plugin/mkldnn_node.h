@@ -20,6 +20,7 @@
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
+#include "mkldnn_model_serial.h"
 #include "mkldnn.hpp"
 
 namespace MKLDNNPlugin {
@@ -516,6 +517,12 @@ protected:
     //       Remove this flag when graph clone functionality will be added.
     void enableWeightCaching(bool val) { weight_caching = val; }
 
+    // Compiled state restored from an imported executable network (reordered weights are taken as is)
+    void setCachedState(const MKLDNNGraphCache::NodeState* state, uint64_t cacheId) {
+        cachedState = state;
+        cachedStateId = cacheId;
+    }
+
     InferenceEngine::Blob::Ptr createInternalBlob(InferenceEngine::SizeVector dims, bool weights);
 
     template<typename To>
@@ -540,8 +547,12 @@ private:
     const std::string typeStr;
     Type type;
     int execIndex = -1;
+    // index of the parallel execution stage (see MKLDNNGraph::InitExecutionStages)
+    int execStage = -1;
     int socket;
     bool weight_caching = false;
+    const MKLDNNGraphCache::NodeState* cachedState = nullptr;
+    uint64_t cachedStateId = 0;
 
     std::string typeToStr(Type type);
 
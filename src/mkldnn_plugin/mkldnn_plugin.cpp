@@ -5,11 +5,14 @@
 #include "ie_metric_helpers.hpp"
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_streams_calibration.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <ie_data_hash.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
+#include <fstream>
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 #if defined(_WIN32) || defined(WIN32)
@@ -32,7 +35,40 @@ std::vector<std::shared_ptr<MKLDNNWeightsSharing>> create_shared_weights_per_soc
 }
 
 std::vector<std::shared_ptr<MKLDNNWeightsSharing>> Engine::weightsSharing = create_shared_weights_per_socket();
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+std::map<std::pair<const CNNLayer*, size_t>, MKLDNNWeightsSharing::HashEntry> MKLDNNWeightsSharing::hashes;
+std::mutex MKLDNNWeightsSharing::hashesGuard;
+size_t MKLDNNWeightsSharing::hashesSwept = 0;
+
+uint64_t MKLDNNWeightsSharing::GetHash(const CNNLayerPtr& layer, size_t blobIdx, const Blob::Ptr& blob) {
+    std::promise<uint64_t> promise;
+    std::shared_future<uint64_t> hash;
+    {
+        std::unique_lock<std::mutex> lock(hashesGuard);
+        auto &entry = hashes[{layer.get(), blobIdx}];
+        // the same address may belong to a new layer if the previous one was destroyed
+        if (entry.layer.lock() != layer || entry.size != blob->byteSize()) {
+            // drop entries of destroyed layers, amortized over the growth of the map
+            if (hashes.size() > 2 * hashesSwept) {
+                for (auto it = hashes.begin(); it != hashes.end();) {
+                    if (&it->second != &entry && it->second.layer.expired())
+                        it = hashes.erase(it);
+                    else
+                        ++it;
+                }
+                hashesSwept = hashes.size();
+            }
+            entry = {layer, blob->byteSize(), promise.get_future().share()};
+            lock.unlock();
+
+            // other threads wait for the result instead of hashing the same data
+            uint64_t value = data_hash(blob->buffer(), blob->byteSize());
+            promise.set_value(value);
+            return value;
+        }
+        hash = entry.hash;
+    }
+    return hash.get();
+}
 
 Engine::Engine() {
     _pluginName = "CPU";
@@ -74,10 +110,55 @@ Engine::LoadExeNetworkImpl(const ICore * /*core*/, InferenceEngine::ICNNNetwork
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
+    MKLDNNStreamsCalibration::Calibrate(network, conf, extensionManager);
 
     return std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager);
 }
 
+IExecutableNetwork::Ptr Engine::ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) {
+    std::ifstream modelFile(modelFileName, std::ios::in | std::ios::binary);
+    if (!modelFile.is_open())
+        THROW_IE_EXCEPTION << details::as_status << NETWORK_NOT_READ;
+
+    auto model = MKLDNNModelSerial::Import(modelFile);
+
+    // config stored in the blob has lower priority than the one passed by user
+    Config conf = engConfig;
+    conf.readProperties(model.config);
+    conf.readProperties(config);
+
+    ICNNNetwork &network = model.network;
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+    MKLDNNStreamsCalibration::Calibrate(network, conf, extensionManager);
+
+    // detach inputs/outputs info from the imported network layers the same way LoadNetwork does
+    InputsDataMap networkInputs;
+    for (const auto &input : model.network.getInputsInfo()) {
+        InputInfo::Ptr info = std::make_shared<InputInfo>();
+        DataPtr data = std::make_shared<Data>(*input.second->getInputData());
+        info->getPreProcess() = input.second->getPreProcess();
+        data->getInputTo().clear();
+        info->setInputData(data);
+        networkInputs[input.first] = info;
+    }
+    OutputsDataMap networkOutputs;
+    for (const auto &output : model.network.getOutputsInfo()) {
+        DataPtr data = std::make_shared<Data>(*output.second);
+        data->getInputTo().clear();
+        networkOutputs[output.first] = data;
+    }
+
+    ExecutableNetworkInternal::Ptr impl =
+            std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager, model.graphCache);
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    return make_executable_network(impl);
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
@@ -135,24 +216,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
-        std::string brand_string;
-#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
-        unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
-        unsigned int regs[4];
-        for (auto addr : addr_list) {
-            regs[0] = addr;
-#if defined(_WIN32) || defined(WIN32)
-            __cpuid(reinterpret_cast<int*>(regs), regs[0]);
-#else
-            __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
-#endif
-            char *ch = reinterpret_cast<char*>(&regs[0]);
-            for (size_t j = 0; j < sizeof(regs); j++)
-                brand_string += ch[j];
-        }
-#else
-        brand_string = "Non Intel Architecture";
-#endif
+        std::string brand_string = cpu::getCPUBrandString();
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, brand_string);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
         std::vector<std::string> availableDevices = { "" };
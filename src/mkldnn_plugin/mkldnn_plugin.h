@@ -12,34 +12,13 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <future>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
 
-class SimpleDataHash {
-public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
-};
-
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
@@ -55,12 +34,25 @@ public:
         }
         return ptr;
     }
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+
+    /**
+     * Returns hash of the blob data. Graphs of all streams are created from the same layers and hash the same
+     * weights, so hash is computed once per layer blob while the layer is alive.
+     */
+    static uint64_t GetHash(const InferenceEngine::CNNLayerPtr& layer, size_t blobIdx, const InferenceEngine::Blob::Ptr& blob);
 
 protected:
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
     std::mutex guard;
-    static const SimpleDataHash simpleCRC;
+
+    struct HashEntry {
+        std::weak_ptr<InferenceEngine::CNNLayer> layer;
+        size_t size;
+        std::shared_future<uint64_t> hash;
+    };
+    static std::map<std::pair<const InferenceEngine::CNNLayer*, size_t>, HashEntry> hashes;
+    static std::mutex hashesGuard;
+    static size_t hashesSwept;
 };
 
 class Engine : public InferenceEngine::InferencePluginInternal {
@@ -72,6 +64,9 @@ public:
     LoadExeNetworkImpl(const ICore * core, InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::IExecutableNetwork::Ptr
+    ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
     /**
      * @deprecated
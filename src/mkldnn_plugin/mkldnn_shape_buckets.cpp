@@ -0,0 +1,180 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_shape_buckets.h"
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+static std::vector<std::string> split(const std::string &str, char delimiter) {
+    std::vector<std::string> parts;
+    std::stringstream stream(str);
+    std::string part;
+    while (std::getline(stream, part, delimiter)) {
+        if (!part.empty())
+            parts.push_back(part);
+    }
+    return parts;
+}
+
+static bool covers(const SizeVector &bucketDims, const SizeVector &dims) {
+    if (bucketDims.size() != dims.size())
+        return false;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] > bucketDims[i])
+            return false;
+    }
+    return true;
+}
+
+std::vector<MKLDNNShapeBuckets::Shapes> MKLDNNShapeBuckets::Parse(const std::string &buckets, const Shapes &networkShapes) {
+    std::vector<Shapes> result;
+    for (const auto &bucket : split(buckets, ';')) {
+        Shapes shapes = networkShapes;
+        for (const auto &input : split(bucket, ',')) {
+            auto pos = input.rfind(':');
+            if (pos == std::string::npos)
+                THROW_IE_EXCEPTION << "Wrong shape bucket '" << bucket << "', expected name:dim0x...xdimN list";
+            const std::string name = input.substr(0, pos);
+            auto networkShape = networkShapes.find(name);
+            if (networkShape == networkShapes.end())
+                THROW_IE_EXCEPTION << "Shape bucket '" << bucket << "' refers to unknown input " << name;
+
+            SizeVector dims;
+            for (const auto &dim : split(input.substr(pos + 1), 'x')) {
+                int value;
+                try {
+                    value = std::stoi(dim);
+                } catch (const std::exception&) {
+                    value = 0;
+                }
+                if (value <= 0)
+                    THROW_IE_EXCEPTION << "Wrong dimension '" << dim << "' of input " << name << " in shape bucket '" << bucket << "'";
+                dims.push_back(static_cast<size_t>(value));
+            }
+            if (dims.size() != networkShape->second.size())
+                THROW_IE_EXCEPTION << "Shape bucket '" << bucket << "' has " << dims.size() << " dimensions for input "
+                                   << name << " while the network has " << networkShape->second.size();
+            shapes[name] = dims;
+        }
+        result.push_back(shapes);
+    }
+    return result;
+}
+
+MKLDNNShapeBuckets::MKLDNNShapeBuckets(const std::vector<Shapes> &bucketsShapes, const Shapes &networkShapes,
+                                       const MKLDNNGraph::Ptr &networkGraph, Compiler compiler)
+        : compiler(compiler), hits(0), misses(0), padded(0) {
+    auto volume = [](const Shapes &shapes) {
+        size_t result = 0;
+        for (const auto &shape : shapes)
+            result += details::product(shape.second);
+        return result;
+    };
+
+    // the network shapes are a bucket with the graph compiled at load time
+    buckets.push_back({networkShapes, volume(networkShapes), networkGraph});
+    for (const auto &shapes : bucketsShapes) {
+        bool known = false;
+        for (const auto &bucket : buckets)
+            known = known || bucket.shapes == shapes;
+        if (!known)
+            buckets.push_back({shapes, volume(shapes), nullptr});
+    }
+}
+
+bool MKLDNNShapeBuckets::IsCovered(const std::string &name, const SizeVector &dims) const {
+    for (const auto &bucket : buckets) {
+        auto shape = bucket.shapes.find(name);
+        if (shape != bucket.shapes.end() && covers(shape->second, dims))
+            return true;
+    }
+    return false;
+}
+
+MKLDNNGraph::Ptr MKLDNNShapeBuckets::GetGraph(const Shapes &shapes, Shapes &bucketShapes) {
+    Bucket *found = nullptr;
+    for (auto &bucket : buckets) {
+        bool covered = true;
+        for (const auto &shape : shapes) {
+            auto bucketShape = bucket.shapes.find(shape.first);
+            covered = covered && bucketShape != bucket.shapes.end() && covers(bucketShape->second, shape.second);
+        }
+        if (covered && (!found || bucket.volume < found->volume))
+            found = &bucket;
+    }
+    if (!found) {
+        std::stringstream shapesStr;
+        for (const auto &shape : shapes) {
+            shapesStr << " " << shape.first << ":";
+            for (size_t i = 0; i < shape.second.size(); i++)
+                shapesStr << (i ? "x" : "") << shape.second[i];
+        }
+        THROW_IE_EXCEPTION << "Input shapes" << shapesStr.str() << " are not covered by any of the shape buckets";
+    }
+
+    bucketShapes = found->shapes;
+    for (const auto &shape : shapes) {
+        if (bucketShapes[shape.first] != shape.second) {
+            padded++;
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (found->graph) {
+        hits++;
+    } else {
+        // the failed compilation is repeated by the next request of the bucket
+        found->graph = compiler(found->shapes);
+        misses++;
+    }
+    return found->graph;
+}
+
+void MKLDNNShapeBuckets::Pad(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    const auto &srcDesc = src->getTensorDesc();
+    const auto &dstDesc = dst->getTensorDesc();
+    if (srcDesc.getPrecision() != dstDesc.getPrecision() || srcDesc.getLayout() != dstDesc.getLayout())
+        THROW_IE_EXCEPTION << "Cannot pad the blob to the blob of other precision or layout";
+
+    const auto &srcBlk = srcDesc.getBlockingDesc();
+    const auto &dstBlk = dstDesc.getBlockingDesc();
+    const SizeVector &srcDims = srcBlk.getBlockDims();
+    const size_t ndims = srcDims.size();
+    if (ndims == 0 || ndims != srcDesc.getDims().size() || ndims != dstBlk.getBlockDims().size())
+        THROW_IE_EXCEPTION << "Cannot pad the blob of blocked layout";
+
+    const size_t elemSize = srcDesc.getPrecision().size();
+    const auto *srcData = src->cbuffer().as<const uint8_t *>() + srcBlk.getOffsetPadding() * elemSize;
+    auto *dstData = dst->buffer().as<uint8_t *>() + dstBlk.getOffsetPadding() * elemSize;
+
+    std::memset(dstData, 0, dst->byteSize());
+
+    // rows along the innermost dimension are copied one by one
+    const size_t rowSize = srcDims[ndims - 1] * elemSize;
+    size_t rows = 1;
+    for (size_t i = 0; i + 1 < ndims; i++)
+        rows *= srcDims[i];
+
+    const SizeVector &srcStrides = srcBlk.getStrides();
+    const SizeVector &dstStrides = dstBlk.getStrides();
+    parallel_for(rows, [&](size_t row) {
+        size_t srcOffset = 0, dstOffset = 0;
+        for (size_t i = ndims - 1, rest = row; i > 0; i--) {
+            const size_t idx = rest % srcDims[i - 1];
+            rest /= srcDims[i - 1];
+            srcOffset += idx * srcStrides[i - 1];
+            dstOffset += idx * dstStrides[i - 1];
+        }
+        std::memcpy(dstData + dstOffset * elemSize, srcData + srcOffset * elemSize, rowSize);
+    });
+}
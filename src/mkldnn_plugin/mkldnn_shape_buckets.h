@@ -0,0 +1,84 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+
+#include <ie_icnn_network.hpp>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Graphs of the executable network compiled for different input shapes (buckets).
+ * The graph of a bucket is compiled on the first request of the bucket, requests with smaller
+ * inputs are executed by the graph of the smallest bucket covering them with padded inputs.
+ */
+class MKLDNNShapeBuckets {
+public:
+    typedef std::shared_ptr<MKLDNNShapeBuckets> Ptr;
+    typedef std::map<std::string, InferenceEngine::SizeVector> Shapes;
+    // compiles the graph of the network reshaped to the given input shapes
+    typedef std::function<MKLDNNGraph::Ptr(const Shapes&)> Compiler;
+
+    /**
+     * @brief Parses the value of PluginConfigParams::KEY_CPU_SHAPE_BUCKETS, the shapes of the inputs
+     * missing in a bucket are taken from the network shapes
+     */
+    static std::vector<Shapes> Parse(const std::string &buckets, const Shapes &networkShapes);
+
+    MKLDNNShapeBuckets(const std::vector<Shapes> &buckets, const Shapes &networkShapes,
+                       const MKLDNNGraph::Ptr &networkGraph, Compiler compiler);
+
+    // returns true if the input of the given shape is executed by some bucket
+    bool IsCovered(const std::string &name, const InferenceEngine::SizeVector &dims) const;
+
+    /**
+     * @brief Returns the graph of the smallest bucket covering the input shapes, compiles it if needed
+     * @param shapes Shapes of the request inputs
+     * @param bucketShapes Input shapes of the returned graph, the inputs which differ must be padded
+     */
+    MKLDNNGraph::Ptr GetGraph(const Shapes &shapes, Shapes &bucketShapes);
+
+    struct Statistics {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t padded;
+    };
+
+    Statistics GetStatistics() const {
+        return {hits, misses, padded};
+    }
+
+    /**
+     * @brief Copies the blob into the leading part of the larger blob of the same layout and precision,
+     * the rest of the larger blob is filled with zeros
+     */
+    static void Pad(const InferenceEngine::Blob::Ptr &src, const InferenceEngine::Blob::Ptr &dst);
+
+private:
+    struct Bucket {
+        Shapes shapes;
+        size_t volume;
+        MKLDNNGraph::Ptr graph;
+    };
+
+    std::vector<Bucket> buckets;
+    Compiler compiler;
+    std::mutex guard;
+
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> padded;
+};
+
+}  // namespace MKLDNNPlugin
@@ -132,7 +132,7 @@ bool pin_current_thread_to_socket(int socket) {
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 
 MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name) :
-        _isStopped(false), _name(name), _initCount(0) {
+        _counters(new WorkerCounters[init_tasks.size()]), _isStopped(false), _name(name), _initCount(0) {
     const int sockets = MKLDNNPlugin::cpu::getNumberOfCPUSockets();
     const int worker_per_sockets = (std::max)(1, static_cast<int>(std::ceil(static_cast<float>(init_tasks.size()) / sockets)));
     for (int t= 0; t < init_tasks.size(); t++) {
@@ -156,8 +156,13 @@ MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& i
                         isQueueEmpty = _taskQueue.empty();
                     }
                 }
-                if (currentTask)
+                if (currentTask) {
+                    auto start = std::chrono::steady_clock::now();
                     currentTask->runNoThrowNoBusyCheck();
+                    auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                    _counters[t].busyTimeNs += busy.count();
+                    _counters[t].executedTasks++;
+                }
                 if (_isStopped)
                     break;
                 if (isQueueEmpty)  // notify dtor, that all tasks were completed
@@ -168,6 +173,18 @@ MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& i
     while (_initCount != init_tasks.size()) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
+    _startTime = std::chrono::steady_clock::now();
+}
+
+std::vector<MultiWorkerTaskExecutor::StreamUtilization> MultiWorkerTaskExecutor::getStreamsUtilization() const {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _startTime);
+    std::vector<StreamUtilization> utilization(_threads.size());
+    for (size_t t = 0; t < _threads.size(); t++) {
+        utilization[t].executedTasks = _counters[t].executedTasks;
+        utilization[t].busyRatio = elapsed.count() > 0
+                ? (std::min)(1.f, static_cast<float>(_counters[t].busyTimeNs) / elapsed.count()) : 0.f;
+    }
+    return utilization;
 }
 
 MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
@@ -228,70 +245,22 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                    << input.first;
             }
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
                 case InferenceEngine::Precision::I32:
                 case InferenceEngine::Precision::I8:
-                    graph->PushInputData(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                      input.second->getTensorDesc().getDims(),
-                                                                      input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    graph->PushInputData(input.first, iconv);
-                    break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
-                    break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
+                case InferenceEngine::Precision::U16:
+                    // I16 and U8 inputs with a mean image are converted to FP32 by the input reorder,
+                    // U16 ones are converted by the stream graph, so requests of the stream don't keep own copies
+                    graph->PushInputData(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
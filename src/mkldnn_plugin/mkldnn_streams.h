@@ -11,6 +11,7 @@
 #include <queue>
 #include <memory>
 #include <climits>
+#include <chrono>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include "ie_parallel.hpp"
@@ -118,6 +119,13 @@ class MultiWorkerTaskExecutor : public ITaskExecutor {
 public:
     typedef std::shared_ptr<MultiWorkerTaskExecutor> Ptr;
 
+    /* Counters of a worker (stream) since the executor start */
+    struct StreamUtilization {
+        uint64_t executedTasks;
+        // part of the time the stream was busy with tasks, [0, 1]
+        float busyRatio;
+    };
+
     explicit MultiWorkerTaskExecutor(const std::vector<Task::Ptr>&, std::string name = "Default");
 
     ~MultiWorkerTaskExecutor();
@@ -130,10 +138,19 @@ public:
     */
     bool startTask(Task::Ptr task) override;
 
+    std::vector<StreamUtilization> getStreamsUtilization() const;
+
     static thread_local MultiWorkerTaskContext ptrContext;
 
 private:
+    struct WorkerCounters {
+        std::atomic<uint64_t> executedTasks{0};
+        std::atomic<uint64_t> busyTimeNs{0};
+    };
+
     std::vector<std::thread> _threads;
+    std::unique_ptr<WorkerCounters[]> _counters;
+    std::chrono::steady_clock::time_point _startTime;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
     std::queue<Task::Ptr> _taskQueue;
@@ -0,0 +1,310 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_streams_calibration.h"
+#include "mkldnn_exec_network.h"
+#include "mkldnn/omp_manager.h"
+#include <details/ie_exception.hpp>
+#include <details/ie_cnn_network_iterator.hpp>
+#include <ie_data_hash.hpp>
+#include <ie_parallel.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+std::map<std::string, std::map<std::string, MKLDNNStreamsCalibration::Candidate>> MKLDNNStreamsCalibration::results;
+std::mutex MKLDNNStreamsCalibration::resultsGuard;
+std::mutex MKLDNNStreamsCalibration::cacheGuard;
+
+// time every candidate runs the network after the warm up inference of each request
+static const std::chrono::milliseconds calibrationTime(300);
+
+std::vector<MKLDNNStreamsCalibration::Candidate> MKLDNNStreamsCalibration::GetCandidates(int threads, int cores) {
+    threads = std::max(1, threads);
+    cores = std::max(1, std::min(cores, threads));
+    std::vector<Candidate> candidates = {{1, threads}};
+    // the streams of a few cores each are the sweet spot of the throughput, the finer splits are not measured
+    for (int streams = 2; streams <= cores; streams *= 2) {
+        if (4 * streams >= cores)
+            candidates.push_back({streams, threads / streams});
+    }
+    return candidates;
+}
+
+MKLDNNStreamsCalibration::Candidate MKLDNNStreamsCalibration::Select(const std::vector<Candidate> &candidates,
+                                                                     const Measurer &measurer, float latencyBound) {
+    if (candidates.empty())
+        THROW_IE_EXCEPTION << "No candidates for the streams calibration";
+
+    const Candidate *best = nullptr, *fastest = nullptr;
+    double bestThroughput = 0., lowestLatency = std::numeric_limits<double>::max();
+    for (const auto &candidate : candidates) {
+        Measurement measurement = measurer(candidate);
+        if ((latencyBound <= 0.f || measurement.latency <= latencyBound) &&
+                (!best || measurement.throughput > bestThroughput)) {
+            best = &candidate;
+            bestThroughput = measurement.throughput;
+        }
+        if (!fastest || measurement.latency < lowestLatency) {
+            fastest = &candidate;
+            lowestLatency = measurement.latency;
+        }
+    }
+    return best ? *best : *fastest;
+}
+
+std::string MKLDNNStreamsCalibration::GetKey(const ICNNNetwork &network, float latencyBound) {
+    std::stringstream topology;
+    details::CNNNetworkIterator itLayer(const_cast<ICNNNetwork *>(&network));
+    while (itLayer != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *itLayer;
+        topology << layer->name << ' ' << layer->type << ' ' << layer->precision.name();
+        for (const auto &param : layer->params)
+            topology << ' ' << param.first << '=' << param.second;
+        for (const auto &data : layer->outData) {
+            topology << " [";
+            for (auto dim : data->getTensorDesc().getDims())
+                topology << dim << ',';
+            topology << ']';
+        }
+        for (const auto &blob : layer->blobs) {
+            if (blob.second)
+                topology << ' ' << blob.first << ':' << blob.second->byteSize();
+        }
+        topology << '\n';
+        itLayer++;
+    }
+    const std::string topologyStr = topology.str();
+
+    std::stringstream key;
+    key << std::hex << data_hash(topologyStr.data(), topologyStr.size()) << std::dec
+        << ' ' << cpu::getCPUBrandString() << " latency<=" << latencyBound;
+    return key.str();
+}
+
+std::string MKLDNNStreamsCalibration::GetWeightsHash(const ICNNNetwork &network) {
+    std::stringstream weights;
+    weights << std::hex;
+    details::CNNNetworkIterator itLayer(const_cast<ICNNNetwork *>(&network));
+    while (itLayer != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *itLayer;
+        for (const auto &blob : layer->blobs) {
+            if (blob.second)
+                weights << data_hash(blob.second->cbuffer(), blob.second->byteSize()) << ' ';
+        }
+        itLayer++;
+    }
+    const std::string weightsStr = weights.str();
+
+    std::stringstream hash;
+    hash << std::hex << data_hash(weightsStr.data(), weightsStr.size());
+    return hash.str();
+}
+
+// the line of the cache file is "<streams> <threads per stream> <weights hash> <key>"
+static bool parseLine(const std::string &line, MKLDNNStreamsCalibration::Candidate &candidate,
+                      std::string &weights, std::string &key) {
+    std::stringstream lineStream(line);
+    if (!(lineStream >> candidate.streams >> candidate.threadsPerStream >> weights))
+        return false;
+    std::getline(lineStream >> std::ws, key);
+    return true;
+}
+
+std::map<std::string, MKLDNNStreamsCalibration::Candidate> MKLDNNStreamsCalibration::Load(const std::string &fileName,
+                                                                                           const std::string &key) {
+    std::map<std::string, Candidate> stored;
+    std::ifstream file(fileName);
+    std::string line;
+    while (std::getline(file, line)) {
+        Candidate candidate;
+        std::string weights, storedKey;
+        if (parseLine(line, candidate, weights, storedKey) && storedKey == key &&
+                candidate.streams > 0 && candidate.threadsPerStream > 0)
+            stored[weights] = candidate;
+    }
+    return stored;
+}
+
+void MKLDNNStreamsCalibration::Store(const std::string &fileName, const std::string &key, const std::string &weights,
+                                     const Candidate &candidate) {
+    std::lock_guard<std::mutex> lock(cacheGuard);
+
+    std::vector<std::string> lines;
+    {
+        std::ifstream file(fileName);
+        std::string line;
+        while (std::getline(file, line)) {
+            Candidate stored;
+            std::string storedWeights, storedKey;
+            if (!parseLine(line, stored, storedWeights, storedKey) || storedKey != key || storedWeights != weights)
+                lines.push_back(line);
+        }
+    }
+    lines.push_back(std::to_string(candidate.streams) + " " + std::to_string(candidate.threadsPerStream) + " " +
+                    weights + " " + key);
+
+    // the name of the temporary file is unique for the process and the time, the other processes may store
+    // their results at the same time and the last rename wins
+    std::stringstream tmpName;
+    tmpName << fileName << '.' << std::hex << std::hash<std::thread::id>()(std::this_thread::get_id())
+            << '.' << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+    {
+        std::ofstream file(tmpName.str(), std::ios::out | std::ios::trunc);
+        if (!file.is_open())
+            THROW_IE_EXCEPTION << "Cannot open file " << tmpName.str() << " to store the streams calibration";
+        for (const auto &line : lines)
+            file << line << '\n';
+        if (!file.flush()) {
+            file.close();
+            std::remove(tmpName.str().c_str());
+            THROW_IE_EXCEPTION << "Cannot write file " << tmpName.str() << " to store the streams calibration";
+        }
+    }
+#if defined(_WIN32) || defined(WIN32)
+    // rename doesn't replace the existing file on Windows
+    std::remove(fileName.c_str());
+#endif
+    if (std::rename(tmpName.str().c_str(), fileName.c_str()) != 0) {
+        std::remove(tmpName.str().c_str());
+        THROW_IE_EXCEPTION << "Cannot replace file " << fileName << " to store the streams calibration";
+    }
+}
+
+static MKLDNNStreamsCalibration::Measurement measure(const ICNNNetwork &network, const Config &config,
+                                                     const MKLDNNExtensionManager::Ptr &extMgr,
+                                                     const MKLDNNStreamsCalibration::Candidate &candidate) {
+    using Time = std::chrono::high_resolution_clock;
+    using ms = std::chrono::duration<double, std::ratio<1, 1000>>;
+
+    Config cfg = config;
+    cfg.streamsCalibration = false;
+    cfg.throughputStreams = candidate.streams;
+    cfg.threadsNum = candidate.streams * candidate.threadsPerStream;
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(network, cfg, extMgr);
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    execNetwork->setNetworkInputs(inputs);
+    execNetwork->setNetworkOutputs(outputs);
+
+    // a request per stream keeps all streams busy, inputs are zeros to avoid denormals of uninitialized data
+    ResponseDesc resp;
+    auto check = [&](StatusCode sts) {
+        if (sts != OK)
+            THROW_IE_EXCEPTION << "Streams calibration failed: " << resp.msg;
+    };
+    std::vector<IInferRequest::Ptr> requests(candidate.streams);
+    for (auto &request : requests) {
+        execNetwork->CreateInferRequest(request);
+        for (const auto &input : inputs) {
+            Blob::Ptr blob;
+            check(request->GetBlob(input.first.c_str(), blob, &resp));
+            std::memset(blob->buffer(), 0, blob->byteSize());
+        }
+        check(request->StartAsync(&resp));
+    }
+    for (auto &request : requests)
+        check(request->Wait(IInferRequest::WaitMode::RESULT_READY, &resp));
+
+    std::vector<Time::time_point> starts(requests.size());
+    std::vector<bool> running(requests.size(), true);
+    const auto begin = Time::now();
+    const auto deadline = begin + calibrationTime;
+    for (size_t i = 0; i < requests.size(); i++) {
+        starts[i] = Time::now();
+        check(requests[i]->StartAsync(&resp));
+    }
+
+    size_t done = 0, active = requests.size();
+    double latencySum = 0.;
+    for (size_t i = 0; active > 0; i = (i + 1) % requests.size()) {
+        if (!running[i])
+            continue;
+        check(requests[i]->Wait(IInferRequest::WaitMode::RESULT_READY, &resp));
+        const auto now = Time::now();
+        latencySum += std::chrono::duration_cast<ms>(now - starts[i]).count();
+        done++;
+        if (now < deadline) {
+            starts[i] = now;
+            check(requests[i]->StartAsync(&resp));
+        } else {
+            running[i] = false;
+            active--;
+        }
+    }
+    const double elapsed = std::chrono::duration_cast<ms>(Time::now() - begin).count();
+
+    return {1000. * done / elapsed, latencySum / done};
+}
+
+void MKLDNNStreamsCalibration::Calibrate(const ICNNNetwork &network, Config &config, const MKLDNNExtensionManager::Ptr &extMgr) {
+    if (!config.streamsCalibration)
+        return;
+    config.streamsCalibration = false;
+
+    // graphs of shape buckets support a single stream only
+    if (config.shapeBuckets.empty()) {
+        const std::string key = GetKey(network, config.calibrationLatencyBound);
+        std::map<std::string, Candidate> stored;
+        {
+            std::lock_guard<std::mutex> lock(resultsGuard);
+            auto result = results.find(key);
+            if (result != results.end())
+                stored = result->second;
+        }
+        if (!config.calibrationCache.empty()) {
+            auto loaded = Load(config.calibrationCache, key);
+            stored.insert(loaded.begin(), loaded.end());
+        }
+
+        // the weights are hashed only if the topology is already calibrated
+        std::string weights;
+        Candidate best;
+        bool found = false;
+        if (!stored.empty()) {
+            weights = GetWeightsHash(network);
+            auto result = stored.find(weights);
+            found = result != stored.end();
+            if (found)
+                best = result->second;
+        }
+        if (!found) {
+            // the same #threads as the executable network would use for the streams
+            const int env_threads = parallel_get_env_threads();
+            const int hw_threads = cpu::getNumberOfCPUSockets() == 1 ? parallel_get_max_threads() : cpu::getNumberOfCPUCores();
+            const int threads = config.threadsNum ? config.threadsNum : (env_threads ? env_threads : hw_threads);
+
+            best = Select(GetCandidates(threads, cpu::getNumberOfCPUCores()), [&](const Candidate &candidate) {
+                return measure(network, config, extMgr, candidate);
+            }, config.calibrationLatencyBound);
+            if (weights.empty())
+                weights = GetWeightsHash(network);
+            if (!config.calibrationCache.empty())
+                Store(config.calibrationCache, key, weights, best);
+        }
+        {
+            std::lock_guard<std::mutex> lock(resultsGuard);
+            results[key][weights] = best;
+        }
+        config.throughputStreams = best.streams;
+        config.threadsNum = best.streams * best.threadsPerStream;
+    }
+
+    config._config.clear();
+    config.updateProperties();
+}
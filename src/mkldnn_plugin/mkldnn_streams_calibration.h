@@ -0,0 +1,85 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_extension_mngr.h"
+
+#include <ie_icnn_network.hpp>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Selection of the number of streams (and threads per stream) for PluginConfigParams::CPU_THROUGHPUT_CALIBRATE.
+ * Candidate configurations are measured on the loaded network and the best one is remembered by the key
+ * of the network and the CPU, in the process and optionally in the file of PluginConfigParams::KEY_CPU_CALIBRATION_CACHE.
+ */
+class MKLDNNStreamsCalibration {
+public:
+    struct Candidate {
+        int streams;
+        int threadsPerStream;
+    };
+
+    struct Measurement {
+        double throughput;  // inferences per second
+        double latency;     // average latency of a request in milliseconds
+    };
+
+    // runs the network with the candidate configuration
+    typedef std::function<Measurement(const Candidate&)> Measurer;
+
+    /**
+     * @brief Returns the configurations of one stream and of the powers of two streams from a quarter
+     * of the physical cores to the physical cores, each stream gets an equal part of the threads
+     */
+    static std::vector<Candidate> GetCandidates(int threads, int cores);
+
+    /**
+     * @brief Measures all candidates and returns the best throughput among the ones with the latency
+     * below the bound (zero means no bound), or the lowest latency if no candidate satisfies the bound
+     */
+    static Candidate Select(const std::vector<Candidate> &candidates, const Measurer &measurer, float latencyBound);
+
+    /**
+     * @brief Returns the key of the calibration result: the hash of the network topology,
+     * the CPU brand string and the latency bound
+     */
+    static std::string GetKey(const InferenceEngine::ICNNNetwork &network, float latencyBound);
+
+    /**
+     * @brief Returns the hash of the network weights, it is computed only if a result is found
+     * for the key of the topology or a new result is stored
+     */
+    static std::string GetWeightsHash(const InferenceEngine::ICNNNetwork &network);
+
+    // returns the results of the key by the hash of the weights, the missing file is not an error
+    static std::map<std::string, Candidate> Load(const std::string &fileName, const std::string &key);
+    // replaces the result for the key and the weights in the file keeping the other results,
+    // the file is rewritten through the temporary one, so the concurrent readers never see it partially written
+    static void Store(const std::string &fileName, const std::string &key, const std::string &weights,
+                      const Candidate &candidate);
+
+    /**
+     * @brief Sets the streams and threads of the config to the calibrated ones, the network is calibrated
+     * only if no result is found in the process or in the cache file of the config
+     */
+    static void Calibrate(const InferenceEngine::ICNNNetwork &network, Config &config,
+                          const MKLDNNExtensionManager::Ptr &extMgr);
+
+private:
+    // results by the key and the hash of the weights
+    static std::map<std::string, std::map<std::string, Candidate>> results;
+    static std::mutex resultsGuard;
+    static std::mutex cacheGuard;
+};
+
+}  // namespace MKLDNNPlugin
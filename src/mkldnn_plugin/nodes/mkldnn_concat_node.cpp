@@ -4,6 +4,8 @@
 
 #include "mkldnn_concat_node.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <utility>
 #include <vector>
@@ -110,6 +112,29 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    // copies of channels last and blocked tensors with channel tails are done by the strided copy
+    if ((dims.ndims() == 4 || dims.ndims() == 5) && this->getCnnLayer()->precision != Precision::I8) {
+        auto fmt = dims.ndims() == 4 ? mkldnn::memory::nhwc : mkldnn::memory::ndhwc;
+        for (size_t i = 0; i < getParentEdges().size(); i++)
+            config.inConfs[i].desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDataType, fmt);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(dims, outputDataType, fmt);
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, fmt);
+
+        for (size_t sizeS : {8lu, 16lu}) {
+            bool hasTails = dims[1] % sizeS != 0;
+            for (size_t i = 0; i < getParentEdges().size(); i++)
+                hasTails = hasTails || getParentEdgeAt(i)->getDims()[1] % sizeS != 0;
+            if (axis != 1 || !hasTails)
+                continue;
+            fmt = dims.ndims() == 4 ? sizeS == 8lu ? mkldnn::memory::nChw8c : mkldnn::memory::nChw16c
+                                    : sizeS == 8lu ? mkldnn::memory::nCdhw8c : mkldnn::memory::nCdhw16c;
+            for (size_t i = 0; i < getParentEdges().size(); i++)
+                config.inConfs[i].desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDataType, fmt);
+            config.outConfs[0].desc = MKLDNNMemoryDesc(dims, outputDataType, fmt);
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, fmt);
+        }
+    }
+
     if (axis != 1 || hasEltwise)
         return;
 
@@ -148,7 +173,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NHWC in mkldnn
+                config.inConfs[i].inPlace = -1;     // views of spatial size 1 are added below
 
                 config.inConfs[i].desc = TensorDesc(iIEPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -192,8 +217,6 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
             // nChw8c, nChw16c, nCdhw8c, nCdhw16c
             for (size_t sizeS : {8lu, 16lu}) {
                 SizeVector blkDims = dstDims.ToSizeVector();
-                if (blkDims[1] % sizeS)
-                    continue;
                 blkDims[1] = blkDims[1] / sizeS + (blkDims[1] % sizeS ? 1lu : 0lu);
                 blkDims.push_back(sizeS);
 
@@ -214,7 +237,8 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 for (size_t i = 0lu; canInplace && i < getParentEdges().size(); i++) {
                     auto parentEdge = getParentEdgeAt(i);
                     blkDims = parentEdge->getDims().ToSizeVector();
-                    if (blkDims[1] % sizeS)
+                    // the channel tail of the last input goes to the padded tail of the output
+                    if (blkDims[1] % sizeS && i + 1 != getParentEdges().size())
                         canInplace = false;
 
                     blkDims[1] = blkDims[1] / sizeS + (blkDims[1] % sizeS ? 1lu : 0lu);
@@ -230,6 +254,34 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
             }
         }
     }
+
+    // Channels last inputs are views of the output only if the spatial size is 1: the producers assume
+    // dense pixels, so only the batch stride of a view may differ from the dense one
+    size_t spatialSize = 1;
+    for (size_t i = 2; i < numOfDim; i++)
+        spatialSize *= dstDims[i];
+    if ((numOfDim == 4lu || numOfDim == 5lu) && spatialSize == 1) {
+        order = numOfDim == 4lu ? SizeVector{0, 2, 3, 1} : SizeVector{0, 2, 3, 4, 1};
+        offsets = SizeVector(numOfDim, 0lu);
+        SizeVector strides(numOfDim, std::numeric_limits<size_t>::max());
+        strides[numOfDim - 1] = 1;
+
+        auto channelsLast = [&](const MKLDNNDims& dims, InferenceEngine::Precision prc) {
+            SizeVector blkDims;
+            for (auto dim : order)
+                blkDims.push_back(static_cast<size_t>(dims[static_cast<int>(dim)]));
+            return TensorDesc(prc, dims.ToSizeVector(), {blkDims, order, offset, offsets, strides});
+        };
+
+        config.outConfs[0].desc = channelsLast(dstDims, MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType));
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            config.inConfs[i].inPlace = 0;
+            config.inConfs[i].desc = channelsLast(getParentEdgeAt(i)->getDims(),
+                                                  MKLDNNExtensionUtils::DataTypeToIEPrecision(inputDataType));
+        }
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown,
+                                                   numOfDim == 4lu ? mkldnn::memory::nhwc : mkldnn::memory::ndhwc);
+    }
 }
 
 void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
@@ -354,14 +406,17 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
         }
     }
 
-    if (canOptimize && MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, convertTo).blocksExtended())
-        convertTo = MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims());
-    for (size_t i = 0; canOptimize && i < getParentEdges().size(); i++) {
+    // Only the last input of the in-place concat may have a channel tail. Blocked inputs with other tails
+    // are copied to the output by the strided copy, which is cheaper than reorders to the plain layout.
+    bool hasInnerTails = false;
+    for (size_t i = 0; canOptimize && i + 1 < getParentEdges().size(); i++) {
         if (MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDataType, convertTo).blocksExtended())
-            convertTo = MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims());
+            hasInnerTails = true;
     }
 
     for (auto supportedPdIndex : canSelectPrimitive) {
+        if (hasInnerTails)
+            break;
         if (MKLDNNMemoryDesc(supportedPrimitiveDescriptors[supportedPdIndex].getConfig().inConfs[0].desc).getFormat() == convertTo) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(supportedPdIndex));
             return;
@@ -373,9 +428,11 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
         if (primDescInfo.getImplementationType() == impl_desc_type::unknown)
             continue;
         if (convertTo == MKLDNNMemoryDesc(supportedPrimitiveDescriptors[i].getConfig().outConfs[0].desc).getFormat()) {
+            // inputs of the defined layout are copied by the strided copy, which handles the channel tails
             size_t num = 0;
             for (num = 0; num < getParentEdges().size(); num++) {
-                if (MKLDNNMemoryDesc(getParentEdgeAt(num)->getDims(), inputDataType, convertTo).blocksExtended())
+                if (primDescInfo.getConfig().inConfs[num].desc.getLayout() == InferenceEngine::Layout::ANY &&
+                        MKLDNNMemoryDesc(getParentEdgeAt(num)->getDims(), inputDataType, convertTo).blocksExtended())
                     break;
             }
             if (num == getParentEdges().size()) {
@@ -405,6 +462,9 @@ void MKLDNNConcatNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
 
+    if (initStridedCopy())
+        return;
+
     std::vector<memory::primitive_desc> srcs_pd;
     std::vector<primitive::at> srcs_p;
 
@@ -499,12 +559,12 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
                                                              });
         size_t axisSize = 1;
 
-        if (config.inConfs[0].desc.getLayout() == Layout::NHWC) {
+        if (config.inConfs[0].desc.getLayout() == Layout::NHWC || config.inConfs[0].desc.getLayout() == Layout::NDHWC) {
             // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for nchw8c
             size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
+            // block dims are already in the order of the layout
             for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                size_t jj = config.inConfs[0].desc.getBlockingDesc().getOrder()[j];
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[jj];
+                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
             }
         } else {
             // This works for nchw and nchw8c/nchw16c
@@ -517,45 +577,179 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
     initDescriptor(config);
 }
 
-void MKLDNNConcatNode::execute(mkldnn::stream strm) {
-    if (isOptimized()) {
-        return;
-    }
+bool MKLDNNConcatNode::initStridedCopy() {
+    StridedCopy copy;
+    const TensorDesc dstDesc = getChildEdgeAt(0)->getDesc();
+    const BlockingDesc &dstBlk = dstDesc.getBlockingDesc();
+    const SizeVector &order = dstBlk.getOrder();
+    const SizeVector &dstBlkDims = dstBlk.getBlockDims();
+    const size_t ndims = order.size();
+
+    const size_t axisPos = inverseOrder(order, axis);
+    if (ndims == 0 || axisPos >= ndims || dstBlk.getStrides().size() != ndims)
+        return false;
+    const auto axisCount = std::count(order.begin(), order.end(), axis);
+    // the axis can be split only to the outer dimension and the innermost block, as in nChw8c
+    if (axisCount > 2 || (axisCount == 2 && order.back() != axis))
+        return false;
+    const bool blockedAxis = axisCount == 2;
+
+    auto isDenseFrom = [&](const BlockingDesc &blk, size_t from) {
+        size_t stride = 1;
+        for (size_t i = ndims; i-- > from;) {
+            if (blk.getStrides()[i] != stride)
+                return false;
+            stride *= blk.getBlockDims()[i];
+        }
+        return true;
+    };
 
-    const MKLDNNMemory& dst_memory = getChildEdgeAt(0)->getMemory();
-    const mkldnn::memory::data_type data_type = dst_memory.GetDataType();
+    copy.elemSize = dstDesc.getPrecision().size();
+    copy.outerDims.assign(dstBlkDims.begin(), dstBlkDims.begin() + axisPos);
+    copy.dstOuterStrides.assign(dstBlk.getStrides().begin(), dstBlk.getStrides().begin() + axisPos);
+    copy.dstPaddingOffset = dstBlk.getOffsetPadding();
 
-    const bool isInt8 = (data_type == mkldnn_s8 || data_type == mkldnn_u8);
+    size_t dstChunk = 1;
+    for (size_t i = axisPos; i < ndims; i++)
+        dstChunk *= dstBlkDims[i];
 
-    if (isInt8) {
-        uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst_memory.GetData());
+    size_t chunksSize = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const TensorDesc srcDesc = getParentEdgeAt(i)->getDesc();
+        const BlockingDesc &srcBlk = srcDesc.getBlockingDesc();
+        const SizeVector &srcBlkDims = srcBlk.getBlockDims();
+        if (srcDesc.getPrecision().size() != copy.elemSize || srcBlk.getOrder() != order ||
+                srcBlk.getStrides().size() != ndims)
+            return false;
+        for (size_t j = 0; j < axisPos; j++) {
+            if (srcBlkDims[j] != dstBlkDims[j])
+                return false;
+        }
+        if (blockedAxis && srcBlkDims.back() != dstBlkDims.back())
+            return false;
+        if (!isDenseFrom(srcBlk, blockedAxis ? axisPos + 1 : axisPos))
+            return false;
+
+        size_t chunk = 1;
+        for (size_t j = axisPos; j < ndims; j++)
+            chunk *= srcBlkDims[j];
+
+        copy.srcOuterStrides.emplace_back(srcBlk.getStrides().begin(), srcBlk.getStrides().begin() + axisPos);
+        copy.srcChunks.push_back(chunk);
+        copy.dstOffsets.push_back(chunksSize);
+        copy.srcPaddingOffsets.push_back(srcBlk.getOffsetPadding());
+        copy.channels.push_back(srcDesc.getDims()[axis]);
+        copy.srcBlockStrides.push_back(srcBlk.getStrides()[axisPos]);
+        chunksSize += chunk;
+    }
+    if (!isDenseFrom(dstBlk, blockedAxis ? axisPos + 1 : axisPos))
+        return false;
+
+    if (chunksSize != dstChunk) {
+        // the padded channel tails of the inputs are not at the end of the output
+        if (!blockedAxis)
+            return false;
+        copy.perChannel = true;
+        copy.block = dstBlkDims.back();
+        copy.dstBlockStride = dstBlk.getStrides()[axisPos];
+        for (size_t i = axisPos + 1; i + 1 < ndims; i++)
+            copy.inner *= dstBlkDims[i];
+    }
 
-        const size_t num_src = getParentEdges().size();
+    copy.enabled = true;
+    stridedCopy = copy;
+    return true;
+}
 
-        std::vector<size_t> channels;
-        size_t channels_size = 0;
-        std::vector<const uint8_t*> src_ptrs;
-        std::vector<uint8_t*> dst_ptrs;
+template <typename T>
+static inline void copyBlockedChannel(const uint8_t *src, uint8_t *dst, size_t inner, size_t block) {
+    const T *srcData = reinterpret_cast<const T *>(src);
+    T *dstData = reinterpret_cast<T *>(dst);
+    for (size_t i = 0; i < inner; i++)
+        dstData[i * block] = srcData[i * block];
+}
 
-        for (size_t i = 0; i < num_src; i++) {
-            const MKLDNNMemory& src_mem = getParentEdgeAt(i)->getMemory();
-            const size_t num_channels = src_mem.GetDims()[1];
+void MKLDNNConcatNode::executeStridedCopy() {
+    const StridedCopy &copy = stridedCopy;
+    const size_t elemSize = copy.elemSize;
+    const size_t numSrc = getParentEdges().size();
+
+    uint8_t *dst = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemory().GetData()) +
+                   copy.dstPaddingOffset * elemSize;
+    std::vector<const uint8_t *> srcs(numSrc);
+    for (size_t i = 0; i < numSrc; i++)
+        srcs[i] = reinterpret_cast<const uint8_t *>(getParentEdgeAt(i)->getMemory().GetData()) +
+                  copy.srcPaddingOffsets[i] * elemSize;
+
+    SizeVector outerDims = copy.outerDims;
+    // the batch is the outermost dimension of all supported layouts
+    if (!outerDims.empty() && getChildEdgeAt(0)->getDesc().getBlockingDesc().getOrder()[0] == 0)
+        outerDims[0] = std::min(outerDims[0], static_cast<size_t>(batchToProcess()));
+    size_t outerCount = 1;
+    for (auto dim : outerDims)
+        outerCount *= dim;
+
+    auto outerOffset = [&](size_t outer, const SizeVector &strides) {
+        size_t offset = 0;
+        for (size_t i = outerDims.size(); i-- > 0;) {
+            offset += (outer % outerDims[i]) * strides[i];
+            outer /= outerDims[i];
+        }
+        return offset;
+    };
+
+    if (!copy.perChannel) {
+        parallel_for2d(outerCount, numSrc, [&](size_t outer, size_t i) {
+            const size_t srcOffset = outerOffset(outer, copy.srcOuterStrides[i]);
+            const size_t dstOffset = outerOffset(outer, copy.dstOuterStrides) + copy.dstOffsets[i];
+            memcpy(dst + dstOffset * elemSize, srcs[i] + srcOffset * elemSize, copy.srcChunks[i] * elemSize);
+        });
+        return;
+    }
 
-            channels.push_back(num_channels);
-            src_ptrs.push_back(reinterpret_cast<const uint8_t*>(src_mem.GetData()));
-            dst_ptrs.push_back(dst_ptr + channels_size);
-            channels_size += num_channels;
+    size_t dstChannels = 0;
+    for (auto channels : copy.channels)
+        dstChannels += channels;
+    const size_t block = copy.block;
+
+    parallel_for2d(outerCount, dstChannels, [&](size_t outer, size_t c) {
+        size_t i = 0, srcC = c;
+        while (srcC >= copy.channels[i])
+            srcC -= copy.channels[i++];
+
+        const uint8_t *srcPtr = srcs[i] + (outerOffset(outer, copy.srcOuterStrides[i]) +
+                                           (srcC / block) * copy.srcBlockStrides[i] + srcC % block) * elemSize;
+        uint8_t *dstPtr = dst + (outerOffset(outer, copy.dstOuterStrides) +
+                                 (c / block) * copy.dstBlockStride + c % block) * elemSize;
+        switch (elemSize) {
+            case 4: copyBlockedChannel<uint32_t>(srcPtr, dstPtr, copy.inner, block); break;
+            case 2: copyBlockedChannel<uint16_t>(srcPtr, dstPtr, copy.inner, block); break;
+            default:
+                for (size_t j = 0; j < copy.inner; j++)
+                    memcpy(dstPtr + j * block * elemSize, srcPtr + j * block * elemSize, elemSize);
         }
+    });
+
+    // the padded tail of the last block is zeroed as the other layers produce it
+    if (dstChannels % block) {
+        const size_t tail = block - dstChannels % block;
+        parallel_for2d(outerCount, copy.inner, [&](size_t outer, size_t j) {
+            uint8_t *dstPtr = dst + (outerOffset(outer, copy.dstOuterStrides) +
+                                     (dstChannels / block) * copy.dstBlockStride + j * block + dstChannels % block) * elemSize;
+            memset(dstPtr, 0, tail * elemSize);
+        });
+    }
+}
 
-        const size_t iter_count = getParentEdgeAt(0)->getMemory().GetSize() / channels[0];
+void MKLDNNConcatNode::execute(mkldnn::stream strm) {
+    if (isOptimized()) {
+        return;
+    }
 
-        parallel_for(iter_count, [&](int i) {
-            const size_t dst_off = i * channels_size;
-            for (int j = 0; j < num_src; j++) {
-                memcpy(dst_ptrs[j] + dst_off, src_ptrs[j] + i * channels[j], channels[j]);
-            }
-        });
-    } else {
-        MKLDNNNode::execute(strm);
+    if (stridedCopy.enabled) {
+        executeStridedCopy();
+        return;
     }
+
+    MKLDNNNode::execute(strm);
 }
@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -30,6 +31,35 @@ private:
     size_t axis = 0;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+
+    bool initStridedCopy();
+    void executeStridedCopy();
+
+    /**
+     * @brief The copy of inputs into strided sub-views of the output, used if the concatenation is not in-place.
+     * Inputs and output share the blocking order, so each input is a set of contiguous chunks starting
+     * from the concat axis. With channel tails of blocked inputs the channels are copied one by one.
+     */
+    struct StridedCopy {
+        bool enabled = false;
+        bool perChannel = false;
+        size_t elemSize = 0;
+        // dimensions of the blocked tensors in front of the concat axis and their strides in elements
+        InferenceEngine::SizeVector outerDims;
+        InferenceEngine::SizeVector dstOuterStrides;
+        std::vector<InferenceEngine::SizeVector> srcOuterStrides;
+        // per input: elements of the contiguous chunk and its offset in the chunk of the output
+        InferenceEngine::SizeVector srcChunks;
+        InferenceEngine::SizeVector dstOffsets;
+        // the blocked channels: channels of the inputs, channel block, and strides of the blocks
+        InferenceEngine::SizeVector channels;
+        size_t block = 1;
+        size_t inner = 1;
+        size_t dstBlockStride = 0;
+        InferenceEngine::SizeVector srcBlockStrides;
+        size_t dstPaddingOffset = 0;
+        InferenceEngine::SizeVector srcPaddingOffsets;
+    } stridedCopy;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_activation_node.h"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
@@ -13,10 +14,214 @@
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include <map>
+#include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+struct jit_eltwise_chain_op {
+    bool is_activation;
+    // binary operation with the input, the current value of the chain is the left operand unless it's swapped
+    EltwiseLayer::eOperation op;
+    size_t input;
+    bool swapped;
+    // activation
+    mkldnn::algorithm alg;
+    float alpha;
+    float beta;
+};
+
+struct jit_eltwise_chain_params {
+    size_t inputs_num;
+    // the input has a single value for the whole row, i.e. it's broadcasted along the innermost dimension
+    bool src_broadcast[MKLDNNEltwiseNode::maxJitInputs];
+    // operations applied one by one to the first input
+    std::vector<jit_eltwise_chain_op> ops;
+};
+
+struct jit_eltwise_chain_call_args {
+    const float *src[MKLDNNEltwiseNode::maxJitInputs];
+    float *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_eltwise_chain_kernel {
+    void (*ker_)(const jit_eltwise_chain_call_args *);
+
+    void operator()(const jit_eltwise_chain_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_eltwise_chain_kernel(const jit_eltwise_chain_params &jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_eltwise_chain_kernel() {}
+
+    jit_eltwise_chain_params jcp_;
+};
+
+}  // namespace MKLDNNPlugin
+
+namespace {
+
+#define GET_OFF(field) offsetof(jit_eltwise_chain_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_eltwise_chain_kernel_f32 : public jit_uni_eltwise_chain_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_eltwise_chain_kernel_f32)
+
+    explicit jit_uni_eltwise_chain_kernel_f32(const jit_eltwise_chain_params &jcp)
+            : jit_uni_eltwise_chain_kernel(jcp), jit_generator() {
+        for (const auto &op : jcp_.ops) {
+            if (op.is_activation)
+                activations.emplace_back(new jit_uni_eltwise_injector_f32<isa>(this,
+                        static_cast<mkldnn::impl::alg_kind_t>(op.alg), op.alpha, op.beta));
+        }
+
+        preamble();
+
+        for (size_t i = 0; i < jcp_.inputs_num; i++)
+            mov(reg_src[i], ptr[reg_params + GET_OFF(src) + i * sizeof(float *)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        Xbyak::Label main_loop_label, tail_loop_label, exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(tail_loop_label, T_NEAR);
+
+            compute(false);
+            advance(vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(exit_label, T_NEAR);
+
+            compute(true);
+            advance(sizeof(float));
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+        postamble();
+
+        for (auto &activation : activations)
+            activation->prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src[MKLDNNEltwiseNode::maxJitInputs] = {r8, r9, r10, r11, r12, r13, r14, r15};
+    Xbyak::Reg64 reg_dst = rbx;
+    Xbyak::Reg64 reg_work_amount = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // Vmm(0) is reserved by the injectors, they keep all other registers except the one they compute
+    Vmm vmm_dst = Vmm(8);
+    Vmm vmm_src = Vmm(9);
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> activations;
+
+    void load(const Vmm &vmm, size_t input, bool scalar) {
+        if (jcp_.src_broadcast[input] && !scalar) {
+            uni_vbroadcastss(vmm, ptr[reg_src[input]]);
+        } else if (scalar) {
+            Xbyak::Xmm xmm(vmm.getIdx());
+            if (isa == cpu::sse42)
+                movss(xmm, ptr[reg_src[input]]);
+            else
+                vmovss(xmm, ptr[reg_src[input]]);
+        } else {
+            uni_vmovups(vmm, ptr[reg_src[input]]);
+        }
+    }
+
+    void store(const Vmm &vmm, bool scalar) {
+        if (scalar) {
+            Xbyak::Xmm xmm(vmm.getIdx());
+            if (isa == cpu::sse42)
+                movss(ptr[reg_dst], xmm);
+            else
+                vmovss(ptr[reg_dst], xmm);
+        } else {
+            uni_vmovups(ptr[reg_dst], vmm);
+        }
+    }
+
+    void compute(bool scalar) {
+        load(vmm_dst, 0, scalar);
+
+        size_t activation_idx = 0;
+        for (const auto &op : jcp_.ops) {
+            if (op.is_activation) {
+                activations[activation_idx++]->compute_vector(vmm_dst.getIdx());
+                continue;
+            }
+
+            load(vmm_src, op.input, scalar);
+            switch (op.op) {
+                case EltwiseLayer::Sum: uni_vaddps(vmm_dst, vmm_dst, vmm_src); break;
+                case EltwiseLayer::Prod: uni_vmulps(vmm_dst, vmm_dst, vmm_src); break;
+                case EltwiseLayer::Max: uni_vmaxps(vmm_dst, vmm_dst, vmm_src); break;
+                case EltwiseLayer::Min: uni_vminps(vmm_dst, vmm_dst, vmm_src); break;
+                case EltwiseLayer::Sub:
+                    if (op.swapped) {
+                        uni_vsubps(vmm_src, vmm_src, vmm_dst);
+                        uni_vmovups(vmm_dst, vmm_src);
+                    } else {
+                        uni_vsubps(vmm_dst, vmm_dst, vmm_src);
+                    }
+                    break;
+                case EltwiseLayer::Div:
+                    if (op.swapped) {
+                        uni_vdivps(vmm_src, vmm_src, vmm_dst);
+                        uni_vmovups(vmm_dst, vmm_src);
+                    } else {
+                        uni_vdivps(vmm_dst, vmm_dst, vmm_src);
+                    }
+                    break;
+                case EltwiseLayer::Squared_diff:
+                    uni_vsubps(vmm_dst, vmm_dst, vmm_src);
+                    uni_vmulps(vmm_dst, vmm_dst, vmm_dst);
+                    break;
+                default:
+                    assert(!"unsupported eltwise operation");
+            }
+        }
+
+        store(vmm_dst, scalar);
+    }
+
+    void advance(int step) {
+        for (size_t i = 0; i < jcp_.inputs_num; i++) {
+            if (!jcp_.src_broadcast[i])
+                add(reg_src[i], step);
+        }
+        add(reg_dst, step);
+    }
+};
+
+#undef GET_OFF
+
+}  // namespace
+
 
 MKLDNNEltwiseNode::MKLDNNEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket) :
         MKLDNNNode(layer, eng, socket) {
@@ -85,9 +290,9 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
     if (op == EltwiseLayer::Squared_diff)
-        if (getParentEdges().size() != 2)
+        if (getInputsNum() != 2)
             THROW_IE_EXCEPTION  << "Incorrect number of input edges for layer " << getName() << " for operation squared_diff.\n"
-                << "Expected: 2\n" << "Actual: " << getParentEdges().size();
+                << "Expected: 2\n" << "Actual: " << getInputsNum();
 
     auto outDims = getChildEdgeAt(0)->getDims();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -96,6 +301,11 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     }
 
     broadcast = isWithBroadcast();
+    // inputs of the fused eltwise nodes may be broadcasted as well
+    for (size_t i = getInputsNum(); i < getParentEdges().size(); i++) {
+        if (getParentEdgeAt(i)->getDims() != outDims)
+            broadcast = true;
+    }
     if (broadcast) {
         auto outDims = getChildEdgeAt(0)->getDims();
         for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -109,17 +319,58 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (op != EltwiseLayer::Sum && with_coeffs)
         THROW_IE_EXCEPTION << "Only sum operation supports operands coefficients";
 
-    if (with_coeffs && eltwiseLayer->coeff.size() != getParentEdges().size())
+    if (with_coeffs && eltwiseLayer->coeff.size() != getInputsNum())
         THROW_IE_EXCEPTION << "Number of provided coefficients is not equal to number of operands";
 
     if (with_coeffs && eltwiseLayer->precision != Precision::FP32)
         THROW_IE_EXCEPTION << "Sum with coefficients supports only FP32 precision";
 
     sum_scales.clear();
-    for (int i = 0; i < getParentEdges().size(); i++)
+    for (int i = 0; i < getInputsNum(); i++)
         sum_scales.push_back(with_coeffs ? eltwiseLayer->coeff[i] : 1.0f);
 }
 
+size_t MKLDNNEltwiseNode::getInputsNum() const {
+    // the node gets extra parent edges with the inputs of the fused eltwise nodes
+    return getCnnLayer()->insData.size();
+}
+
+bool MKLDNNEltwiseNode::isJitSupported() const {
+    auto * eltwiseLayer = dynamic_cast<EltwiseLayer*>(getCnnLayer().get());
+    if (eltwiseLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get eltwise layer " << getName();
+
+    if (eltwiseLayer->precision != Precision::FP32 || !mayiuse(cpu::sse42))
+        return false;
+
+    switch (eltwiseLayer->_operation) {
+        case EltwiseLayer::Sum:
+        case EltwiseLayer::Prod:
+        case EltwiseLayer::Max:
+        case EltwiseLayer::Sub:
+        case EltwiseLayer::Min:
+        case EltwiseLayer::Div:
+        case EltwiseLayer::Squared_diff:
+            break;
+        default:
+            return false;
+    }
+
+    for (auto scale : eltwiseLayer->coeff) {
+        if (scale != 1.0f)
+            return false;
+    }
+
+    if (eltwiseLayer->insData.size() > maxJitInputs || eltwiseLayer->outData[0]->getDims().size() > 5)
+        return false;
+    for (const auto &inData : eltwiseLayer->insData) {
+        if (inData.lock()->getDims().size() > 5)
+            return false;
+    }
+
+    return true;
+}
+
 void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -170,7 +421,7 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
 }
 
 void MKLDNNEltwiseNode::createPrimitive() {
-    if (prim)
+    if (prim || eltwiseKernel)
         return;
 
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -193,7 +444,7 @@ void MKLDNNEltwiseNode::createPrimitive() {
             srcs_p.emplace_back(srcMemPtr->GetPrimitive());
         }
     }
-    if (op == EltwiseLayer::Sum && !broadcast) {
+    if (op == EltwiseLayer::Sum && !broadcast && fusedWith.empty()) {
         try {
             auto primitive_desc = mkldnn::sum::primitive_desc(dstMemPtr->GetDescriptor(), sum_scales, srcs_pd);
             prim = std::shared_ptr<mkldnn::sum>(new mkldnn::sum(primitive_desc, srcs_p, dstMemPtr->GetPrimitive()));
@@ -202,6 +453,87 @@ void MKLDNNEltwiseNode::createPrimitive() {
             prim = nullptr;
         }
     }
+
+    if (!prim && isJitSupported()) {
+        auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+        bool isFP32 = config.outConfs[0].desc.getPrecision() == Precision::FP32;
+        for (const auto& inConf : config.inConfs)
+            isFP32 = isFP32 && inConf.desc.getPrecision() == Precision::FP32;
+
+        if (isFP32) {
+            jit_eltwise_chain_params jcp;
+            jcp.inputs_num = getParentEdges().size();
+
+            for (size_t i = 1; i < getInputsNum(); i++)
+                jcp.ops.push_back({false, op, i, false, algorithm::eltwise_relu, 0.f, 0.f});
+
+            auto lastData = getCnnLayer()->outData[0];
+            size_t nextInput = getInputsNum();
+            for (const auto& fusedNode : fusedWith) {
+                auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(fusedNode.get());
+                auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(fusedNode.get());
+                if (activationNode) {
+                    jcp.ops.push_back({true, op, 0, false, activationNode->getAlgorithm(),
+                                       activationNode->getAlpha(), activationNode->getBeta()});
+                } else if (eltwiseNode) {
+                    auto* fusedLayer = dynamic_cast<EltwiseLayer*>(eltwiseNode->getCnnLayer().get());
+                    if (fusedLayer == nullptr)
+                        THROW_IE_EXCEPTION << "Cannot get eltwise layer " << eltwiseNode->getName();
+                    bool swapped = fusedLayer->insData[1].lock() == lastData;
+                    jcp.ops.push_back({false, fusedLayer->_operation, nextInput++, swapped, algorithm::eltwise_relu, 0.f, 0.f});
+                } else {
+                    THROW_IE_EXCEPTION << "Unsupported node " << fusedNode->getName() << " fused into " << getName();
+                }
+                lastData = fusedNode->getCnnLayer()->outData[0];
+            }
+
+            for (size_t i = 0; i < jcp.inputs_num; i++)
+                jcp.src_broadcast[i] = false;
+
+            collapsed_dims = 0;
+            if (broadcast) {
+                // inner dims are merged into the last one while every input is either broadcasted along all of them
+                // or has them equal to the output ones, so a row is processed by a single kernel call
+                int dims_out[5], dims_in[maxJitInputs][5];
+                dims_calc(dims_out, getChildEdgeAt(0)->getDims());
+                for (size_t i = 0; i < jcp.inputs_num; i++)
+                    dims_calc(dims_in[i], getParentEdgeAt(i)->getDims());
+
+                int full[maxJitInputs];
+                for (size_t i = 0; i < jcp.inputs_num; i++)
+                    full[i] = dims_out[4] == 1 ? -1 : dims_in[i][4] == dims_out[4];
+
+                for (int d = 3; d > batch_dim; d--) {
+                    if (dims_out[d] == 1) {
+                        collapsed_dims++;
+                        continue;
+                    }
+                    bool canCollapse = true;
+                    for (size_t i = 0; i < jcp.inputs_num; i++)
+                        canCollapse = canCollapse && (full[i] == -1 || full[i] == (dims_in[i][d] == dims_out[d]));
+                    if (!canCollapse)
+                        break;
+                    for (size_t i = 0; i < jcp.inputs_num; i++)
+                        full[i] = dims_in[i][d] == dims_out[d];
+                    collapsed_dims++;
+                }
+
+                for (size_t i = 0; i < jcp.inputs_num; i++)
+                    jcp.src_broadcast[i] = full[i] == 0;
+            }
+
+            if (mayiuse(cpu::avx512_common)) {
+                eltwiseKernel.reset(new jit_uni_eltwise_chain_kernel_f32<cpu::avx512_common>(jcp));
+            } else if (mayiuse(cpu::avx2)) {
+                eltwiseKernel.reset(new jit_uni_eltwise_chain_kernel_f32<cpu::avx2>(jcp));
+            } else {
+                eltwiseKernel.reset(new jit_uni_eltwise_chain_kernel_f32<cpu::sse42>(jcp));
+            }
+        }
+    }
+
+    if (!prim && !eltwiseKernel && !fusedWith.empty())
+        THROW_IE_EXCEPTION << "Eltwise node " << getName() << " with fused nodes can't be executed without JIT kernel";
 }
 
 void MKLDNNEltwiseNode::initOptimalPrimitiveDescriptor() {
@@ -2058,9 +2390,66 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
     }
 }
 
+void MKLDNNEltwiseNode::jit_eltwise() {
+    const size_t inputs_num = getParentEdges().size();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const float *src_ptrs[maxJitInputs];
+    for (size_t i = 0; i < inputs_num; i++) {
+        auto& srcMemory = getParentEdgeAt(i)->getMemory();
+        src_ptrs[i] = reinterpret_cast<const float*>(srcMemory.GetData()) +
+                srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    }
+
+    if (!broadcast) {
+        const size_t work_amount = dstMemory.GetSize() / sizeof(float) / dstMemory.GetDims()[0] * batchToProcess();
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work_amount, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            jit_eltwise_chain_call_args args;
+            for (size_t i = 0; i < inputs_num; i++)
+                args.src[i] = src_ptrs[i] + start;
+            args.dst = dst_ptr + start;
+            args.work_amount = end - start;
+            (*eltwiseKernel)(&args);
+        });
+        return;
+    }
+
+    int dims_out[5], offset_out[5];
+    int dims_in[maxJitInputs][5], offset_in[maxJitInputs][5];
+    dims_calc(dims_out, getChildEdgeAt(0)->getDims());
+    offset_out_calc(offset_out, dims_out);
+    for (size_t i = 0; i < inputs_num; i++) {
+        dims_calc(dims_in[i], getParentEdgeAt(i)->getDims());
+        offset_in_calc(offset_in[i], dims_in[i], dims_out);
+    }
+
+    size_t row = dims_out[4];
+    for (int d = 4 - collapsed_dims; d < 4; d++) {
+        row *= dims_out[d];
+        dims_out[d] = 1;
+    }
+
+    parallel_for4d(dims_out[0], dims_out[1], dims_out[2], dims_out[3], [&](size_t i0, size_t i1, size_t i2, size_t i3) {
+        jit_eltwise_chain_call_args args;
+        for (size_t i = 0; i < inputs_num; i++)
+            args.src[i] = src_ptrs[i] + i0 * offset_in[i][0] + i1 * offset_in[i][1] + i2 * offset_in[i][2] + i3 * offset_in[i][3];
+        args.dst = dst_ptr + i0 * offset_out[0] + i1 * offset_out[1] + i2 * offset_out[2] + i3 * offset_out[3];
+        args.work_amount = row;
+        (*eltwiseKernel)(&args);
+    });
+}
+
 void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
     if (prim) {
         MKLDNNNode::execute(strm);
+    } else if (eltwiseKernel) {
+        jit_eltwise();
     } else {
         if (op == EltwiseLayer::Floor_mod) {
             for (size_t i = 0; i < getParentEdges().size(); i++)
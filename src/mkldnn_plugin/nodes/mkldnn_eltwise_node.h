@@ -8,9 +8,12 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
+#include <memory>
 
 namespace MKLDNNPlugin {
 
+struct jit_uni_eltwise_chain_kernel;
+
 class MKLDNNEltwiseNode : public MKLDNNNode {
 public:
     MKLDNNEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
@@ -28,12 +31,23 @@ public:
     bool isWithBroadcast();
     void initOptimalPrimitiveDescriptor() override;
 
+    // the node can be executed by the JIT kernel, which also computes eltwise and activation nodes fused into it
+    bool isJitSupported() const;
+    // max number of inputs of the node together with the inputs of the fused eltwise nodes
+    static constexpr size_t maxJitInputs = 8;
+
 private:
     static Register<MKLDNNEltwiseNode> reg;
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
     bool broadcast = false;
     int batch_dim = 5;
+    std::shared_ptr<jit_uni_eltwise_chain_kernel> eltwiseKernel;
+    // number of inner dims merged into the last one for the JIT kernel in broadcasting mode
+    int collapsed_dims = 0;
+
+    size_t getInputsNum() const;
+    void jit_eltwise();
 
     template <typename T0, typename T1> void ref_eltwise(int in0, int in1);
     void dims_calc(int *dims, const MKLDNNDims &edge_dims);
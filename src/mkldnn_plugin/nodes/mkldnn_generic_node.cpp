@@ -5,6 +5,9 @@
 #include <mkldnn_extension_mngr.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_generic_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_depthwise_node.h"
+#include "mkldnn_quantize_node.h"
 #include <vector>
 #include <string>
 #include <blob_factory.hpp>
@@ -38,17 +41,12 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
         precision = InferenceEngine::Precision::FP32;
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
 
-    if (!extFactory)
-        THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
+    createImplementations();
 
     InferenceEngine::ResponseDesc resp;
-    InferenceEngine::StatusCode rc = extFactory->getImplementations(impls, &resp);
-    if (rc != InferenceEngine::OK) {
-        THROW_IE_EXCEPTION << resp.msg;
-    }
     for (auto &impl : impls) {
         std::vector<InferenceEngine::LayerConfig> configs;
-        rc = impl->getSupportedConfigurations(configs, &resp);
+        InferenceEngine::StatusCode rc = impl->getSupportedConfigurations(configs, &resp);
         if (rc != InferenceEngine::OK) {
             THROW_IE_EXCEPTION << resp.msg;
         }
@@ -67,6 +65,134 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNGenericNode::createImplementations() {
+    if (!impls.empty())
+        return;
+
+    if (!extFactory)
+        THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::StatusCode rc = extFactory->getImplementations(impls, &resp);
+    if (rc != InferenceEngine::OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+}
+
+bool MKLDNNGenericNode::getPostOp(const MKLDNNNodePtr& node, InferenceEngine::LayerPostOp& postOp) {
+    if (!node->getCnnLayer() || node->getCnnLayer()->precision != InferenceEngine::Precision::FP32)
+        return false;
+
+    // values are either broadcasted or given per output channel
+    const size_t channels = outDims[0].ndims() > 1 ? static_cast<size_t>(outDims[0][1]) : 1;
+    auto addValues = [&](const InferenceEngine::Blob::Ptr& blob) {
+        auto* floatBlob = dynamic_cast<InferenceEngine::TBlob<float>*>(blob.get());
+        if (floatBlob == nullptr || (floatBlob->size() != 1 && floatBlob->size() != channels))
+            return false;
+        const float* data = floatBlob->cbuffer().as<const float*>();
+        postOp.data.emplace_back(data, data + floatBlob->size());
+        return true;
+    };
+
+    auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
+    if (activationNode) {
+        switch (activationNode->getAlgorithm()) {
+            case eltwise_relu:
+                postOp.type = InferenceEngine::LayerPostOp::Relu;
+                postOp.alpha = activationNode->getAlpha();
+                break;
+            case eltwise_elu:
+                postOp.type = InferenceEngine::LayerPostOp::Elu;
+                postOp.alpha = activationNode->getAlpha();
+                break;
+            case eltwise_logistic:
+                postOp.type = InferenceEngine::LayerPostOp::Logistic;
+                break;
+            case eltwise_tanh:
+                postOp.type = InferenceEngine::LayerPostOp::Tanh;
+                break;
+            case eltwise_bounded_relu:
+                postOp.type = InferenceEngine::LayerPostOp::Clamp;
+                postOp.alpha = 0.f;
+                postOp.beta = activationNode->getAlpha();
+                break;
+            case eltwise_clamp:
+                postOp.type = InferenceEngine::LayerPostOp::Clamp;
+                postOp.alpha = activationNode->getBeta();
+                postOp.beta = activationNode->getAlpha();
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+
+    auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
+    if (depthwiseNode) {
+        auto* scaleShiftLayer = dynamic_cast<InferenceEngine::WeightableLayer*>(node->getCnnLayer().get());
+        if (depthwiseNode->getAlgorithm() != depthwise_scale_shift || scaleShiftLayer == nullptr)
+            return false;
+
+        postOp.type = InferenceEngine::LayerPostOp::ScaleShift;
+        if (!addValues(scaleShiftLayer->_weights))
+            return false;
+        if (scaleShiftLayer->_biases)
+            return addValues(scaleShiftLayer->_biases);
+        postOp.data.emplace_back(1, 0.f);
+        return true;
+    }
+
+    auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+    if (quantizeNode) {
+        auto* quantizeLayer = dynamic_cast<InferenceEngine::QuantizeLayer*>(node->getCnnLayer().get());
+        if (quantizeLayer == nullptr || node->getParentEdges().size() != 5 ||
+                node->getParentEdgeAt(0)->getParent().get() != this || quantizeNode->isPackedStore())
+            return false;
+
+        postOp.type = InferenceEngine::LayerPostOp::Quantize;
+        postOp.levels = static_cast<size_t>(quantizeLayer->levels);
+        // input low, input high, output low and output high are constant inputs
+        for (size_t i = 1; i < 5; i++) {
+            auto range = node->getParentEdgeAt(i)->getParent();
+            if (range->getType() != Input || !range->getCnnLayer() || range->getCnnLayer()->type != "Const")
+                return false;
+            auto blob = range->getCnnLayer()->blobs.find("custom");
+            if (blob == range->getCnnLayer()->blobs.end() || !addValues(blob->second))
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+bool MKLDNNGenericNode::canFuse(const MKLDNNNodePtr& node) {
+    if (!extFactory || outDims.size() != 1 || getChildEdges().size() != 1 || getChildEdgeAt(0)->getChild() != node)
+        return false;
+
+    InferenceEngine::LayerPostOp postOp;
+    if (!getPostOp(node, postOp))
+        return false;
+
+    // the implementation isn't selected yet, so all of them must apply the operation
+    createImplementations();
+    for (auto &impl : impls) {
+        // implementations built against ILayerExecImpl only have no post operations in the vtable
+        auto* execImpl = dynamic_cast<InferenceEngine::ILayerExecImplWithPostOps*>(impl.get());
+        if (execImpl == nullptr || !execImpl->isPostOpSupported(postOp))
+            return false;
+    }
+    return !impls.empty();
+}
+
+void MKLDNNGenericNode::fusePostOp(const MKLDNNNodePtr& node) {
+    InferenceEngine::LayerPostOp postOp;
+    if (!getPostOp(node, postOp))
+        THROW_IE_EXCEPTION << "Cannot fuse " << node->getName() << " into layer " << getName();
+    postOps.push_back(postOp);
+    fuseWith(node);
+}
+
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory) {
         return;
@@ -201,6 +327,13 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
     if (rc != InferenceEngine::OK) {
         THROW_IE_EXCEPTION << resp.msg;
     }
+    if (!postOps.empty()) {
+        auto* execImpl = dynamic_cast<InferenceEngine::ILayerExecImplWithPostOps*>(impls[0].get());
+        rc = execImpl ? execImpl->setPostOps(postOps, &resp) : InferenceEngine::NOT_IMPLEMENTED;
+        if (rc != InferenceEngine::OK) {
+            THROW_IE_EXCEPTION << "Cannot fuse post operations into layer " << getName() << ": " << resp.msg;
+        }
+    }
 
     auto descriptor = getSelectedPrimitiveDescriptor();
     if (descriptor != nullptr) {
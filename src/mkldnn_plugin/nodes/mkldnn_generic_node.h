@@ -34,6 +34,11 @@ public:
     void execLayer();
     void cleanup() override;
 
+    // returns true if the node can be applied by all implementations of the layer to its output
+    bool canFuse(const MKLDNNNodePtr& node);
+    // the node must be dropped from the graph after the call
+    void fusePostOp(const MKLDNNNodePtr& node);
+
 
 protected:
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
@@ -41,8 +46,12 @@ protected:
     std::vector<InferenceEngine::ILayerImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+    std::vector<InferenceEngine::LayerPostOp> postOps;
 
 private:
+    void createImplementations();
+    bool getPostOp(const MKLDNNNodePtr& node, InferenceEngine::LayerPostOp& postOp);
+
     static Register<MKLDNNGenericNode> reg;
 };
 
@@ -3,12 +3,15 @@
 //
 
 #include "mkldnn_tensoriterator_node.h"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <ie_layers_internal.hpp>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_memcpy.h>
@@ -128,6 +131,129 @@ private:
     const int CHUNK_DATA = 1;
 };
 
+/**
+ * Binds body tensors directly to the chunk of the outer tensor for the iteration instead of copying it.
+ * The chunk has to be a dense part of the outer tensor of the same layout.
+ */
+class PortChunkBindHelper : public PortMapHelper {
+public:
+    PortChunkBindHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNMemoryPtr> &part_blobs,
+            const TensorIterator::PortMap &port_map, int n_iter) : part_blobs(part_blobs) {
+        auto axis = port_map.axis;
+        auto abs_stride = std::abs(port_map.stride);
+        auto sign_of_stride = port_map.stride < 0.0f ? -1 : 1;
+
+        IE_ASSERT(n_iter == full_blob->GetDims()[axis] / abs_stride) << "Shape mismatch for tensor iterator port";
+        iter_count = n_iter;
+
+        mem_holder.push_back(full_blob->GetPrimitive());
+
+        auto full_desc = full_blob->GetDescriptor();
+        auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(full_desc.data.data_type));
+        chunk_stride_in_byte = full_desc.data.layout_desc.blocking.strides[0][axis] * abs_stride * elem_size;
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+    }
+
+    void execute(int n_iter, mkldnn::stream strm) override {
+        IE_ASSERT(n_iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(mem_holder[0].get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * n_iter;
+        for (auto &part_blob : part_blobs)
+            part_blob->GetPrimitivePtr()->set_data_handle(chunk_ptr);
+    }
+
+    // the chunk is dense if all outer dimensions of the iteration axis are equal to 1
+    static bool isApplicable(const MKLDNNMemoryPtr &full_blob, const MKLDNNMemoryPtr &part_blob,
+                             const TensorIterator::PortMap &port_map) {
+        if (port_map.axis < 0)
+            return false;
+
+        auto full_dims = full_blob->GetDims();
+        auto part_dims = part_blob->GetDims();
+        if (full_dims.size() != part_dims.size() || full_blob->GetDataType() != part_blob->GetDataType() ||
+                full_blob->GetFormat() != MKLDNNMemory::GetPlainFormat(full_dims) ||
+                part_blob->GetFormat() != MKLDNNMemory::GetPlainFormat(part_dims) ||
+                part_blob->GetDescriptor().data.layout_desc.blocking.offset_padding != 0)
+            return false;
+
+        for (int i = 0; i < port_map.axis; i++) {
+            if (full_dims[i] != 1)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> part_blobs;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+};
+
+/**
+ * Points the body tensors bound by PortChunkBindHelper back to their own buffers after the last iteration,
+ * so they don't keep the pointer to the outer tensor between executions of the node.
+ */
+class PortChunkRestoreHelper : public PortMapHelper {
+public:
+    PortChunkRestoreHelper(const std::vector<MKLDNNMemoryPtr> &part_blobs, int n_iter) : part_blobs(part_blobs) {
+        for (auto &part_blob : part_blobs)
+            part_defaults.push_back(part_blob->GetData());
+        iter_count = n_iter;
+    }
+
+    void execute(int n_iter, mkldnn::stream strm) override {
+        if (n_iter < iter_count - 1)
+            return;
+
+        for (size_t i = 0; i < part_blobs.size(); i++)
+            part_blobs[i]->GetPrimitivePtr()->set_data_handle(part_defaults[i]);
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> part_blobs;
+    std::vector<void*> part_defaults;
+};
+
+/**
+ * Passes the output of the iteration to the next one by pointer. If the output is kept in the body memory,
+ * the input and output buffers are swapped. Both are restored after the last iteration.
+ */
+class BackEdgeBindHelper : public PortMapHelper {
+public:
+    BackEdgeBindHelper(const std::vector<MKLDNNMemoryPtr> &from, const std::vector<MKLDNNMemoryPtr> &to, bool swap, int n_iter)
+            : from(from), to(to), swap(swap) {
+        from_default = from[0]->GetData();
+        to_default = to[0]->GetData();
+        iter_count = n_iter;
+    }
+
+    void execute(int n_iter, mkldnn::stream strm) override {
+        if (n_iter < iter_count - 1) {
+            void *out_ptr = from[0]->GetData();
+            if (swap)
+                bind(from, to[0]->GetData());
+            bind(to, out_ptr);
+        } else {
+            bind(from, from_default);
+            bind(to, to_default);
+        }
+    }
+
+private:
+    static void bind(const std::vector<MKLDNNMemoryPtr> &mems, void *ptr) {
+        for (auto &mem : mems)
+            mem->GetPrimitivePtr()->set_data_handle(ptr);
+    }
+
+    std::vector<MKLDNNMemoryPtr> from;
+    std::vector<MKLDNNMemoryPtr> to;
+    bool swap;
+    void *from_default;
+    void *to_default;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter) {
@@ -149,6 +275,58 @@ public:
     };
 };
 
+// node only changes the shape, its output shares memory with the input
+static bool isView(const MKLDNNNodePtr &node) {
+    return node->getType() == Reshape || node->getType() == Flatten;
+}
+
+// Collects memories of all edges sharing the output data of the node at the port, so it can be replaced.
+// Fails if a consumer writes into this data or keeps pointers to it.
+static bool collectSharedMemory(const MKLDNNNodePtr &node, int port, std::vector<MKLDNNMemoryPtr> &mems) {
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        if (edge->getInputNum() != port)
+            continue;
+        mems.push_back(edge->getMemoryPtr());
+
+        auto child = edge->getChild();
+        if (child->isConstant())
+            return false;
+        if (isView(child)) {
+            if (child->getChildEdgeAt(0)->getMemory().GetData() != edge->getMemory().GetData() ||
+                    !collectSharedMemory(child, 0, mems))
+                return false;
+            continue;
+        }
+        if (child->isInplace())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+        // split is using different ptrs without offsets
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetData() == edge->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// Collects memories sharing the data of the body output, starting from the node which writes it
+static bool collectOutputMemory(const MKLDNNNodePtr &output, MKLDNNNodePtr &writer, std::vector<MKLDNNMemoryPtr> &mems) {
+    auto edge = output->getParentEdgeAt(0);
+    while (isView(edge->getParent()))
+        edge = edge->getParent()->getParentEdgeAt(0);
+
+    writer = edge->getParent();
+    if (writer->getType() == Input || writer->isConstant() || writer->isInplace())
+        return false;
+
+    return collectSharedMemory(writer, edge->getInputNum(), mems);
+}
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, int socket) :
@@ -161,6 +339,25 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
 
     n_iter = getNumIteration(*ti);
     MKLDNNGraph::ApplyUnrollPasses(ti->body);
+
+    // inputs which are neither iterated nor updated by back edges keep the same data during all iterations
+    std::vector<DataPtr> body_inputs;
+    for (const auto &in_data : ti->body.inputs)
+        if (in_data->getName() != "const_holder")
+            body_inputs.push_back(in_data);
+
+    std::vector<std::string> invariant_inputs;
+    for (size_t i = 0; i < body_inputs.size(); i++) {
+        bool invariant = true;
+        for (const auto &map_rule : ti->input_port_map)
+            invariant &= !(map_rule.to == i && map_rule.axis != -1);
+        for (const auto &map_rule : ti->back_edges)
+            invariant &= map_rule.to != i;
+        if (invariant)
+            invariant_inputs.push_back(body_inputs[i]->getName());
+    }
+    sub_graph.SetLoopInvariantInputs(invariant_inputs);
+
     sub_graph.CreateGraph(ti->body, ext_mng, this->whichSocket());
 
     // Try to detect inputs and outputs by indexes
@@ -178,12 +375,14 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map[in_data->getName()];
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        input_nodes.push_back(in_node);
     }
 
     for (const auto &out_data : ti->body.outputs) {
         auto &out_node = out_map[out_data->getName()];
         auto out_mem = out_node->getParentEdgeAt(0)->getMemoryPtr();
         output_mem.push_back(out_mem);
+        output_nodes.push_back(out_node);
     }
 }
 
@@ -201,35 +400,89 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
-    for (auto map_rule : ti->input_port_map) {
-        auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &intr_mem = input_mem[map_rule.to];
-
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+    // memories to bind to external data, empty if the body tensor has to be copied
+    std::vector<std::vector<MKLDNNMemoryPtr>> input_binds(input_mem.size()), output_binds(output_mem.size());
+    for (size_t i = 0; i < input_mem.size(); i++) {
+        if (!collectSharedMemory(input_nodes[i], 0, input_binds[i]))
+            input_binds[i].clear();
+    }
+    for (size_t i = 0; i < output_mem.size(); i++) {
+        MKLDNNNodePtr writer;
+        // outputs of the loop invariant nodes are written on the first iteration only
+        if (!collectOutputMemory(output_nodes[i], writer, output_binds[i]) || sub_graph.IsLoopInvariant(writer))
+            output_binds[i].clear();
+    }
 
-        in_port_mappers.push_back(mapper);
+    std::vector<bool> is_back_edge_target(input_mem.size(), false);
+    std::map<void*, int> back_edges_from_data;
+    for (auto map_rule : ti->back_edges) {
+        is_back_edge_target[map_rule.to] = true;
+        back_edges_from_data[output_mem[map_rule.from]->GetData()]++;
     }
 
+    // several body outputs may share the same data, it can be bound to the one outer tensor only
+    std::set<void*> bound_outputs;
+    std::vector<std::shared_ptr<PortMapHelper>> output_binders;
+    std::vector<std::shared_ptr<PortMapHelper>> chunk_restorers;
     for (auto map_rule : ti->output_port_map) {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
 
+        if (!output_binds[map_rule.to].empty() && bound_outputs.find(intr_mem->GetData()) == bound_outputs.end() &&
+                PortChunkBindHelper::isApplicable(extr_mem, intr_mem, map_rule)) {
+            bound_outputs.insert(intr_mem->GetData());
+            output_binders.emplace_back(new PortChunkBindHelper(extr_mem, output_binds[map_rule.to], map_rule, n_iter));
+            chunk_restorers.emplace_back(new PortChunkRestoreHelper(output_binds[map_rule.to], n_iter));
+            continue;
+        }
+
         auto mapper = std::shared_ptr<PortMapHelper>(
                 new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
 
+    for (auto map_rule : ti->input_port_map) {
+        auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+        auto &intr_mem = input_mem[map_rule.to];
+
+        if (!input_binds[map_rule.to].empty() && !is_back_edge_target[map_rule.to] &&
+                PortChunkBindHelper::isApplicable(extr_mem, intr_mem, map_rule)) {
+            in_port_mappers.emplace_back(new PortChunkBindHelper(extr_mem, input_binds[map_rule.to], map_rule, n_iter));
+            chunk_restorers.emplace_back(new PortChunkRestoreHelper(input_binds[map_rule.to], n_iter));
+            continue;
+        }
+
+        auto mapper = std::shared_ptr<PortMapHelper>(
+                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+
+        in_port_mappers.push_back(mapper);
+    }
+    // outputs are bound to the chunks of the outer tensors before the iteration
+    in_port_mappers.insert(in_port_mappers.end(), output_binders.begin(), output_binders.end());
+
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
+        // the output bound to the outer tensor is passed as is, the one kept in the body memory is swapped with the input
+        bool swap = bound_outputs.find(from_mem->GetData()) == bound_outputs.end();
+        if (!output_binds[map_rule.from].empty() && !input_binds[map_rule.to].empty() &&
+                (!swap || back_edges_from_data[from_mem->GetData()] == 1) &&
+                from_mem->GetData() != to_mem->GetData() &&
+                MKLDNNMemoryDesc(from_mem->GetDescriptor()) == MKLDNNMemoryDesc(to_mem->GetDescriptor())) {
+            out_port_mappers.emplace_back(
+                    new BackEdgeBindHelper(output_binds[map_rule.from], input_binds[map_rule.to], swap, n_iter));
+            continue;
+        }
+
         auto mapper = std::shared_ptr<PortMapHelper>(
                 new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
+    // the bound tensors get their own buffers back after the last iteration
+    out_port_mappers.insert(out_port_mappers.end(), chunk_restorers.begin(), chunk_restorers.end());
 }
 
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
@@ -240,7 +493,11 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
         for (auto &mapper : in_port_mappers)
             mapper->execute(i, strm);
 
-        sub_graph.Infer();
+        // outputs of the loop invariant nodes are computed once
+        if (i == 0)
+            sub_graph.Infer();
+        else
+            sub_graph.InferLoopVariant();
 
         // copy data from subgraph iteration to outputs
         // or next iteration inputs
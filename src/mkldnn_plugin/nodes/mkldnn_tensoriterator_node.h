@@ -43,6 +43,7 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
 
     std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
 };
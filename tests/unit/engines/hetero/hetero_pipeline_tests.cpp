@@ -0,0 +1,484 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <mock_iasync_infer_request.hpp>
+#include <mock_iexecutable_network.hpp>
+#include "hetero_pipeline.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+
+class HeteroPipelineTests : public ::testing::Test {
+protected:
+    // the infer request of a stage, the inference is done by complete()
+    struct StageRequest {
+        shared_ptr<NiceMock<MockIInferRequest>> _mock;
+        map<string, Blob::Ptr> _blobs;
+        void *_userData = nullptr;
+        IInferRequest::CompletionCallback _callback = nullptr;
+        StatusCode _startStatus = OK;
+        map<string, InferenceEngineProfileInfo> _perfCounts;
+    };
+    typedef pair<size_t, int> RequestId;
+
+    vector<HeteroPipeline::StageDesc> stages;
+    vector<shared_ptr<NiceMock<MockIExecutableNetwork>>> networks;
+    vector<vector<unique_ptr<StageRequest>>> requests;
+    unsigned int optimalNumRequests = 0;
+
+    mutex startedMutex;
+    condition_variable startedCondVar;
+    deque<RequestId> started;
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    static Blob::Ptr makeBlob(float value = 0.f) {
+        auto blob = make_shared_blob<float>({ Precision::FP32, { 1, 4 }, Layout::NC });
+        blob->allocate();
+        for (size_t i = 0; i < blob->size(); i++) {
+            blob->buffer().as<float*>()[i] = value;
+        }
+        return blob;
+    }
+
+    static float value(const Blob::Ptr &blob) {
+        return blob->buffer().as<float*>()[0];
+    }
+
+    static HeteroPipeline::StageDesc stageDesc(const vector<string> &iNames, const vector<string> &oNames) {
+        HeteroPipeline::StageDesc desc;
+        desc._iNames.insert(iNames.begin(), iNames.end());
+        desc._oNames.insert(oNames.begin(), oNames.end());
+        return desc;
+    }
+
+    void addStage(const vector<string> &iNames, const vector<string> &oNames) {
+        size_t stage = stages.size();
+        auto network = make_shared<NiceMock<MockIExecutableNetwork>>();
+        ON_CALL(*network, CreateInferRequest(_, _)).WillByDefault(Invoke(
+                [this, stage](IInferRequest::Ptr &req, ResponseDesc *) {
+                    req = createRequest(stage);
+                    return OK;
+                }));
+        ON_CALL(*network, GetMetric(_, _, _)).WillByDefault(Invoke(
+                [this](const string &name, Parameter &result, ResponseDesc *) {
+                    if (name != METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) || optimalNumRequests == 0)
+                        return NOT_IMPLEMENTED;
+                    result = optimalNumRequests;
+                    return OK;
+                }));
+        networks.push_back(network);
+        requests.emplace_back();
+
+        auto desc = stageDesc(iNames, oNames);
+        desc._network = make_shared<ExecutableNetwork>(network);
+        stages.push_back(desc);
+    }
+
+    IInferRequest::Ptr createRequest(size_t stage) {
+        int index = static_cast<int>(requests[stage].size());
+        requests[stage].emplace_back(new StageRequest());
+        StageRequest *r = requests[stage].back().get();
+        for (auto &&name : stages[stage]._iNames)
+            r->_blobs[name] = makeBlob();
+        for (auto &&name : stages[stage]._oNames)
+            r->_blobs[name] = makeBlob();
+
+        r->_mock = make_shared<NiceMock<MockIInferRequest>>();
+        ON_CALL(*r->_mock, GetBlob(_, _, _)).WillByDefault(Invoke(
+                [r](const char *name, Blob::Ptr &blob, ResponseDesc *) {
+                    auto it = r->_blobs.find(name);
+                    if (it == r->_blobs.end())
+                        return NOT_FOUND;
+                    blob = it->second;
+                    return OK;
+                }));
+        ON_CALL(*r->_mock, SetBlob(_, _, _)).WillByDefault(Invoke(
+                [r](const char *name, const Blob::Ptr &blob, ResponseDesc *) {
+                    r->_blobs[name] = blob;
+                    return OK;
+                }));
+        ON_CALL(*r->_mock, SetUserData(_, _)).WillByDefault(Invoke(
+                [r](void *data, ResponseDesc *) {
+                    r->_userData = data;
+                    return OK;
+                }));
+        ON_CALL(*r->_mock, GetUserData(_, _)).WillByDefault(Invoke(
+                [r](void **data, ResponseDesc *) {
+                    *data = r->_userData;
+                    return OK;
+                }));
+        ON_CALL(*r->_mock, SetCompletionCallback(_)).WillByDefault(Invoke(
+                [r](IInferRequest::CompletionCallback callback) {
+                    r->_callback = callback;
+                    return OK;
+                }));
+        ON_CALL(*r->_mock, GetPerformanceCounts(_, _)).WillByDefault(Invoke(
+                [r](map<string, InferenceEngineProfileInfo> &perfMap, ResponseDesc *) {
+                    perfMap = r->_perfCounts;
+                    return OK;
+                }));
+        ON_CALL(*r->_mock, StartAsync(_)).WillByDefault(Invoke(
+                [this, r, stage, index](ResponseDesc *) {
+                    if (r->_startStatus != OK)
+                        return r->_startStatus;
+                    {
+                        lock_guard<mutex> lock(startedMutex);
+                        started.push_back({ stage, index });
+                    }
+                    startedCondVar.notify_all();
+                    return OK;
+                }));
+        return r->_mock;
+    }
+
+    HeteroPipeline::Job::Ptr makeJob(vector<StatusCode> &statuses, const BlobMap &blobs = {}) {
+        auto job = make_shared<HeteroPipeline::Job>();
+        job->_blobs = blobs;
+        // the job has the blobs of all network inputs
+        for (auto &&stage : stages) {
+            for (auto &&name : stage._iNames) {
+                bool produced = false;
+                for (auto &&producer : stages)
+                    produced = produced || producer._oNames.count(name) != 0;
+                if (!produced && job->_blobs.find(name) == job->_blobs.end())
+                    job->_blobs[name] = makeBlob();
+            }
+        }
+        job->_callback = [&statuses](StatusCode sts) {
+            statuses.push_back(sts);
+        };
+        return job;
+    }
+
+    RequestId popStarted() {
+        lock_guard<mutex> lock(startedMutex);
+        if (started.empty())
+            return { SIZE_MAX, -1 };
+        auto id = started.front();
+        started.pop_front();
+        return id;
+    }
+
+    void complete(const RequestId &id, StatusCode sts = OK) {
+        auto &r = requests[id.first][id.second];
+        ASSERT_NE(nullptr, r->_callback);
+        r->_callback(r->_mock, sts);
+    }
+};
+
+TEST_F(HeteroPipelineTests, lastUseOfChainIsNextStage) {
+    auto lastUses = HeteroPipeline::getLastUses({
+        stageDesc({ "in" }, { "a" }),
+        stageDesc({ "a" }, { "b" }),
+        stageDesc({ "b" }, { "out" }) });
+    ASSERT_EQ(vector<size_t>({ 1, 2, 2 }), lastUses);
+}
+
+TEST_F(HeteroPipelineTests, lastUseIsLastConsumerOfAnyOutput) {
+    auto lastUses = HeteroPipeline::getLastUses({
+        stageDesc({ "in" }, { "a", "c" }),
+        stageDesc({ "a" }, { "b" }),
+        stageDesc({ "b" }, { "d" }),
+        stageDesc({ "c", "d" }, { "out" }) });
+    ASSERT_EQ(vector<size_t>({ 3, 2, 3, 3 }), lastUses);
+}
+
+TEST_F(HeteroPipelineTests, lastUseOfStageWithNetworkOutputsIsStageItself) {
+    auto lastUses = HeteroPipeline::getLastUses({
+        stageDesc({ "in" }, { "out0" }),
+        stageDesc({ "in" }, { "out1" }) });
+    ASSERT_EQ(vector<size_t>({ 0, 1 }), lastUses);
+}
+
+TEST_F(HeteroPipelineTests, throwsWithoutStages) {
+    ASSERT_THROW(HeteroPipeline({}, 1, false), details::InferenceEngineException);
+}
+
+TEST_F(HeteroPipelineTests, createsRequestsOfStages) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 2, false);
+
+    ASSERT_EQ(2, requests[0].size());
+    ASSERT_EQ(2, requests[1].size());
+    ASSERT_EQ(4, pipeline.getNumRequests());
+}
+
+TEST_F(HeteroPipelineTests, zeroStageRequestsUseOptimalNumberOfRequests) {
+    optimalNumRequests = 3;
+    addStage({ "in" }, { "out" });
+    HeteroPipeline pipeline(stages, 0, false);
+
+    ASSERT_EQ(3, pipeline.getNumRequests());
+}
+
+TEST_F(HeteroPipelineTests, zeroStageRequestsCreateOneRequestWithoutMetric) {
+    addStage({ "in" }, { "out" });
+    HeteroPipeline pipeline(stages, 0, false);
+
+    ASSERT_EQ(1, pipeline.getNumRequests());
+}
+
+TEST_F(HeteroPipelineTests, createsBlobsLikeStageRequests) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+
+    auto blob = pipeline.createBlob("out");
+    ASSERT_NE(nullptr, blob);
+    ASSERT_NE(nullptr, blob->buffer().as<float*>());
+    ASSERT_EQ(requests[1][0]->_blobs["out"]->getTensorDesc(), blob->getTensorDesc());
+    ASSERT_THROW(pipeline.createBlob("unknown"), details::InferenceEngineException);
+}
+
+TEST_F(HeteroPipelineTests, bindsBlobsOfJobAndIntermediateBlobsOfProducer) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+
+    vector<StatusCode> statuses;
+    auto in = makeBlob(1.f), out = makeBlob(2.f);
+    pipeline.submit(makeJob(statuses, { { "in", in }, { "out", out } }));
+
+    complete(popStarted());
+    complete(popStarted());
+
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses);
+    ASSERT_EQ(in, requests[0][0]->_blobs["in"]);
+    ASSERT_EQ(out, requests[1][0]->_blobs["out"]);
+    // the intermediate blob is not copied
+    ASSERT_EQ(requests[0][0]->_blobs["a"], requests[1][0]->_blobs["a"]);
+}
+
+TEST_F(HeteroPipelineTests, doesNotSetSameBlobAgain) {
+    addStage({ "in" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+
+    auto in = makeBlob(), out = makeBlob();
+    EXPECT_CALL(*requests[0][0]->_mock, SetBlob(_, _, _)).Times(2);
+
+    vector<StatusCode> statuses;
+    for (int i = 0; i < 3; i++) {
+        pipeline.submit(makeJob(statuses, { { "in", in }, { "out", out } }));
+        complete(popStarted());
+    }
+    ASSERT_EQ(vector<StatusCode>({ OK, OK, OK }), statuses);
+}
+
+TEST_F(HeteroPipelineTests, jobsRunDifferentStagesConcurrently) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "b" });
+    addStage({ "b" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+
+    vector<StatusCode> statuses1, statuses2;
+    pipeline.submit(makeJob(statuses1));
+    ASSERT_EQ(RequestId(0, 0), popStarted());
+    complete({ 0, 0 });
+    ASSERT_EQ(RequestId(1, 0), popStarted());
+
+    // the request of the first stage is held until the second stage reads its output
+    pipeline.submit(makeJob(statuses2));
+    ASSERT_EQ(-1, popStarted().second);
+
+    complete({ 1, 0 });
+    ASSERT_EQ(RequestId(0, 0), popStarted());
+    ASSERT_EQ(RequestId(2, 0), popStarted());
+    ASSERT_EQ(-1, popStarted().second);
+
+    complete({ 2, 0 });
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses1);
+    ASSERT_EQ(-1, popStarted().second);
+
+    complete({ 0, 0 });
+    ASSERT_EQ(RequestId(1, 0), popStarted());
+    complete({ 1, 0 });
+    ASSERT_EQ(RequestId(2, 0), popStarted());
+    complete({ 2, 0 });
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses2);
+}
+
+TEST_F(HeteroPipelineTests, requestIsHeldUntilLastConsumerIsDone) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "b" });
+    addStage({ "a", "b" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+
+    vector<StatusCode> statuses1, statuses2;
+    pipeline.submit(makeJob(statuses1));
+    complete(popStarted());
+    pipeline.submit(makeJob(statuses2));
+    complete(popStarted());
+    ASSERT_EQ(RequestId(2, 0), popStarted());
+    ASSERT_EQ(-1, popStarted().second);
+
+    complete({ 2, 0 });
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses1);
+    ASSERT_EQ(RequestId(0, 0), popStarted());
+}
+
+TEST_F(HeteroPipelineTests, jobsWaitForRequestsInOrder) {
+    addStage({ "in" }, { "out" });
+    HeteroPipeline pipeline(stages, 2, false);
+
+    vector<StatusCode> statuses1, statuses2, statuses3;
+    auto out1 = makeBlob(), out2 = makeBlob(), out3 = makeBlob();
+    pipeline.submit(makeJob(statuses1, { { "out", out1 } }));
+    pipeline.submit(makeJob(statuses2, { { "out", out2 } }));
+    pipeline.submit(makeJob(statuses3, { { "out", out3 } }));
+    ASSERT_EQ(RequestId(0, 0), popStarted());
+    ASSERT_EQ(RequestId(0, 1), popStarted());
+    ASSERT_EQ(-1, popStarted().second);
+
+    complete({ 0, 1 });
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses2);
+    ASSERT_EQ(RequestId(0, 1), popStarted());
+    ASSERT_EQ(out3, requests[0][1]->_blobs["out"]);
+
+    complete({ 0, 0 });
+    complete({ 0, 1 });
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses1);
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses3);
+}
+
+TEST_F(HeteroPipelineTests, failedStageFinishesJobAndReleasesRequests) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+
+    vector<StatusCode> statuses1, statuses2;
+    pipeline.submit(makeJob(statuses1));
+    complete(popStarted());
+    pipeline.submit(makeJob(statuses2));
+    complete(popStarted(), GENERAL_ERROR);
+    ASSERT_EQ(vector<StatusCode>({ GENERAL_ERROR }), statuses1);
+
+    complete(popStarted());
+    complete(popStarted());
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses2);
+}
+
+TEST_F(HeteroPipelineTests, failedStartFinishesJob) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, false);
+    requests[1][0]->_startStatus = GENERAL_ERROR;
+
+    vector<StatusCode> statuses1, statuses2;
+    pipeline.submit(makeJob(statuses1));
+    complete(popStarted());
+    ASSERT_EQ(vector<StatusCode>({ GENERAL_ERROR }), statuses1);
+
+    requests[1][0]->_startStatus = OK;
+    pipeline.submit(makeJob(statuses2));
+    complete(popStarted());
+    complete(popStarted());
+    ASSERT_EQ(vector<StatusCode>({ OK }), statuses2);
+}
+
+TEST_F(HeteroPipelineTests, collectsPerfCountsOfStages) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 1, true);
+    requests[0][0]->_perfCounts["conv"] = {};
+    requests[1][0]->_perfCounts["relu"] = {};
+
+    vector<StatusCode> statuses;
+    auto job = makeJob(statuses);
+    pipeline.submit(job);
+    complete(popStarted());
+    complete(popStarted());
+
+    ASSERT_EQ(2, job->_perfCounts.size());
+    ASSERT_EQ(1, job->_perfCounts[0].count("conv"));
+    ASSERT_EQ(1, job->_perfCounts[1].count("relu"));
+}
+
+TEST_F(HeteroPipelineTests, concurrentJobsGetResultsOfNonPipelinedExecution) {
+    addStage({ "in" }, { "a" });
+    addStage({ "a" }, { "out" });
+    HeteroPipeline pipeline(stages, 2, false);
+
+    // the stage requests are done by the worker threads: a = in + 1, out = a * 2
+    bool stop = false;
+    auto worker = [&] {
+        for (;;) {
+            RequestId id;
+            {
+                unique_lock<mutex> lock(startedMutex);
+                startedCondVar.wait(lock, [&] { return stop || !started.empty(); });
+                if (started.empty())
+                    return;
+                id = started.front();
+                started.pop_front();
+            }
+            auto &blobs = requests[id.first][id.second]->_blobs;
+            auto src = blobs[id.first == 0 ? "in" : "a"]->buffer().as<float*>();
+            auto dst = blobs[id.first == 0 ? "a" : "out"]->buffer().as<float*>();
+            for (size_t i = 0; i < 4; i++)
+                dst[i] = id.first == 0 ? src[i] + 1.f : src[i] * 2.f;
+            complete(id);
+        }
+    };
+    vector<thread> workers;
+    for (int i = 0; i < 4; i++)
+        workers.emplace_back(worker);
+
+    const int numJobs = 200;
+    mutex doneMutex;
+    condition_variable doneCondVar;
+    int done = 0;
+    vector<StatusCode> statuses(numJobs, RESULT_NOT_READY);
+    vector<Blob::Ptr> outputs;
+    for (int i = 0; i < numJobs; i++) {
+        auto job = make_shared<HeteroPipeline::Job>();
+        outputs.push_back(makeBlob());
+        job->_blobs = { { "in", makeBlob(static_cast<float>(i)) }, { "out", outputs.back() } };
+        job->_callback = [&, i](StatusCode sts) {
+            lock_guard<mutex> lock(doneMutex);
+            statuses[i] = sts;
+            done++;
+            doneCondVar.notify_all();
+        };
+        pipeline.submit(job);
+    }
+    {
+        unique_lock<mutex> lock(doneMutex);
+        doneCondVar.wait(lock, [&] { return done == numJobs; });
+    }
+    {
+        lock_guard<mutex> lock(startedMutex);
+        stop = true;
+    }
+    startedCondVar.notify_all();
+    for (auto &&w : workers)
+        w.join();
+
+    for (int i = 0; i < numJobs; i++) {
+        ASSERT_EQ(OK, statuses[i]);
+        ASSERT_EQ((i + 1.f) * 2.f, value(outputs[i]));
+    }
+}
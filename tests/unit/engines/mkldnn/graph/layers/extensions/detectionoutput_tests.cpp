@@ -0,0 +1,323 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct detection_output_test_params {
+    size_t batch;
+    int num_priors;
+    int num_classes;
+    int top_k;
+    int keep_top_k;
+    float nms_threshold;
+    float confidence_threshold;
+
+    // confidences are rounded to the given number of levels to produce equal scores, zero keeps them as is
+    int score_levels;
+
+    // number of inferences measured, the time is printed if it is above 1
+    int iterations;
+};
+
+// Caffe DetectionOutput with shared CENTER_SIZE encoded locations and variances stored with priors
+static void ref_detection_output(const float *loc, const float *conf, const float *priors, float *dst,
+                                 detection_output_test_params p) {
+    const int P = p.num_priors, C = p.num_classes;
+    int count = 0;
+    for (size_t n = 0; n < p.batch; n++) {
+        std::vector<float> boxes(P * 4), sizes(P);
+        for (int i = 0; i < P; i++) {
+            const float *prior = priors + i * 4, *var = priors + P * 4 + i * 4, *l = loc + (n * P + i) * 4;
+            float pw = prior[2] - prior[0], ph = prior[3] - prior[1];
+            float cx = var[0] * l[0] * pw + (prior[0] + prior[2]) / 2.f;
+            float cy = var[1] * l[1] * ph + (prior[1] + prior[3]) / 2.f;
+            float w = std::exp(var[2] * l[2]) * pw, h = std::exp(var[3] * l[3]) * ph;
+            boxes[i * 4 + 0] = cx - w / 2.f;
+            boxes[i * 4 + 1] = cy - h / 2.f;
+            boxes[i * 4 + 2] = cx + w / 2.f;
+            boxes[i * 4 + 3] = cy + h / 2.f;
+            sizes[i] = (boxes[i * 4 + 2] - boxes[i * 4 + 0]) * (boxes[i * 4 + 3] - boxes[i * 4 + 1]);
+        }
+        auto score = [&](int c, int i) { return conf[(n * P + i) * C + c]; };
+
+        std::vector<std::vector<int>> kept(C);
+        std::vector<std::pair<float, std::pair<int, int>>> all;
+        for (int c = 1; c < C; c++) {
+            std::vector<int> candidates;
+            for (int i = 0; i < P; i++) {
+                if (score(c, i) > p.confidence_threshold)
+                    candidates.push_back(i);
+            }
+            std::sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+                return score(c, a) > score(c, b) || (score(c, a) == score(c, b) && a < b);
+            });
+            if (p.top_k > -1 && static_cast<int>(candidates.size()) > p.top_k)
+                candidates.resize(p.top_k);
+
+            for (int i : candidates) {
+                bool keep = true;
+                for (int k : kept[c]) {
+                    float w = std::min(boxes[i * 4 + 2], boxes[k * 4 + 2]) - std::max(boxes[i * 4 + 0], boxes[k * 4 + 0]);
+                    float h = std::min(boxes[i * 4 + 3], boxes[k * 4 + 3]) - std::max(boxes[i * 4 + 1], boxes[k * 4 + 1]);
+                    if (w > 0 && h > 0 && w * h / (sizes[i] + sizes[k] - w * h) > p.nms_threshold) {
+                        keep = false;
+                        break;
+                    }
+                }
+                if (keep) {
+                    kept[c].push_back(i);
+                    all.push_back({score(c, i), {c, i}});
+                }
+            }
+        }
+
+        if (p.keep_top_k > -1 && static_cast<int>(all.size()) > p.keep_top_k) {
+            std::sort(all.begin(), all.end(), [](const std::pair<float, std::pair<int, int>> &a,
+                                                 const std::pair<float, std::pair<int, int>> &b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+            all.resize(p.keep_top_k);
+            for (auto &k : kept)
+                k.clear();
+            for (auto &d : all)
+                kept[d.second.first].push_back(d.second.second);
+        }
+
+        for (int c = 0; c < C; c++) {
+            for (int i : kept[c]) {
+                float *d = dst + count++ * 7;
+                d[0] = static_cast<float>(n);
+                d[1] = static_cast<float>(c);
+                d[2] = score(c, i);
+                std::copy(boxes.begin() + i * 4, boxes.begin() + i * 4 + 4, d + 3);
+            }
+        }
+    }
+    if (count < static_cast<int>(p.batch) * p.keep_top_k)
+        dst[count * 7] = -1;
+}
+
+class MKLDNNCPUExtDetectionOutputTests: public TestsCommon, public WithParamInterface<detection_output_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="DetectionOutput_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_N_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" type="DetectionOutput" precision="FP32" id="4">
+            <data num_classes="_C_" share_location="1" background_label_id="0" nms_threshold="_NMS_" top_k="_TOPK_"
+                  code_type="caffe.PriorBoxParameter.CENTER_SIZE" variance_encoded_in_target="0"
+                  keep_top_k="_KEEPTOPK_" confidence_threshold="_CT_"/>
+            <input>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+                <port id="2">
+                    <dim>_N_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_OUT_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="4" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(detection_output_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_N_", p.batch);
+        REPLACE_WITH_NUM(model, "_LOC_", p.num_priors * 4);
+        REPLACE_WITH_NUM(model, "_CONF_", p.num_priors * p.num_classes);
+        REPLACE_WITH_NUM(model, "_C_", p.num_classes);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_threshold);
+        REPLACE_WITH_NUM(model, "_TOPK_", p.top_k);
+        REPLACE_WITH_NUM(model, "_KEEPTOPK_", p.keep_top_k);
+        REPLACE_WITH_NUM(model, "_CT_", p.confidence_threshold);
+        REPLACE_WITH_NUM(model, "_OUT_", p.batch * p.keep_top_k);
+        return model;
+    }
+
+    static InferenceEngine::Blob::Ptr make_input(const InferenceEngine::SizeVector &dims) {
+        InferenceEngine::Blob::Ptr blob = InferenceEngine::make_shared_blob<float>(
+                { InferenceEngine::Precision::FP32, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims) });
+        blob->allocate();
+        return blob;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            detection_output_test_params p = ::testing::WithParamInterface<detection_output_test_params>::GetParam();
+            // the benchmarks run only if the performance tests are requested
+            if (p.iterations > 1 && nullptr == getenv("DLSDK_performance_test"))
+                GTEST_SKIP();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            const size_t P = p.num_priors;
+            auto loc = make_input({p.batch, P * 4});
+            auto conf = make_input({p.batch, P * p.num_classes});
+            auto priors = make_input({1, 2, P * 4});
+
+            std::mt19937 gen(42);
+            std::uniform_real_distribution<float> unit(0.f, 1.f), offset(-1.f, 1.f);
+            float *loc_data = loc->buffer().as<float *>();
+            for (size_t i = 0; i < loc->size(); i++)
+                loc_data[i] = offset(gen);
+            float *conf_data = conf->buffer().as<float *>();
+            for (size_t i = 0; i < conf->size(); i++) {
+                conf_data[i] = unit(gen);
+                if (p.score_levels > 0)
+                    conf_data[i] = std::ceil(conf_data[i] * p.score_levels) / p.score_levels;
+            }
+            float *priors_data = priors->buffer().as<float *>();
+            for (size_t i = 0; i < P; i++) {
+                float x = unit(gen) * 0.9f, y = unit(gen) * 0.9f;
+                priors_data[i * 4 + 0] = x;
+                priors_data[i * 4 + 1] = y;
+                priors_data[i * 4 + 2] = x + 0.02f + unit(gen) * 0.1f;
+                priors_data[i * 4 + 3] = y + 0.02f + unit(gen) * 0.1f;
+                float *variances = priors_data + P * 4 + i * 4;
+                variances[0] = variances[1] = 0.1f;
+                variances[2] = variances[3] = 0.2f;
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs["loc"] = loc;
+            srcs["conf"] = conf;
+            srcs["priors"] = priors;
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            InferenceEngine::BlobMap outputBlobs;
+            outputBlobs[item.first] = output;
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            float *ref_data = dst_ref.data();
+            std::fill_n(ref_data, dst_ref.size(), 0.f);
+
+            typedef std::chrono::high_resolution_clock Time;
+            typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+            auto start = Time::now();
+            for (int i = 0; i < p.iterations; i++)
+                graph.Infer(srcs, outputBlobs);
+            const double infer_time = std::chrono::duration_cast<ms>(Time::now() - start).count() / p.iterations;
+
+            start = Time::now();
+            ref_detection_output(loc_data, conf_data, priors_data, ref_data, p);
+            const double ref_time = std::chrono::duration_cast<ms>(Time::now() - start).count();
+
+            if (p.iterations > 1)
+                std::cout << "DetectionOutput: " << infer_time << " ms per inference, reference: "
+                          << ref_time << " ms" << std::endl;
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtDetectionOutputTests, TestsDetectionOutput) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutput, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                detection_output_test_params{1, 100, 3, -1, 50, 0.45f, 0.01f, 0, 1},
+                detection_output_test_params{2, 300, 5, 100, 200, 0.45f, 0.3f, 0, 1},
+                detection_output_test_params{1, 1000, 4, 400, 100, 0.3f, 0.01f, 0, 1},
+                detection_output_test_params{2, 2000, 3, 200, 400, 0.6f, -1.f, 0, 1}
+            ));
+
+// equal scores are ordered by the class and then by the prior, both for top_k and keep_top_k,
+// so the detections cut at the equal score are the ones of the lower classes and priors
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutputEqualScores, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                detection_output_test_params{1, 300, 4, 50, 60, 0.45f, 0.01f, 4, 1},
+                detection_output_test_params{2, 1000, 3, 300, 100, 0.5f, 0.3f, 8, 1}
+            ));
+
+// SSD-MobileNet COCO like output of a large image, the benchmark runs with the DLSDK_performance_test
+// environment variable set, e.g. DLSDK_performance_test=1 <tests> --gtest_filter=PerfDetectionOutput*
+INSTANTIATE_TEST_CASE_P(
+        PerfDetectionOutput, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                detection_output_test_params{1, 20000, 91, 100, 100, 0.6f, 0.3f, 0, 10}
+            ));
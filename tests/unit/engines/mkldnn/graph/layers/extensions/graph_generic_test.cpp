@@ -769,6 +769,122 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitive) {
     compare(*output, dst_ref);
 }
 
+TEST_F(MKLDNNGraphGenericTests, DontFusePostOpsIntoImplWithoutPostOpsInterface) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_ReLU" version="2" precision="FP32" batch="1">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="NewDoubleLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="relu" id="2" type="ReLU" precision="FP32">
+                    <input>
+                        <port id="3">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="4">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+                <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+    // the implementation of ILayerExecImpl only doesn't support post operations, so ReLU stays a separate node
+    bool reluFound = false;
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() == "relu")
+            reluFound = true;
+        if (node->getName() == "double_layer")
+            ASSERT_TRUE(node->getFusedWith().empty());
+    }
+    ASSERT_TRUE(reluFound);
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 5, 5};
+
+    InferenceEngine::Blob::Ptr src =
+           InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::TBlob<float>* srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+    if (srcPtr == nullptr)
+        FAIL() << "Cannot cast blob to TBlob<float>.";
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+    InferenceEngine::OutputsDataMap out;
+    out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+
+    ref_double(*srcPtr, dst_ref);
+    float *ref = dst_ref.data();
+    for (size_t i = 0; i < dst_ref.size(); i++) {
+        ref[i] = std::max(ref[i], 0.f);
+    }
+
+    compare(*output, dst_ref);
+}
+
 TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithTwoOutputs) {
     std::string model = R"V0G0N(
         <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="1">
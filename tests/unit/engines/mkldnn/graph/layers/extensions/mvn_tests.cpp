@@ -359,3 +359,186 @@ INSTANTIATE_TEST_CASE_P(
         /*23*/  mvn_test_params{{2, 64, 24, 32, 40}, 1, 1, 0.00001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
                 mvn_test_params{{1, 64, 32, 32, 32}, 0, 1, 0.001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown }
             ));
+
+class MKLDNNCPUExtMVNPostOpsTests: public TestsCommon, public WithParamInterface<mvn_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="mvn" id="2" type="MVN" precision="FP32">
+            <data across_channels="_AC_" normalize_variance="_NV_" eps="_EPS_"/>
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" id="3" type="ReLU" precision="FP32">
+            <data negative_slope="0.1"/>
+            <input>
+                <port id="5">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="scaleshift" id="4" type="ScaleShift" precision="FP32">
+            <input>
+                <port id="7">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    __SRC_DIMS__
+                </port>
+            </output>
+            <weights offset="0" size="_SZ_"/>
+            <biases offset="_SZ_" size="_SZ_"/>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+)V0G0N";
+
+    std::string getModel(mvn_test_params p) {
+        std::string model = layers_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        std::string s_dims;
+        for (auto& dim : p.dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+
+        REPLACE_WITH_NUM(model, "_AC_", p.across_channels);
+        REPLACE_WITH_NUM(model, "_NV_", p.normalize_variance);
+        REPLACE_WITH_NUM(model, "_EPS_", p.eps);
+        REPLACE_WITH_NUM(model, "_SZ_", p.dims[1] * sizeof(float));
+
+        model = IRTemplateGenerator::getIRTemplate("MVN_PostOps", p.dims, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            mvn_test_params p = ::testing::WithParamInterface<mvn_test_params>::GetParam();
+            std::string model = getModel(p);
+            const size_t C = p.dims[1];
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>({ Precision::U8, {2 * C * sizeof(float)}, Layout::C });
+            weights->allocate();
+            float *scaleShift = weights->buffer().as<float *>();
+            for (size_t c = 0; c < C; c++) {
+                scaleShift[c] = 0.5f + 0.01f * c;
+                scaleShift[C + c] = 0.1f * c - 1.f;
+            }
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // ReLU and ScaleShift are applied by the MVN implementation
+            bool mvnFound = false;
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE("relu", node->getName());
+                ASSERT_NE("scaleshift", node->getName());
+                if (node->getName() == "mvn") {
+                    mvnFound = true;
+                    ASSERT_EQ(2u, node->getFusedWith().size());
+                }
+            }
+            ASSERT_TRUE(mvnFound);
+
+            Layout layout = p.dims.size() == 5 ? NCDHW : NCHW;
+            Blob::Ptr src = make_shared_blob<float>({ Precision::FP32, p.dims, layout });
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            BlobMap outputBlobs;
+            TBlob<float>::Ptr output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_mvn(*srcPtr, dst_ref, p);
+            float *ref = dst_ref.data();
+            const size_t spatial = dst_ref.size() / p.dims[0] / C;
+            for (size_t i = 0; i < dst_ref.size(); i++) {
+                const size_t c = (i / spatial) % C;
+                float value = ref[i] > 0.f ? ref[i] : 0.1f * ref[i];
+                ref[i] = value * scaleShift[c] + scaleShift[C + c];
+            }
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtMVNPostOpsTests, TestsMVNWithFusedPostOps) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMVNWithFusedPostOps, MKLDNNCPUExtMVNPostOpsTests,
+        ::testing::Values(
+                mvn_test_params{{2, 64, 15, 15}, 0, 0, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2,  2, 33, 65}, 0, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2, 64, 15, 15}, 1, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2, 19, 15, 15}, 0, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2, 64, 15, 15}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2, 64, 8, 16, 20}, 1, 1, 0.00001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown }
+            ));
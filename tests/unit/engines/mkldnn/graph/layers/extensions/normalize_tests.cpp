@@ -0,0 +1,350 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+using namespace single_layer_tests;
+
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+static bool isBlockedInput(MKLDNNGraphTestClass &graph, const std::string &name) {
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() == name)
+            return node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout() == BLOCKED;
+    }
+    return false;
+}
+
+// the lanes of the last channel block past the channels of the output of the node are zero
+static bool isBlockedTailZero(MKLDNNGraphTestClass &graph, const std::string &name) {
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != name)
+            continue;
+        auto edge = node->getChildEdgeAt(0);
+        TensorDesc desc = edge->getDesc();
+        const SizeVector &blkDims = desc.getBlockingDesc().getBlockDims();
+        if (blkDims.size() <= desc.getDims().size())
+            return false;
+        const size_t C = desc.getDims()[1], CB = blkDims[1], blk = blkDims.back();
+        size_t spatial = 1;
+        for (size_t i = 2; i + 1 < blkDims.size(); i++)
+            spatial *= blkDims[i];
+        const float *data = static_cast<const float*>(edge->getMemory().GetData()) +
+                            desc.getBlockingDesc().getOffsetPadding();
+        for (size_t n = 0; n < blkDims[0]; n++)
+        for (size_t i = 0; i < spatial; i++)
+        for (size_t c = C; c < CB * blk; c++) {
+            if (data[((n * CB + c / blk) * spatial + i) * blk + c % blk] != 0.f)
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+class MKLDNNCPUExtNormalizeBlockedTests: public TestsCommon, public WithParamInterface<std::tuple<vector<size_t>, bool, bool, bool>> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="FakeLayerBLK" precision="FP32">
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="normalize" id="2" type="Normalize" precision="FP32">
+            <data across_spatial="_AS_" channel_shared="_CS_" eps="0.000001"/>
+            <weights offset="0" size="_WS_"/>
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+__POST_OP__)V0G0N";
+
+    // logistic of the zero lanes past the channels isn't zero
+    std::string sigmoid_t = R"V0G0N(
+        <layer name="sigmoid" id="3" type="Activation" precision="FP32">
+            <data type="sigmoid"/>
+            <input>
+                <port id="5">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+__POST_OP_EDGE__)V0G0N";
+
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            SizeVector dims = std::get<0>(GetParam());
+            bool across_spatial = std::get<1>(GetParam());
+            bool channel_shared = std::get<2>(GetParam());
+            bool with_sigmoid = std::get<3>(GetParam());
+            const size_t C = dims[1], HW = dims[2] * dims[3];
+            const size_t weightsSize = channel_shared ? 1 : C;
+
+            std::string model = layers_t;
+            std::string edges = edges_t;
+            REPLACE_WITH_STR(model, "__POST_OP__", with_sigmoid ? sigmoid_t : "");
+            REPLACE_WITH_STR(edges, "__POST_OP_EDGE__", with_sigmoid ?
+                "        <edge from-layer=\"2\" from-port=\"4\" to-layer=\"3\" to-port=\"5\"/>\n" : "");
+            std::string s_dims;
+            for (auto& dim : dims) {
+                s_dims += "\n                    <dim>";
+                s_dims += std::to_string(dim) + "</dim>";
+            }
+            REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+            REPLACE_WITH_NUM(model, "_AS_", across_spatial ? 1 : 0);
+            REPLACE_WITH_NUM(model, "_CS_", channel_shared ? 1 : 0);
+            REPLACE_WITH_NUM(model, "_WS_", weightsSize * sizeof(float));
+            model = IRTemplateGenerator::getIRTemplate("Normalize_Only", dims, "FP32", model, edges);
+
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>({ Precision::U8, {weightsSize * sizeof(float)}, Layout::C });
+            weights->allocate();
+            fill_data(weights->buffer().as<float*>(), weightsSize);
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+            ASSERT_TRUE(isBlockedInput(graph, "normalize"));
+            // the logistic is applied by the Normalize implementation
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE("sigmoid", node->getName());
+            }
+
+            Blob::Ptr src = make_shared_blob<float>({ Precision::FP32, dims, NCHW });
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, DataPtr> item = *out.begin();
+            TBlob<float>::Ptr output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            BlobMap outputBlobs;
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            const float *src_data = src->buffer().as<const float*>();
+            const float *scl = weights->buffer().as<const float*>();
+            float *ref_data = dst_ref.data();
+            for (size_t n = 0; n < dims[0]; n++) {
+                const float *psrc = src_data + n * C * HW;
+                float *pref = ref_data + n * C * HW;
+                for (size_t hw = 0; hw < HW; hw++) {
+                    float norm = 1e-6f;
+                    for (size_t c = 0; c < C; c++) {
+                        for (size_t i = across_spatial ? 0 : hw; i < (across_spatial ? HW : hw + 1); i++)
+                            norm += psrc[c * HW + i] * psrc[c * HW + i];
+                    }
+                    for (size_t c = 0; c < C; c++) {
+                        float value = psrc[c * HW + hw] / std::sqrt(norm) * scl[channel_shared ? 0 : c];
+                        pref[c * HW + hw] = with_sigmoid ? 1.f / (1.f + std::exp(-value)) : value;
+                    }
+                }
+            }
+            compare(*output, dst_ref, 0.0001f);
+            ASSERT_TRUE(isBlockedTailZero(graph, "normalize"));
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtNormalizeBlockedTests, TestsNormalizeBlocked) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalizeBlocked, MKLDNNCPUExtNormalizeBlockedTests,
+        ::testing::Combine(
+                ::testing::Values(SizeVector{2, 3, 5, 7}, SizeVector{1, 20, 4, 6}),
+                ::testing::Bool(),
+                ::testing::Bool(),
+                ::testing::Bool()));
+
+class MKLDNNCPUExtNormalizePostOpsTests: public TestsCommon, public WithParamInterface<vector<size_t>> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="FakeLayerPLN" precision="FP32">
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="normalize" id="2" type="Normalize" precision="FP32">
+            <data across_spatial="0" channel_shared="0" eps="0.000001"/>
+            <weights offset="0" size="_WS_"/>
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" id="3" type="ReLU" precision="FP32">
+            <data negative_slope="0.1"/>
+            <input>
+                <port id="5">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+)V0G0N";
+
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            SizeVector dims = GetParam();
+            const size_t C = dims[1], HW = dims[2] * dims[3];
+
+            std::string model = layers_t;
+            std::string s_dims;
+            for (auto& dim : dims) {
+                s_dims += "\n                    <dim>";
+                s_dims += std::to_string(dim) + "</dim>";
+            }
+            REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+            REPLACE_WITH_NUM(model, "_WS_", C * sizeof(float));
+            model = IRTemplateGenerator::getIRTemplate("Normalize_PostOps", dims, "FP32", model, edges_t);
+
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>({ Precision::U8, {C * sizeof(float)}, Layout::C });
+            weights->allocate();
+            fill_data(weights->buffer().as<float*>(), C);
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+            ASSERT_FALSE(isBlockedInput(graph, "normalize"));
+            // ReLU is applied by the Normalize implementation
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE("relu", node->getName());
+            }
+
+            Blob::Ptr src = make_shared_blob<float>({ Precision::FP32, dims, NCHW });
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, DataPtr> item = *out.begin();
+            TBlob<float>::Ptr output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            BlobMap outputBlobs;
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            const float *src_data = src->buffer().as<const float*>();
+            const float *scl = weights->buffer().as<const float*>();
+            float *ref_data = dst_ref.data();
+            for (size_t n = 0; n < dims[0]; n++) {
+                const float *psrc = src_data + n * C * HW;
+                float *pref = ref_data + n * C * HW;
+                for (size_t hw = 0; hw < HW; hw++) {
+                    float norm = 1e-6f;
+                    for (size_t c = 0; c < C; c++)
+                        norm += psrc[c * HW + hw] * psrc[c * HW + hw];
+                    for (size_t c = 0; c < C; c++) {
+                        float value = psrc[c * HW + hw] / std::sqrt(norm) * scl[c];
+                        pref[c * HW + hw] = value > 0.f ? value : 0.1f * value;
+                    }
+                }
+            }
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtNormalizePostOpsTests, TestsNormalizePostOps) {}
+
+// spatial sizes cover several tiles of pixels and the tails of the vector loops
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalizePostOps, MKLDNNCPUExtNormalizePostOpsTests,
+        ::testing::Values(SizeVector{2, 3, 5, 7}, SizeVector{1, 20, 13, 11}));
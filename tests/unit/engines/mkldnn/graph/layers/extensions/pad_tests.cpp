@@ -0,0 +1,248 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+using namespace single_layer_tests;
+
+
+struct pad_test_params {
+    // Formats: NCHW
+    vector<size_t> dims;
+    vector<size_t> pads_begin;
+    vector<size_t> pads_end;
+    std::string pad_mode;
+    float pad_value;
+
+    bool isBlockedFormat;
+    // Pad takes the blocked input of FakeLayerBLK without a reorder
+    bool isBlockedPad;
+};
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+static bool isBlockedInput(MKLDNNGraphTestClass &graph, const std::string &name) {
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() == name)
+            return node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout() == BLOCKED;
+    }
+    return false;
+}
+
+// the lanes of the last channel block past the channels of the output of the node are zero
+static bool isBlockedTailZero(MKLDNNGraphTestClass &graph, const std::string &name) {
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != name)
+            continue;
+        auto edge = node->getChildEdgeAt(0);
+        TensorDesc desc = edge->getDesc();
+        const SizeVector &blkDims = desc.getBlockingDesc().getBlockDims();
+        if (blkDims.size() <= desc.getDims().size())
+            return false;
+        const size_t C = desc.getDims()[1], CB = blkDims[1], blk = blkDims.back();
+        size_t spatial = 1;
+        for (size_t i = 2; i + 1 < blkDims.size(); i++)
+            spatial *= blkDims[i];
+        const float *data = static_cast<const float*>(edge->getMemory().GetData()) +
+                            desc.getBlockingDesc().getOffsetPadding();
+        for (size_t n = 0; n < blkDims[0]; n++)
+        for (size_t i = 0; i < spatial; i++)
+        for (size_t c = C; c < CB * blk; c++) {
+            if (data[((n * CB + c / blk) * spatial + i) * blk + c % blk] != 0.f)
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+static int ref_pad_index(int idx, int dim, int pad_begin, const std::string &mode) {
+    int src = idx - pad_begin;
+    if (src >= 0 && src < dim)
+        return src;
+    if (mode == "constant")
+        return -1;
+    if (mode == "edge")
+        return src < 0 ? 0 : dim - 1;
+    if (mode == "reflect")
+        return src < 0 ? -src : 2 * (dim - 1) - src;
+    // symmetric
+    return src < 0 ? -src - 1 : 2 * dim - 1 - src;
+}
+
+void ref_pad(const TBlob<float> &src, TBlob<float> &dst, pad_test_params prm) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+    const SizeVector &src_dims = prm.dims;
+    const SizeVector &dst_dims = dst.getTensorDesc().getDims();
+
+    size_t dst_idx = 0;
+    for (size_t n = 0; n < dst_dims[0]; n++)
+    for (size_t c = 0; c < dst_dims[1]; c++)
+    for (size_t h = 0; h < dst_dims[2]; h++)
+    for (size_t w = 0; w < dst_dims[3]; w++) {
+        int sn = ref_pad_index(n, src_dims[0], prm.pads_begin[0], prm.pad_mode);
+        int sc = ref_pad_index(c, src_dims[1], prm.pads_begin[1], prm.pad_mode);
+        int sh = ref_pad_index(h, src_dims[2], prm.pads_begin[2], prm.pad_mode);
+        int sw = ref_pad_index(w, src_dims[3], prm.pads_begin[3], prm.pad_mode);
+        if (sn < 0 || sc < 0 || sh < 0 || sw < 0)
+            dst_data[dst_idx++] = prm.pad_value;
+        else
+            dst_data[dst_idx++] = src_data[((sn * src_dims[1] + sc) * src_dims[2] + sh) * src_dims[3] + sw];
+    }
+}
+
+class MKLDNNCPUExtPadTests: public TestsCommon, public WithParamInterface<pad_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="pad" id="2" type="Pad" precision="FP32">
+            <data pads_begin="_PB_" pads_end="_PE_" pad_mode="_PM_" pad_value="_PV_"/>
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __DST_DIMS__
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+)V0G0N";
+
+    std::string getModel(pad_test_params p) {
+        std::string model = layers_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        std::string s_dims, d_dims;
+        for (size_t i = 0; i < p.dims.size(); i++) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(p.dims[i]) + "</dim>";
+            d_dims += "\n                    <dim>";
+            d_dims += std::to_string(p.dims[i] + p.pads_begin[i] + p.pads_end[i]) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+        REPLACE_WITH_STR(model, "__DST_DIMS__", d_dims);
+
+        REPLACE_WITH_NUM_VECTOR(model, "_PB_", p.pads_begin);
+        REPLACE_WITH_NUM_VECTOR(model, "_PE_", p.pads_end);
+        REPLACE_WITH_STR(model, "_PM_", p.pad_mode);
+        REPLACE_WITH_NUM(model, "_PV_", p.pad_value);
+
+        model = IRTemplateGenerator::getIRTemplate("Pad_Only", p.dims, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            pad_test_params p = ::testing::WithParamInterface<pad_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            ASSERT_EQ(p.isBlockedPad, isBlockedInput(graph, "pad"));
+
+            Blob::Ptr src = make_shared_blob<float>({ Precision::FP32, p.dims, NCHW });
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_pad(*srcPtr, dst_ref, p);
+            compare(*output, dst_ref, 0.0001f);
+            if (p.isBlockedPad)
+                ASSERT_TRUE(isBlockedTailZero(graph, "pad"));
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtPadTests, TestsPad) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPad, MKLDNNCPUExtPadTests,
+        ::testing::Values(
+                pad_test_params{{2, 3, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "constant", 0.5f, false, false },
+                pad_test_params{{2, 3, 5, 7}, {1, 1, 1, 2}, {0, 1, 2, 1}, "constant", 0.5f, false, false },
+                pad_test_params{{2, 3, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "edge", 0.f, false, false },
+                pad_test_params{{2, 3, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "reflect", 0.f, false, false },
+                pad_test_params{{2, 3, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "symmetric", 0.f, false, false },
+                pad_test_params{{2, 3, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "constant", 0.5f, true, true },
+                pad_test_params{{1, 20, 4, 6}, {1, 0, 3, 0}, {0, 0, 0, 3}, "constant", -1.f, true, true },
+                pad_test_params{{2, 20, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "edge", 0.f, true, true },
+                pad_test_params{{2, 20, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "reflect", 0.f, true, true },
+                pad_test_params{{2, 3, 5, 7}, {0, 0, 1, 2}, {0, 0, 2, 1}, "symmetric", 0.f, true, true },
+                // the padded channels need the planar Pad and a reorder of its input
+                pad_test_params{{2, 3, 5, 7}, {0, 1, 1, 0}, {0, 2, 0, 1}, "constant", 0.f, true, false }
+            ));
@@ -482,3 +482,192 @@ INSTANTIATE_TEST_CASE_P(
                 reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },{},{ 0, 1, 2 },{ },{ 650 } }
 ));
 
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+// the lanes of the last channel block past the channels of the output of the node are zero
+static bool isBlockedTailZero(MKLDNNGraphTestClass &graph, const std::string &name) {
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != name)
+            continue;
+        auto edge = node->getChildEdgeAt(0);
+        InferenceEngine::TensorDesc desc = edge->getDesc();
+        const InferenceEngine::SizeVector &blkDims = desc.getBlockingDesc().getBlockDims();
+        if (blkDims.size() <= desc.getDims().size())
+            return false;
+        const size_t C = desc.getDims()[1], CB = blkDims[1], blk = blkDims.back();
+        size_t spatial = 1;
+        for (size_t i = 2; i + 1 < blkDims.size(); i++)
+            spatial *= blkDims[i];
+        const float *data = static_cast<const float*>(edge->getMemory().GetData()) +
+                            desc.getBlockingDesc().getOffsetPadding();
+        for (size_t n = 0; n < blkDims[0]; n++)
+        for (size_t i = 0; i < spatial; i++)
+        for (size_t c = C; c < CB * blk; c++) {
+            if (data[((n * CB + c / blk) * spatial + i) * blk + c % blk] != 0.f)
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+// constant axes keeping the channels let Reduce take the blocked input
+class MKLDNNCPUExtReduceBlockedTests : public TestsCommon, public WithParamInterface<reduce_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Reduce_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IN_
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" type="FakeLayerBLK" precision="FP32" id="2">
+            <input>
+                <port id="1">
+                    _IN_
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    _IN_
+                </port>
+            </output>
+        </layer>
+        <layer name="axes_for_reduction" type="Const" precision="I32" id="3">
+            <output>
+                <port id="1">
+                    <dim>_DIM_SIZE_</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="_AXES_SIZE_"/>
+            </blobs>
+        </layer>
+        <layer name="output" id="4" type="_REDUCE_TYPE_" precision="FP32">
+            <data keep_dims="1" />
+            <input>
+                <port id="1">
+                    _IN_
+                </port>
+                <port id="2">
+                    <dim>_DIM_SIZE_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    _OUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="1"/>
+        <edge from-layer="3" from-port="1" to-layer="4" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(reduce_test_params p) {
+        std::string model = model_t;
+        std::string in_shape, out_shape;
+
+        for (size_t i = 0; i < p.in_shape.size(); i++) {
+            in_shape += "<dim>";
+            in_shape += std::to_string(p.in_shape[i]) + "</dim>\n";
+        }
+        for (size_t i = 0; i < p.out_shape.size(); i++) {
+            out_shape += "<dim>";
+            out_shape += std::to_string(p.out_shape[i]) + "</dim>\n";
+        }
+        REPLACE_WITH_STR(model, "_IN_", in_shape);
+        REPLACE_WITH_STR(model, "_OUT_", out_shape);
+        REPLACE_WITH_NUM(model, "_DIM_SIZE_", p.axes_for_reduction.size());
+        REPLACE_WITH_NUM(model, "_AXES_SIZE_", p.axes_for_reduction.size() * sizeof(int32_t));
+        REPLACE_WITH_STR(model, "_REDUCE_TYPE_", p.reduce_type);
+
+        return model;
+    }
+
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            reduce_test_params p = ::testing::WithParamInterface<reduce_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            const size_t axesSize = p.axes_for_reduction.size() * sizeof(int32_t);
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8,
+                { axesSize }, InferenceEngine::C });
+            weights->allocate();
+            memcpy(weights->buffer(), &p.axes_for_reduction[0], axesSize);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            for (auto &node : graph.getNodes()) {
+                if (node->getName() == "output")
+                    ASSERT_EQ(InferenceEngine::BLOCKED,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+            }
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            InferenceEngine::BlobMap outputBlobs;
+            outputBlobs[item.first] = output;
+
+            // small values keep the exponents of LogSumExp finite
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32,
+                p.in_shape, InferenceEngine::TensorDesc::getLayoutByDims(p.in_shape) });
+            src->allocate();
+            float *src_data = src->buffer().as<float*>();
+            for (size_t i = 0; i < src->size(); i++)
+                src_data[i] = static_cast<float>(i % 13) / 4.f + 0.5f;
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            InferenceEngine::SizeVector out_dims;
+            ref_reduce(p.reduce_type, *srcPtr, true, p.axes_for_reduction, dst_ref, out_dims);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("input", src));
+
+            graph.Infer(srcs, outputBlobs);
+            compare(*output, dst_ref);
+            ASSERT_TRUE(isBlockedTailZero(graph, "output"));
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtReduceBlockedTests, TestsReduceBlocked) {}
+
+// the channels are not multiples of the block sizes, the reductions of the zero lanes aren't zero
+INSTANTIATE_TEST_CASE_P(
+    TestsReduceBlocked, MKLDNNCPUExtReduceBlockedTests,
+    ::testing::Values(
+        // Params: reduce_type, keep_dims, in_shape, input_tensor, axes_for_reduction, out_shape
+        reduce_test_params{ "ReduceLogSumExp", true,{ 2, 3, 4, 5 },{},{ 2, 3 },{ 2, 3, 1, 1 } },
+        reduce_test_params{ "ReduceMax", true,{ 1, 20, 3, 3 },{},{ -1, 2 },{ 1, 20, 1, 1 } },
+        reduce_test_params{ "ReduceMean", true,{ 2, 20, 3, 3 },{},{ 0, 2 },{ 1, 20, 1, 3 } },
+        reduce_test_params{ "ReduceSum", true,{ 2, 3, 4, 5 },{},{ 3 },{ 2, 3, 4, 1 } }
+));
@@ -211,3 +211,159 @@ INSTANTIATE_TEST_CASE_P(
                 shuffle_channels_test_params{ { 2, 6, 2 }, -2, 2, test7 },
                 shuffle_channels_test_params{ { 6 }, 0, 2, test8 }
             ));
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+// the lanes of the last channel block past the channels of the output of the node are zero
+static bool isBlockedTailZero(MKLDNNGraphTestClass &graph, const std::string &name) {
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != name)
+            continue;
+        auto edge = node->getChildEdgeAt(0);
+        InferenceEngine::TensorDesc desc = edge->getDesc();
+        const InferenceEngine::SizeVector &blkDims = desc.getBlockingDesc().getBlockDims();
+        if (blkDims.size() <= desc.getDims().size())
+            return false;
+        const size_t C = desc.getDims()[1], CB = blkDims[1], blk = blkDims.back();
+        size_t spatial = 1;
+        for (size_t i = 2; i + 1 < blkDims.size(); i++)
+            spatial *= blkDims[i];
+        const float *data = static_cast<const float*>(edge->getMemory().GetData()) +
+                            desc.getBlockingDesc().getOffsetPadding();
+        for (size_t n = 0; n < blkDims[0]; n++)
+        for (size_t i = 0; i < spatial; i++)
+        for (size_t c = C; c < CB * blk; c++) {
+            if (data[((n * CB + c / blk) * spatial + i) * blk + c % blk] != 0.f)
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+class MKLDNNCPUExtShuffleChannelsBlockedTests : public TestsCommon, public WithParamInterface<shuffle_channels_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="ShuffleChannels_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IN_OUT_
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="2" type="FakeLayerBLK" precision="FP32">
+            <input>
+                <port id="1">
+                    _IN_OUT_
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    _IN_OUT_
+                </port>
+            </output>
+        </layer>
+        <layer name="output" id="3" type="ShuffleChannels" precision="FP32">
+            <data axis="_AX_" group="_GR_"/>
+            <input>
+                <port id="1">
+                    _IN_OUT_
+                </port>
+           </input>
+            <output>
+                <port id="2">
+                    _IN_OUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(shuffle_channels_test_params p) {
+        std::string model = model_t;
+        std::string in_out_shape;
+
+        for (size_t i = 0; i < p.in_out_shape.size(); i++) {
+            in_out_shape += "<dim>";
+            in_out_shape += std::to_string(p.in_out_shape[i]) + "</dim>\n";
+        }
+        REPLACE_WITH_STR(model, "_IN_OUT_", in_out_shape);
+        REPLACE_WITH_NUM(model, "_AX_", p.axis);
+        REPLACE_WITH_NUM(model, "_GR_", p.group);
+
+        return model;
+    }
+
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            shuffle_channels_test_params p = ::testing::WithParamInterface<shuffle_channels_test_params>::GetParam();
+            std::string model = getModel(p);
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // ShuffleChannels takes the blocked input of FakeLayerBLK without a reorder
+            for (auto &node : graph.getNodes()) {
+                if (node->getName() == "output")
+                    ASSERT_EQ(InferenceEngine::BLOCKED,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+            }
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            InferenceEngine::BlobMap outputBlobs;
+            outputBlobs[item.first] = output;
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32,
+                p.in_out_shape, InferenceEngine::TensorDesc::getLayoutByDims(p.in_out_shape) });
+            src->allocate();
+            fill_data_dbgval(src->buffer(), src->size());
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_shuffle_channels(*srcPtr, dst_ref, p.axis, p.group);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("input", src));
+
+            graph.Infer(srcs, outputBlobs);
+            compare(*output, dst_ref);
+            ASSERT_TRUE(isBlockedTailZero(graph, "output"));
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtShuffleChannelsBlockedTests, TestsShuffleChannelsBlocked) {}
+
+// the channels are not multiples of the block sizes and the groups cross the blocks
+INSTANTIATE_TEST_CASE_P(
+    TestsShuffleChannelsBlocked, MKLDNNCPUExtShuffleChannelsBlockedTests,
+            ::testing::Values(
+// Params: in_out_shape, axis, group
+                shuffle_channels_test_params{ { 1, 15, 2, 2 }, 1, 5, {} },
+                shuffle_channels_test_params{ { 2, 15, 3, 2 }, -3, 3, {} },
+                shuffle_channels_test_params{ { 1, 20, 3, 3 }, 1, 4, {} },
+                shuffle_channels_test_params{ { 2, 12, 2, 3, 2 }, 1, 3, {} }
+            ));
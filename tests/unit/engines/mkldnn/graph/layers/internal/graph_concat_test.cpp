@@ -210,27 +210,54 @@ INSTANTIATE_TEST_CASE_P(
                 concat_test_params {
                         {1, 3, 3, 5},
                         {1, 3, 3, 5},
-                        1, 2
+                        1, 5
                 },
                 concat_test_params {
                         {1, 7, 1, 5},
                         {1, 7, 9, 5},
-                        2, 1, MKLDNNPlugin::impl_desc_type::ref
+                        2, 2, MKLDNNPlugin::impl_desc_type::ref
                 },
                 concat_test_params {
                         {1, 2, 3, 5, 3},
                         {1, 5, 3, 5, 3},
-                        1, 2
+                        1, 5
                 },
                 concat_test_params {
                         {1, 32, 3, 4, 5},
                         {1, 32, 3, 4, 5},
-                        1, 6, MKLDNNPlugin::impl_desc_type::unknown
+                        1, 7, MKLDNNPlugin::impl_desc_type::unknown
                 },
                 concat_test_params {
                         {1, 64, 16, 16, 16, 1},
                         {1, 64, 16, 16, 16, 1},
                         5, 1, MKLDNNPlugin::impl_desc_type::ref
+                },
+                // the inputs of spatial size 1 are also channels last views of the output
+                concat_test_params {
+                        {2, 5, 1, 1},
+                        {2, 3, 1, 1},
+                        1, 7, MKLDNNPlugin::impl_desc_type::unknown, {
+                                [](MKLDNNPlugin::PrimitiveDescInfo) {},
+                                [](MKLDNNPlugin::PrimitiveDescInfo) {},
+                                [](MKLDNNPlugin::PrimitiveDescInfo) {},
+                                [](MKLDNNPlugin::PrimitiveDescInfo) {},
+                                [](MKLDNNPlugin::PrimitiveDescInfo) {},
+                                [](MKLDNNPlugin::PrimitiveDescInfo) {},
+                                [](MKLDNNPlugin::PrimitiveDescInfo primitiveDescriptor) {
+                                    ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, primitiveDescriptor.getImplementationType());
+                                    ASSERT_EQ(mkldnn::memory::nhwc, primitiveDescriptor.getOutputLayouts()[0]);
+                                    ASSERT_EQ(InferenceEngine::Layout::NHWC, primitiveDescriptor.getConfig().outConfs[0].desc.getLayout());
+                                    for (const auto& inConf : primitiveDescriptor.getConfig().inConfs) {
+                                        ASSERT_EQ(0, inConf.inPlace);
+                                        ASSERT_EQ(InferenceEngine::Layout::NHWC, inConf.desc.getLayout());
+                                    }
+                                }
+                        }
+                },
+                concat_test_params {
+                        {2, 16, 1, 1, 1},
+                        {2, 16, 1, 1, 1},
+                        1, 8, MKLDNNPlugin::impl_desc_type::unknown
                 }));
 
 class MKLDNNGraphDynBatchConcatTests: public TestsCommon, public WithParamInterface<concat_test_params> {
@@ -1024,6 +1051,193 @@ protected:
 
 TEST_F(MKLDNNGraphTwoInputInConcatTests, TestSecondInputToConcat) {}
 
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+class MKLDNNGraphBlockedTailsConcatTests: public TestsCommon {
+    std::string model_t = R"V0G0N(
+<net name="BlockedTailsConcat" version="2" precision="FP32" batch="2">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fake1" id="3" type="FakeLayerBLK" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fake2" id="4" type="FakeLayerBLK" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="con" id="5" type="Concat" precision="FP32">
+            <concat_data axis="1"/>
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="1" to-layer="4" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="5" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model_t.data(), model_t.length()));
+
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // the channel tail of the first input does not allow the in-place concat,
+            // the blocked inputs are copied by the strided copy without reorders
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getType() == MKLDNNPlugin::Concatenation) {
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    auto config = node->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_GT(0, config.inConfs[0].inPlace);
+                    ASSERT_EQ(InferenceEngine::BLOCKED, config.inConfs[0].desc.getLayout());
+                    ASSERT_EQ(InferenceEngine::BLOCKED, config.outConfs[0].desc.getLayout());
+                }
+                if (node->getType() == MKLDNNPlugin::Reorder) {
+                    ASSERT_NE(MKLDNNPlugin::Concatenation, node->getChildEdgeAt(0)->getChild()->getType());
+                }
+            }
+
+            InferenceEngine::SizeVector dims_src1 = {2, 3, 2, 5};
+            InferenceEngine::SizeVector dims_src2 = {2, 5, 2, 5};
+
+            InferenceEngine::Blob::Ptr src1 = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src1, InferenceEngine::NCHW});
+            src1->allocate();
+            fill_data(src1->buffer(), src1->size());
+            InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src2, InferenceEngine::NCHW});
+            src2->allocate();
+            fill_data(src2->buffer(), src2->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src1));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", src2));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            float *src1_ptr = src1->buffer();
+            float *src2_ptr = src2->buffer();
+            float *dst_ptr = output->buffer();
+
+            int len1 = 3 * 2 * 5, len2 = 5 * 2 * 5;
+            int index1 = 0, index2 = 0, index = 0;
+            for (int n = 0; n < 2; n++) {
+                for (int i1 = 0; i1 < len1; i1++) {
+                    if (src1_ptr[index1] != dst_ptr[index])
+                    {
+                        FAIL() << "index: " << index << " src: " << src1_ptr[index1] << ", dst: " << dst_ptr[index];
+                    }
+                    index1++; index++;
+                }
+                for (int i2 = 0; i2 < len2; i2++) {
+                    if (src2_ptr[index2] != dst_ptr[index])
+                    {
+                        FAIL() << "index: " << index << " src: " << src2_ptr[index2] << ", dst: " << dst_ptr[index];
+                    }
+                    index2++; index++;
+                }
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_F(MKLDNNGraphBlockedTailsConcatTests, TestStridedCopyOfBlockedInputsWithChannelTails) {}
+
 class MKLDNNGraphIncorrectConcatTests: public TestsCommon,
                               public WithParamInterface<concat_test_params> {
     std::string model_t = R"V0G0N(
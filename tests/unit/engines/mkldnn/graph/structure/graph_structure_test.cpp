@@ -11,6 +11,7 @@
 #include <ext_list.hpp>
 #include <ie_builders.hpp>
 #include <ie_ir_reader.hpp>
+#include <sstream>
 
 using namespace ::testing;
 using namespace std;
@@ -6812,3 +6813,1185 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     compare(*outputBlobs["concat"], *dstOut);
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestGraphRestoredFromExportedState) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1728"/>
+            <biases offset="1728" size="64"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {1792}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    MKLDNNPlugin::MKLDNNGraphCache graphCache;
+    graph.ExportCache(graphCache);
+
+    InferenceEngine::InputsDataMap inputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+    std::stringstream blob;
+    MKLDNNPlugin::MKLDNNModelSerial::Export(blob, net_reader.getNetwork(), inputs, outputs, {}, graphCache);
+    MKLDNNPlugin::MKLDNNModelSerial::Model imported;
+    ASSERT_NO_THROW(imported = MKLDNNPlugin::MKLDNNModelSerial::Import(blob));
+    ASSERT_NE(nullptr, imported.graphCache);
+
+    // the export is reproducible and the truncated file is reported as the usual IE error
+    std::stringstream blob2;
+    MKLDNNPlugin::MKLDNNModelSerial::Export(blob2, net_reader.getNetwork(), inputs, outputs, {}, graphCache);
+    ASSERT_EQ(blob.str(), blob2.str());
+    std::stringstream truncated(blob.str().substr(0, blob.str().size() / 2));
+    ASSERT_THROW(MKLDNNPlugin::MKLDNNModelSerial::Import(truncated), InferenceEngine::details::InferenceEngineException);
+    // the length of the CPU name following the 16 bytes header is corrupted, nothing is allocated for it
+    std::string corruptedData = blob.str();
+    std::fill(corruptedData.begin() + 16, corruptedData.begin() + 24, '\xff');
+    std::stringstream corrupted(corruptedData);
+    ASSERT_THROW(MKLDNNPlugin::MKLDNNModelSerial::Import(corrupted), InferenceEngine::details::InferenceEngineException);
+
+    MKLDNNGraphTestClass restoredGraph;
+    restoredGraph.setGraphCache(imported.graphCache);
+    restoredGraph.CreateGraph(imported.network);
+
+    for (auto &node : restoredGraph.getNodes()) {
+        const auto *state = graphCache.find(node->getName());
+        ASSERT_NE(nullptr, state);
+        ASSERT_EQ(state->selectedPrimitiveDescriptor, node->getSupportedPrimitiveDescriptors().empty() ? -1 :
+                  static_cast<int>(node->getSelectedPrimitiveDescriptor() - &node->getSupportedPrimitiveDescriptors()[0]));
+    }
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 16, 16};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    InferenceEngine::BlobMap outputBlobs, restoredOutputBlobs;
+    for (auto &item : outputs) {
+        InferenceEngine::TBlob<float>::Ptr output, restoredOutput;
+        output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        restoredOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        restoredOutput->allocate();
+        restoredOutputBlobs[item.first] = restoredOutput;
+    }
+
+    graph.Infer(srcs, outputBlobs);
+    restoredGraph.Infer(srcs, restoredOutputBlobs);
+
+    for (auto &item : outputBlobs) {
+        compare(*item.second, *restoredOutputBlobs[item.first]);
+    }
+
+    // the weights are taken from the imported state as is, without the reorder of the network ones:
+    // zeroed reordered weights leave the bias only in the output
+    ASSERT_NE(nullptr, imported.graphCache->find("conv"));
+    auto zeroedCache = std::make_shared<MKLDNNPlugin::MKLDNNGraphCache>();
+    for (auto &node : imported.graphCache->getNodes()) {
+        auto state = node.second;
+        if (node.first == "conv") {
+            ASSERT_EQ(2, state.internalBlobs.size());
+            std::fill(state.internalBlobs[0].begin(), state.internalBlobs[0].end(), 0);
+        }
+        zeroedCache->add(node.first, state);
+    }
+    MKLDNNGraphTestClass zeroedGraph;
+    zeroedGraph.setGraphCache(zeroedCache);
+    zeroedGraph.CreateGraph(imported.network);
+
+    InferenceEngine::BlobMap zeroedOutputBlobs;
+    InferenceEngine::TBlob<float>::Ptr zeroedOutput = InferenceEngine::make_shared_blob<float>(outputs["relu"]->getTensorDesc());
+    zeroedOutput->allocate();
+    zeroedOutputBlobs["relu"] = zeroedOutput;
+    zeroedGraph.Infer(srcs, zeroedOutputBlobs);
+
+    const float *bias = reinterpret_cast<const float *>(weights_ptr->cbuffer().as<const uint8_t *>() + 1728);
+    const float *dst = zeroedOutput->cbuffer().as<const float *>();
+    for (size_t c = 0; c < 16; c++) {
+        for (size_t i = 0; i < 16 * 16; i++) {
+            ASSERT_FLOAT_EQ(std::max(0.0f, bias[c]), dst[c * 16 * 16 + i]) << "c=" << c << " i=" << i;
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelBranchesExecution) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="clamp" type="Clamp" precision="FP32" id="2">
+            <data min="-2" max="2"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="3">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="5"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="6"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+    ASSERT_FALSE(graph.IsParallelExecution());
+
+    MKLDNNGraphTestClass parallelGraph;
+    parallelGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                                InferenceEngine::PluginConfigParams::YES}});
+    parallelGraph.CreateGraph(net_reader.getNetwork());
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    ASSERT_TRUE(parallelGraph.IsParallelExecution());
+#endif
+
+    InferenceEngine::SizeVector dims_src = {1, 16, 8, 8};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs, parallelOutputBlobs;
+    for (auto &item : outputs) {
+        InferenceEngine::TBlob<float>::Ptr output, parallelOutput;
+        output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        parallelOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        parallelOutput->allocate();
+        parallelOutputBlobs[item.first] = parallelOutput;
+    }
+
+    graph.Infer(srcs, outputBlobs);
+    parallelGraph.Infer(srcs, parallelOutputBlobs);
+
+    for (auto &item : outputBlobs) {
+        compare(*item.second, *parallelOutputBlobs[item.first]);
+    }
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    parallelGraph.GetPerfData(perfMap);
+    ASSERT_EQ(parallelGraph.IsParallelExecution(), perfMap.find("critical_path") != perfMap.end());
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMeanValuesForIntegerInputs) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    auto inputInfo = net_reader.getNetwork().getInputsInfo().begin()->second;
+    auto &preProcess = inputInfo->getPreProcess();
+    preProcess.init(3);
+    for (size_t c = 0; c < 3; c++)
+        preProcess[c]->meanValue = 10.f * (c + 1);
+    preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 5, 7};
+    InferenceEngine::TBlob<uint8_t>::Ptr srcU8 = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, dims_src, InferenceEngine::NCHW});
+    srcU8->allocate();
+    InferenceEngine::TBlob<float>::Ptr srcFP32 = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    srcFP32->allocate();
+    for (size_t i = 0; i < srcU8->size(); i++) {
+        srcU8->data()[i] = static_cast<uint8_t>(i * 7 % 256);
+        srcFP32->data()[i] = srcU8->data()[i];
+    }
+
+    InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+    auto item = *outputs.begin();
+    InferenceEngine::TBlob<float>::Ptr outputU8 = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    outputU8->allocate();
+    InferenceEngine::TBlob<float>::Ptr outputFP32 = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    outputFP32->allocate();
+
+    InferenceEngine::BlobMap srcs, outputBlobs;
+    srcs["data"] = srcU8;
+    outputBlobs[item.first] = outputU8;
+    graph.Infer(srcs, outputBlobs);
+
+    srcs["data"] = srcFP32;
+    outputBlobs[item.first] = outputFP32;
+    graph.Infer(srcs, outputBlobs);
+
+    compare(*outputFP32, *outputU8);
+    // the first element of the second channel: 2 * (u8 value - mean)
+    size_t idx = 5 * 7;
+    ASSERT_NEAR(2.f * (srcFP32->data()[idx] - 20.f), outputU8->data()[idx], 0.0001f);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMeanAndScaleFusedWithInputLayoutConversion) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="1" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    const float mean[] = {100.f, 50.f, 10.f};
+    const float scale[] = {0.5f, 0.25f, 2.f};
+    auto inputInfo = net_reader.getNetwork().getInputsInfo().begin()->second;
+    auto &preProcess = inputInfo->getPreProcess();
+    preProcess.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        preProcess[c]->meanValue = mean[c];
+        preProcess[c]->stdScale = scale[c];
+    }
+    preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    const size_t N = 2, C = 3, H = 4, W = 5;
+    InferenceEngine::TBlob<uint8_t>::Ptr src = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, {N, C, H, W}, InferenceEngine::NHWC});
+    src->allocate();
+    for (size_t i = 0; i < src->size(); i++)
+        src->data()[i] = static_cast<uint8_t>(i * 13 % 256);
+
+    InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+    auto item = *outputs.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {N, C, H, W}, InferenceEngine::NCHW});
+    output->allocate();
+
+    InferenceEngine::BlobMap srcs, outputBlobs;
+    srcs["data"] = src;
+    outputBlobs[item.first] = output;
+    graph.Infer(srcs, outputBlobs);
+
+    for (size_t n = 0; n < N; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t hw = 0; hw < H * W; hw++) {
+                float value = src->data()[(n * H * W + hw) * C + c];
+                float expected = (value - mean[c]) * scale[c] + 1.f;
+                ASSERT_NEAR(expected, output->data()[(n * C + c) * H * W + hw], 0.0001f);
+            }
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestConvertedInputIsReusedByGraph) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // requests running on the same graph (stream) share the conversion buffer
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U16, {1, 3, 5, 7}, InferenceEngine::NCHW);
+    auto first = graph.GetConvertedInput("data", desc);
+    auto second = graph.GetConvertedInput("data", desc);
+    ASSERT_NE(nullptr, first);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(InferenceEngine::Precision::FP32, first->getTensorDesc().getPrecision());
+
+    InferenceEngine::TensorDesc nhwcDesc(InferenceEngine::Precision::U16, {1, 3, 5, 7}, InferenceEngine::NHWC);
+    auto third = graph.GetConvertedInput("data", nhwcDesc);
+    ASSERT_NE(first, third);
+    ASSERT_EQ(InferenceEngine::NHWC, third->getTensorDesc().getLayout());
+
+    // U16 input is converted by PushInputData in the buffer of the graph
+    InferenceEngine::TBlob<uint16_t>::Ptr src = InferenceEngine::make_shared_blob<uint16_t>(desc);
+    src->allocate();
+    for (size_t i = 0; i < src->size(); i++)
+        src->data()[i] = static_cast<uint16_t>(i * 1000);
+
+    InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+    auto item = *outputs.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+    graph.MKLDNNPlugin::MKLDNNGraph::PushInputData("data", src);
+    graph.MKLDNNPlugin::MKLDNNGraph::Infer();
+    graph.PullOutputData(outputBlobs);
+
+    auto converted = graph.GetConvertedInput("data", desc);
+    ASSERT_EQ(first, converted);
+    for (size_t i = 0; i < src->size(); i++) {
+        ASSERT_FLOAT_EQ(static_cast<float>(src->data()[i]), converted->buffer().as<float *>()[i]);
+        ASSERT_FLOAT_EQ(2.f * src->data()[i], output->data()[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestEltwiseChainFusing) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="data2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="3">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="4">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="prod" type="Eltwise" precision="FP32" id="5">
+            <elementwise_data operation="mul"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sub" type="Eltwise" precision="FP32" id="6">
+            <elementwise_data operation="sub"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="5" to-port="2"/>
+        <edge from-layer="0" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="5" from-port="3" to-layer="6" to-port="2"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    size_t eltwise_nodes = 0;
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+        if (node->getType() == MKLDNNPlugin::Eltwise) {
+            eltwise_nodes++;
+            ASSERT_TRUE(node->isFusedWith(MKLDNNPlugin::Activation));
+            ASSERT_TRUE(node->isFusedWith(MKLDNNPlugin::Eltwise));
+        }
+    }
+    ASSERT_EQ(1, eltwise_nodes);
+
+    InferenceEngine::SizeVector dims_src = {1, 16, 8, 8};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src2->allocate();
+    InferenceEngine::Blob::Ptr scale = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 16, 1, 1}, InferenceEngine::NCHW});
+    scale->allocate();
+
+    float *src_data = src->buffer().as<float *>();
+    float *src2_data = src2->buffer().as<float *>();
+    float *scale_data = scale->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++) {
+        src_data[i] = static_cast<float>(i % 7) - 3.f;
+        src2_data[i] = static_cast<float>(i % 5) * 0.5f - 1.f;
+    }
+    for (size_t i = 0; i < scale->size(); i++) {
+        scale_data[i] = 0.1f * (i + 1);
+    }
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+    srcs["data2"] = src2;
+    srcs["scale"] = scale;
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    float *ref_data = dst_ref.data();
+    const size_t spatial = dims_src[2] * dims_src[3];
+    for (size_t i = 0; i < dst_ref.size(); i++) {
+        ref_data[i] = src_data[i] - (std::max)(src_data[i] + src2_data[i], 0.f) * scale_data[i / spatial];
+    }
+
+    compare(*output, dst_ref);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestTensorIteratorWithBoundPortsAndInvariantBody) {
+    std::string model = R"V0G0N(
+<net name="net" version="4" batch="1">
+    <layers>
+        <layer name="x" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="h0" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="c0" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="w" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="ti" type="TensorIterator" precision="FP32" id="4">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+            <port_map>
+                <input external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1"/>
+                <input external_port_id="1" internal_layer_id="3" internal_port_id="1"/>
+                <input external_port_id="2" internal_layer_id="6" internal_port_id="1"/>
+                <input external_port_id="3" internal_layer_id="1" internal_port_id="0"/>
+                <output external_port_id="4" internal_layer_id="5" internal_port_id="1" axis="1"/>
+                <output external_port_id="5" internal_layer_id="4" internal_port_id="2"/>
+                <output external_port_id="6" internal_layer_id="6" internal_port_id="2"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="4" from-port="2" to-layer="3" to-port="1"/>
+                <edge from-layer="6" from-port="2" to-layer="6" to-port="1"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer name="reshape_in" type="Reshape" precision="FP32" id="0">
+                        <data dim="1,16"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="relu_w" type="ReLU" precision="FP32" id="1">
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="add_x" type="Eltwise" precision="FP32" id="2">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="mul_h" type="Eltwise" precision="FP32" id="3">
+                        <data operation="mul"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="add_h" type="Eltwise" precision="FP32" id="4">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="reshape_out" type="Reshape" precision="FP32" id="5">
+                        <data dim="1,1,16"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="mul_c" type="Eltwise" precision="FP32" id="6">
+                        <data operation="mul"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>16</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="1" to-layer="2" to-port="1"/>
+                    <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+                    <edge from-layer="1" from-port="1" to-layer="3" to-port="0"/>
+                    <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+                    <edge from-layer="3" from-port="2" to-layer="4" to-port="1"/>
+                    <edge from-layer="4" from-port="2" to-layer="5" to-port="0"/>
+                    <edge from-layer="1" from-port="1" to-layer="6" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="4" to-port="2"/>
+        <edge from-layer="3" from-port="0" to-layer="4" to-port="3"/>
+    </edges>
+</net>)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    const size_t seq_len = 5, size = 16;
+    // the node is executed twice with the blobs of the first run released, the body memory bound to the chunks
+    // of the outer tensors is restored after the last iteration, so it doesn't keep pointers to them
+    for (int run = 0; run < 2; run++) {
+        InferenceEngine::BlobMap srcs;
+        std::map<std::string, std::vector<float>> values;
+        for (auto &input : net_reader.getNetwork().getInputsInfo()) {
+            auto blob = InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+            blob->allocate();
+            float *data = blob->buffer().as<float *>();
+            for (size_t i = 0; i < blob->size(); i++)
+                data[i] = 0.25f * static_cast<float>((i + input.first.size() + 4 * run) % 9) - 1.f;
+            values[input.first] = std::vector<float>(data, data + blob->size());
+            srcs[input.first] = blob;
+        }
+
+        InferenceEngine::BlobMap outputBlobs;
+        for (auto &output : net_reader.getNetwork().getOutputsInfo()) {
+            InferenceEngine::TBlob<float>::Ptr blob = InferenceEngine::make_shared_blob<float>(output.second->getTensorDesc());
+            blob->allocate();
+            outputBlobs[output.first] = blob;
+        }
+
+        std::vector<float> seq_ref(seq_len * size), h = values["h0"], c = values["c0"];
+        for (size_t t = 0; t < seq_len; t++) {
+            for (size_t i = 0; i < size; i++) {
+                float w = (std::max)(values["w"][i], 0.f);
+                h[i] = (w + values["x"][t * size + i]) + w * h[i];
+                c[i] = w * c[i];
+                seq_ref[t * size + i] = h[i];
+            }
+        }
+
+        graph.Infer(srcs, outputBlobs);
+
+        // outputs are named after the ports of the TensorIterator, so the map keeps their order
+        std::vector<std::vector<float>> refs = {seq_ref, h, c};
+        ASSERT_EQ(refs.size(), outputBlobs.size());
+        size_t idx = 0;
+        for (auto &output : outputBlobs) {
+            const float *data = output.second->buffer().as<const float *>();
+            const auto &ref = refs[idx++];
+            ASSERT_EQ(ref.size(), output.second->size());
+            for (size_t i = 0; i < ref.size(); i++)
+                ASSERT_NEAR(ref[i], data[i], 1e-4f) << output.first << " at " << i << " of run " << run;
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMemoryStatesAreSwappedWithoutCopies) {
+    std::string model = R"V0G0N(
+<net name="MemoryStates" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="1">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="memory_out" type="Memory" precision="FP32" id="3">
+            <data id="r_3-4" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="memory_in" type="Memory" precision="FP32" id="4">
+            <data id="r_3-4" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="4" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::OutputsDataMap _networkOutputs = net_reader.getNetwork().getOutputsInfo();
+    execNetwork->setNetworkInputs(_networkInputs);
+    execNetwork->setNetworkOutputs(_networkOutputs);
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+
+    auto states = execNetwork->QueryState();
+    ASSERT_EQ(1, states.size());
+    auto state = states[0];
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 10}, InferenceEngine::NC);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    for (size_t i = 0; i < src->size(); i++)
+        src->buffer().as<float *>()[i] = 1.f;
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::StatusCode sts = inferRequest->SetBlob("data", src, &resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *_networkOutputs.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    sts = inferRequest->SetBlob(item.first.c_str(), output, &resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    auto infer = [&](float expectedOutput) {
+        InferenceEngine::StatusCode sts = inferRequest->Infer(&resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_FLOAT_EQ(expectedOutput, output->data()[i]);
+    };
+    auto stateValue = [](const InferenceEngine::Blob::CPtr &blob) {
+        return blob->cbuffer().as<const float *>()[blob->size() - 1];
+    };
+
+    // the first session accumulates the state in the memory of the graph
+    state->Reset();
+    infer(2.f);
+
+    auto stateDesc = state->GetLastState()->getTensorDesc();
+    InferenceEngine::Blob::Ptr secondSession = InferenceEngine::make_shared_blob<float>(stateDesc);
+    secondSession->allocate();
+    for (size_t i = 0; i < secondSession->size(); i++)
+        secondSession->buffer().as<float *>()[i] = 0.f;
+    InferenceEngine::Blob::Ptr secondStorage = secondSession;
+
+    InferenceEngine::Blob::Ptr firstSession = secondSession;
+    state->SwapState(firstSession);
+    ASSERT_NE(secondStorage, firstSession);
+    ASSERT_FLOAT_EQ(1.f, stateValue(firstSession));
+
+    // the second session is updated in its own memory
+    infer(2.f);
+    ASSERT_FLOAT_EQ(1.f, stateValue(secondStorage));
+    // the last state is a copy of the bound memory
+    ASSERT_NE(secondStorage->cbuffer().as<const void *>(), state->GetLastState()->cbuffer().as<const void *>());
+    ASSERT_FLOAT_EQ(1.f, stateValue(state->GetLastState()));
+
+    InferenceEngine::Blob::Ptr previous = firstSession;
+    state->SwapState(previous);
+    ASSERT_EQ(secondStorage, previous);
+
+    infer(4.f);
+    ASSERT_FLOAT_EQ(2.f, stateValue(firstSession));
+    ASSERT_FLOAT_EQ(1.f, stateValue(secondStorage));
+
+    InferenceEngine::Blob::Ptr wrongState = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 5}, InferenceEngine::NC));
+    wrongState->allocate();
+    ASSERT_THROW(state->SwapState(wrongState), InferenceEngine::details::InferenceEngineException);
+}
@@ -253,3 +253,59 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestFitNoOverlapping) {
+
+    int n = 0;                //  |         _____________
+    std::vector<Box> boxes{   //  |   _____|___1_________|
+            {4, 8, 1, n++},   //  |  |_2_____|    ____
+            {6, 7, 3, n++},   //  |  |    |      |    |
+            {2, 3, 3, n++},   //  |__|_3__|______|_3__|___
+            {2, 4, 2, n++},   //      2  3  4  5  6  7  8
+    };
+
+    MemorySolver ms(boxes, MemorySolver::Strategy::BEST_FIT);
+    EXPECT_EQ(ms.solve(), 5);
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i+1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, BestFitFillsGaps) {
+
+    // one long living box and two chains of short boxes
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 6, 1, n++},
+            {0, 2, 2, n++},
+            {3, 4, 2, n++},
+            {5, 6, 2, n++},
+            {0, 2, 2, n++},
+            {3, 4, 2, n++},
+            {5, 6, 2, n++},
+    };
+
+    MemorySolver greedy(boxes);
+    MemorySolver best_fit(boxes, MemorySolver::Strategy::BEST_FIT);
+    EXPECT_LE(best_fit.solve(), greedy.solve());
+    EXPECT_EQ(best_fit.solve(), best_fit.maxDepth());
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = best_fit.getOffset(box1.id);
+        int off2 = best_fit.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i+1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
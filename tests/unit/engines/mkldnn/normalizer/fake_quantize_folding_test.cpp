@@ -0,0 +1,402 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cnn_network_int8_normalizer.hpp>
+#include <cpp/ie_cnn_net_reader.h>
+#include <ie_blob.h>
+#include <ie_precision.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class FakeQuantizeFoldingTests : public ::testing::Test {
+protected:
+    // in -> fq1 [0, 2] -> conv1 -> relu -> fq2 [0, 4] -> conv2 -> fq3 [-1, 1] -> output
+    std::string model = R"V0G0N(
+<net name="fake_quantize" version="6" batch="1">
+    <layers>
+        <layer id="0" name="in" type="Input" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="fq1_low" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="4"/>
+            </blobs>
+        </layer>
+        <layer id="2" name="fq1_high" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="4" size="4"/>
+            </blobs>
+        </layer>
+        <layer id="3" name="fq1" type="FakeQuantize" precision="FP32">
+            <data levels="256"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="conv1" type="Convolution" precision="FP32">
+            <data kernel="1,1" strides="1,1" pads_begin="0,0" pads_end="0,0" dilations="1,1" output="4" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="8" size="48"/>
+                <biases offset="56" size="16"/>
+            </blobs>
+        </layer>
+        <layer id="5" name="relu" type="ReLU" precision="FP32">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="6" name="fq2_low" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="72" size="4"/>
+            </blobs>
+        </layer>
+        <layer id="7" name="fq2_high" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="76" size="4"/>
+            </blobs>
+        </layer>
+        <layer id="8" name="fq2" type="FakeQuantize" precision="FP32">
+            <data levels="256"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="9" name="conv2" type="Convolution" precision="FP32">
+            <data kernel="1,1" strides="1,1" pads_begin="0,0" pads_end="0,0" dilations="1,1" output="4" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="80" size="64"/>
+                <biases offset="144" size="16"/>
+            </blobs>
+        </layer>
+        <layer id="10" name="fq3_low" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="160" size="4"/>
+            </blobs>
+        </layer>
+        <layer id="11" name="fq3_high" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="164" size="4"/>
+            </blobs>
+        </layer>
+        <layer id="12" name="fq3" type="FakeQuantize" precision="FP32">
+            <data levels="256"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="3"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="4"/>
+        <edge from-layer="3" from-port="5" to-layer="4" to-port="0"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="0"/>
+        <edge from-layer="5" from-port="1" to-layer="8" to-port="0"/>
+        <edge from-layer="6" from-port="0" to-layer="8" to-port="1"/>
+        <edge from-layer="7" from-port="0" to-layer="8" to-port="2"/>
+        <edge from-layer="6" from-port="0" to-layer="8" to-port="3"/>
+        <edge from-layer="7" from-port="0" to-layer="8" to-port="4"/>
+        <edge from-layer="8" from-port="5" to-layer="9" to-port="0"/>
+        <edge from-layer="9" from-port="2" to-layer="12" to-port="0"/>
+        <edge from-layer="10" from-port="0" to-layer="12" to-port="1"/>
+        <edge from-layer="11" from-port="0" to-layer="12" to-port="2"/>
+        <edge from-layer="10" from-port="0" to-layer="12" to-port="3"/>
+        <edge from-layer="11" from-port="0" to-layer="12" to-port="4"/>
+    </edges>
+</net>
+)V0G0N";
+
+    // conv2 consuming the data quantized by fq2 is replaced by the layer of the type with the attributes
+    std::string replaceConv2(const std::string& type, const std::string& data) {
+        std::string changed = model;
+        const std::string header = "<layer id=\"9\" name=\"conv2\" type=\"Convolution\" precision=\"FP32\">";
+        const size_t pos = changed.find(header);
+        const size_t dataBegin = changed.find("<data", pos);
+        const size_t dataEnd = changed.find("/>", dataBegin) + 2;
+        changed.replace(dataBegin, dataEnd - dataBegin, data);
+        changed.replace(pos, header.length(),
+                        "<layer id=\"9\" name=\"conv2\" type=\"" + type + "\" precision=\"FP32\">");
+        return changed;
+    }
+
+    CNNNetwork readNetwork(const std::string& xml) {
+        CNNNetReader reader;
+        reader.ReadNetwork(xml.data(), xml.length());
+        reader.SetWeights(getWeights());
+        return reader.getNetwork();
+    }
+
+    TBlob<uint8_t>::Ptr getWeights() {
+        std::vector<float> weights(42, 0.5f);
+        weights[0] = 0.f;
+        weights[1] = 2.f;
+        weights[18] = 0.f;
+        weights[19] = 4.f;
+        weights[40] = -1.f;
+        weights[41] = 1.f;
+
+        TBlob<uint8_t>::Ptr blob(new TBlob<uint8_t>({Precision::U8, {weights.size() * sizeof(float)}, C}));
+        blob->allocate();
+        memcpy(blob->buffer().as<float *>(), weights.data(), weights.size() * sizeof(float));
+        return blob;
+    }
+};
+
+TEST_F(FakeQuantizeFoldingTests, FakeQuantizeOfDataIsFoldedIntoStatistic) {
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+    ASSERT_NO_THROW(reader.SetWeights(getWeights()));
+    CNNNetwork network = reader.getNetwork();
+
+    ICNNNetworkStats* stats = nullptr;
+    ASSERT_EQ(StatusCode::OK, static_cast<ICNNNetwork&>(network).getStats(&stats, nullptr));
+    ASSERT_TRUE(CNNNetworkInt8Normalizer::FoldFakeQuantize(network, *stats));
+
+    // the quantize layer of the network output stays, all of its ranges are kept
+    for (auto name : {"fq1", "fq1_low", "fq1_high", "fq2", "fq2_low", "fq2_high"})
+        ASSERT_THROW(network.getLayerByName(name), InferenceEngineException) << name;
+    for (auto name : {"fq3", "fq3_low", "fq3_high"})
+        ASSERT_NO_THROW(network.getLayerByName(name)) << name;
+
+    auto conv1 = network.getLayerByName("conv1");
+    auto conv2 = network.getLayerByName("conv2");
+    ASSERT_EQ("in", conv1->insData[0].lock()->getCreatorLayer().lock()->name);
+    ASSERT_EQ("relu", conv2->insData[0].lock()->getCreatorLayer().lock()->name);
+    ASSERT_EQ(1u, network.getLayerByName("in")->outData[0]->getInputTo().count("conv1"));
+    ASSERT_EQ(1u, network.getLayerByName("relu")->outData[0]->getInputTo().count("conv2"));
+
+    const auto& nodesStats = stats->getNodesStats();
+    ASSERT_EQ(2u, nodesStats.size());
+    ASSERT_EQ(std::vector<float>(3, 0.f), nodesStats.at("in")->_minOutputs);
+    ASSERT_EQ(std::vector<float>(3, 2.f), nodesStats.at("in")->_maxOutputs);
+    ASSERT_EQ(std::vector<float>(4, 0.f), nodesStats.at("relu")->_minOutputs);
+    ASSERT_EQ(std::vector<float>(4, 4.f), nodesStats.at("relu")->_maxOutputs);
+
+    ASSERT_NO_THROW(CNNNetworkInt8Normalizer::NormalizeNetwork(network, *stats));
+    ASSERT_EQ(Precision::I8, conv1->precision);
+    ASSERT_EQ(Precision::I8, conv2->precision);
+    ASSERT_EQ(Precision::FP32, conv2->outData[0]->getPrecision());
+}
+
+TEST_F(FakeQuantizeFoldingTests, FakeQuantizeChangingRangeIsNotFolded) {
+    // output range of fq1 becomes [0, 1] while the input one is [0, 2]
+    auto pos = model.find("<layer id=\"3\"");
+    ASSERT_NE(std::string::npos, pos);
+    std::string changed = model;
+    const std::string edge = "<edge from-layer=\"2\" from-port=\"0\" to-layer=\"3\" to-port=\"4\"/>";
+    changed.replace(changed.find(edge), edge.length(),
+                    "<edge from-layer=\"11\" from-port=\"0\" to-layer=\"3\" to-port=\"4\"/>");
+
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(changed.data(), changed.length()));
+    ASSERT_NO_THROW(reader.SetWeights(getWeights()));
+    CNNNetwork network = reader.getNetwork();
+
+    ICNNNetworkStats* stats = nullptr;
+    ASSERT_EQ(StatusCode::OK, static_cast<ICNNNetwork&>(network).getStats(&stats, nullptr));
+    ASSERT_TRUE(CNNNetworkInt8Normalizer::FoldFakeQuantize(network, *stats));
+
+    ASSERT_NO_THROW(network.getLayerByName("fq1"));
+    ASSERT_THROW(network.getLayerByName("fq2"), InferenceEngineException);
+    ASSERT_EQ(0u, stats->getNodesStats().count("in"));
+    ASSERT_EQ(1u, stats->getNodesStats().count("relu"));
+}
+
+TEST_F(FakeQuantizeFoldingTests, FakeQuantizeOfFP32ConsumerIsNotFolded) {
+    // the power layer stays FP32, so fq2 is the only layer clamping and rounding its input
+    CNNNetwork network;
+    ASSERT_NO_THROW(network = readNetwork(replaceConv2("Power", "<data power=\"1\" scale=\"1\" shift=\"0\"/>")));
+
+    ICNNNetworkStats* stats = nullptr;
+    ASSERT_EQ(StatusCode::OK, static_cast<ICNNNetwork&>(network).getStats(&stats, nullptr));
+    ASSERT_TRUE(CNNNetworkInt8Normalizer::FoldFakeQuantize(network, *stats));
+
+    ASSERT_THROW(network.getLayerByName("fq1"), InferenceEngineException);
+    for (auto name : {"fq2", "fq2_low", "fq2_high"})
+        ASSERT_NO_THROW(network.getLayerByName(name)) << name;
+    ASSERT_EQ("fq2", network.getLayerByName("conv2")->insData[0].lock()->getCreatorLayer().lock()->name);
+    ASSERT_EQ(1u, stats->getNodesStats().count("in"));
+    ASSERT_EQ(0u, stats->getNodesStats().count("relu"));
+}
+
+TEST_F(FakeQuantizeFoldingTests, FakeQuantizeOfConvolutionMarkedFP32IsNotFolded) {
+    CNNNetwork network;
+    ASSERT_NO_THROW(network = readNetwork(replaceConv2("Convolution",
+            "<data kernel=\"1,1\" strides=\"1,1\" pads_begin=\"0,0\" pads_end=\"0,0\" dilations=\"1,1\" "
+            "output=\"4\" group=\"1\" quantization_level=\"FP32\"/>")));
+
+    ICNNNetworkStats* stats = nullptr;
+    ASSERT_EQ(StatusCode::OK, static_cast<ICNNNetwork&>(network).getStats(&stats, nullptr));
+    ASSERT_TRUE(CNNNetworkInt8Normalizer::FoldFakeQuantize(network, *stats));
+
+    ASSERT_THROW(network.getLayerByName("fq1"), InferenceEngineException);
+    ASSERT_NO_THROW(network.getLayerByName("fq2"));
+    ASSERT_EQ(0u, stats->getNodesStats().count("relu"));
+}
@@ -0,0 +1,286 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_shape_buckets.h"
+#include "mkldnn_exec_network.h"
+#include "details/ie_exception.hpp"
+
+#include <cpp/ie_cnn_net_reader.h>
+#include <ie_plugin_config.hpp>
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(ShapeBucketsTest, ParseKeepsNetworkShapesOfMissingInputs) {
+    MKLDNNShapeBuckets::Shapes network = {{"data", {1, 3, 8, 8}}, {"seq", {1, 4}}};
+    auto buckets = MKLDNNShapeBuckets::Parse("data:1x3x16x16;data:1x3x32x32,seq:1x8;", network);
+
+    ASSERT_EQ(2u, buckets.size());
+    ASSERT_EQ(SizeVector({1, 3, 16, 16}), buckets[0]["data"]);
+    ASSERT_EQ(SizeVector({1, 4}), buckets[0]["seq"]);
+    ASSERT_EQ(SizeVector({1, 3, 32, 32}), buckets[1]["data"]);
+    ASSERT_EQ(SizeVector({1, 8}), buckets[1]["seq"]);
+}
+
+TEST(ShapeBucketsTest, ParseThrowsOnWrongBuckets) {
+    MKLDNNShapeBuckets::Shapes network = {{"data", {1, 3, 8, 8}}};
+
+    ASSERT_THROW(MKLDNNShapeBuckets::Parse("data1x3x16x16", network), details::InferenceEngineException);
+    ASSERT_THROW(MKLDNNShapeBuckets::Parse("input:1x3x16x16", network), details::InferenceEngineException);
+    ASSERT_THROW(MKLDNNShapeBuckets::Parse("data:1x3x16", network), details::InferenceEngineException);
+    ASSERT_THROW(MKLDNNShapeBuckets::Parse("data:1x3x0x16", network), details::InferenceEngineException);
+    ASSERT_THROW(MKLDNNShapeBuckets::Parse("data:1x3xAx16", network), details::InferenceEngineException);
+}
+
+TEST(ShapeBucketsTest, SmallestCoveringBucketIsCompiledOnce) {
+    MKLDNNShapeBuckets::Shapes network = {{"data", {1, 8}}};
+    auto networkGraph = std::make_shared<MKLDNNGraph>();
+    std::vector<SizeVector> compiled;
+    MKLDNNShapeBuckets buckets(MKLDNNShapeBuckets::Parse("data:1x32;data:1x16", network), network, networkGraph,
+                               [&](const MKLDNNShapeBuckets::Shapes &shapes) {
+                                   compiled.push_back(shapes.at("data"));
+                                   return std::make_shared<MKLDNNGraph>();
+                               });
+
+    ASSERT_TRUE(buckets.IsCovered("data", {1, 20}));
+    ASSERT_FALSE(buckets.IsCovered("data", {1, 33}));
+    ASSERT_FALSE(buckets.IsCovered("data", {2, 8}));
+
+    MKLDNNShapeBuckets::Shapes bucketShapes;
+    ASSERT_EQ(networkGraph, buckets.GetGraph({{"data", {1, 8}}}, bucketShapes));
+    ASSERT_EQ(networkGraph, buckets.GetGraph({{"data", {1, 5}}}, bucketShapes));
+    ASSERT_EQ(SizeVector({1, 8}), bucketShapes["data"]);
+
+    auto graph16 = buckets.GetGraph({{"data", {1, 12}}}, bucketShapes);
+    ASSERT_EQ(SizeVector({1, 16}), bucketShapes["data"]);
+    ASSERT_EQ(graph16, buckets.GetGraph({{"data", {1, 16}}}, bucketShapes));
+    ASSERT_NE(graph16, buckets.GetGraph({{"data", {1, 17}}}, bucketShapes));
+    ASSERT_EQ(SizeVector({1, 32}), bucketShapes["data"]);
+
+    ASSERT_THROW(buckets.GetGraph({{"data", {1, 64}}}, bucketShapes), details::InferenceEngineException);
+
+    ASSERT_EQ(std::vector<SizeVector>({{1, 16}, {1, 32}}), compiled);
+    auto statistics = buckets.GetStatistics();
+    ASSERT_EQ(3u, statistics.hits);
+    ASSERT_EQ(2u, statistics.misses);
+    ASSERT_EQ(3u, statistics.padded);
+}
+
+TEST(ShapeBucketsTest, PadCopiesRowsAndFillsTheRestWithZeros) {
+    auto src = make_shared_blob<int16_t>({Precision::I16, {1, 2, 2, 3}, Layout::NCHW});
+    auto dst = make_shared_blob<int16_t>({Precision::I16, {1, 2, 3, 4}, Layout::NCHW});
+    src->allocate();
+    dst->allocate();
+    for (size_t i = 0; i < src->size(); i++)
+        src->buffer().as<int16_t *>()[i] = static_cast<int16_t>(i + 1);
+    for (size_t i = 0; i < dst->size(); i++)
+        dst->buffer().as<int16_t *>()[i] = -1;
+
+    MKLDNNShapeBuckets::Pad(src, dst);
+
+    std::vector<int16_t> ref = { 1,  2,  3, 0,
+                                 4,  5,  6, 0,
+                                 0,  0,  0, 0,
+                                 7,  8,  9, 0,
+                                10, 11, 12, 0,
+                                 0,  0,  0, 0};
+    const int16_t *data = dst->buffer().as<int16_t *>();
+    ASSERT_EQ(ref, std::vector<int16_t>(data, data + dst->size()));
+
+    auto nhwc = make_shared_blob<int16_t>({Precision::I16, {1, 2, 3, 4}, Layout::NHWC});
+    nhwc->allocate();
+    ASSERT_THROW(MKLDNNShapeBuckets::Pad(src, nhwc), details::InferenceEngineException);
+}
+
+class ShapeBucketsInferTest : public ::testing::Test {
+protected:
+    // y = 2 * x + 1, so the padded zeros are seen as ones in the output
+    std::string model = R"V0G0N(
+<net name="PowerOnly" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="1" type="Power" precision="FP32">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    MKLDNNExecNetwork::Ptr load(const std::string &xml, const std::string &buckets) {
+        CNNNetReader reader;
+        reader.ReadNetwork(xml.data(), xml.length());
+        Config cfg;
+        cfg.readProperties({{PluginConfigParams::KEY_CPU_SHAPE_BUCKETS, buckets}});
+        MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNExecNetwork(reader.getNetwork(), cfg, {}));
+        execNetwork->setNetworkInputs(reader.getNetwork().getInputsInfo());
+        execNetwork->setNetworkOutputs(reader.getNetwork().getOutputsInfo());
+        return execNetwork;
+    }
+
+    static Blob::Ptr makeInput(size_t height, size_t width) {
+        auto blob = make_shared_blob<float>({Precision::FP32, {1, 3, height, width}, Layout::NCHW});
+        blob->allocate();
+        for (size_t i = 0; i < blob->size(); i++)
+            blob->buffer().as<float *>()[i] = static_cast<float>(i % 7);
+        return blob;
+    }
+
+    static uint64_t metric(const MKLDNNExecNetwork::Ptr &execNetwork, const std::string &name) {
+        Parameter result;
+        execNetwork->GetMetric(name, result, nullptr);
+        return result.as<uint64_t>();
+    }
+};
+
+TEST_F(ShapeBucketsInferTest, RequestsOfDifferentShapesAreInferredByTheirBuckets) {
+    auto execNetwork = load(model, "data:1x3x8x8;data:1x3x16x16");
+    IInferRequest::Ptr request;
+    execNetwork->CreateInferRequest(request);
+    ResponseDesc resp;
+
+    // an input of the bucket shape gives the output of its shape, a smaller one is padded up to the bucket
+    auto infer = [&](size_t height, size_t width, size_t bucketSize) {
+        auto input = makeInput(height, width);
+        ASSERT_EQ(OK, request->SetBlob("data", input, &resp)) << resp.msg;
+        ASSERT_EQ(OK, request->Infer(&resp)) << resp.msg;
+
+        Blob::Ptr output;
+        ASSERT_EQ(OK, request->GetBlob("power", output, &resp)) << resp.msg;
+        ASSERT_EQ(SizeVector({1, 3, bucketSize, bucketSize}), output->getTensorDesc().getDims());
+        const float *src = input->cbuffer().as<const float *>();
+        const float *dst = output->cbuffer().as<const float *>();
+        for (size_t c = 0; c < 3; c++) {
+            for (size_t h = 0; h < bucketSize; h++) {
+                for (size_t w = 0; w < bucketSize; w++) {
+                    float x = h < height && w < width ? src[(c * height + h) * width + w] : 0.f;
+                    ASSERT_FLOAT_EQ(2.f * x + 1.f, dst[(c * bucketSize + h) * bucketSize + w])
+                            << height << "x" << width << " at " << c << "," << h << "," << w;
+                }
+            }
+        }
+    };
+
+    infer(8, 8, 8);
+    infer(16, 16, 16);
+    infer(4, 4, 4);
+    infer(6, 5, 8);
+    infer(16, 16, 16);
+    infer(12, 9, 16);
+
+    ASSERT_EQ(2u, metric(execNetwork, METRIC_KEY(SHAPE_BUCKETS_MISSES)));
+    ASSERT_EQ(4u, metric(execNetwork, METRIC_KEY(SHAPE_BUCKETS_HITS)));
+    ASSERT_EQ(2u, metric(execNetwork, METRIC_KEY(SHAPE_BUCKETS_PADDED_REQUESTS)));
+
+    // the shape above all buckets is rejected
+    ASSERT_NE(OK, request->SetBlob("data", makeInput(20, 20), &resp));
+}
+
+TEST_F(ShapeBucketsInferTest, NetworkWithMemoryLayersIsRejected) {
+    std::string memoryModel = R"V0G0N(
+<net name="MemoryOnly" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="1">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="4">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="memory_out" type="Memory" precision="FP32" id="2">
+            <data id="r_2-3" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="memory_in" type="Memory" precision="FP32" id="3">
+            <data id="r_2-3" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="2" to-layer="4" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    ASSERT_NO_THROW(load(memoryModel, ""));
+    ASSERT_THROW(load(memoryModel, "data:1x20"), details::InferenceEngineException);
+}
@@ -0,0 +1,230 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_streams_calibration.h"
+#include "details/ie_exception.hpp"
+#include "single_layer_common.hpp"
+
+#include <cpp/ie_cnn_net_reader.h>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+typedef MKLDNNStreamsCalibration::Candidate Candidate;
+typedef MKLDNNStreamsCalibration::Measurement Measurement;
+
+TEST(StreamsCalibrationTest, CandidatesArePowersOfTwoNearCoreSplit) {
+    auto getConfigs = [](int threads, int cores) {
+        std::vector<std::pair<int, int>> configs;
+        for (const auto &candidate : MKLDNNStreamsCalibration::GetCandidates(threads, cores))
+            configs.push_back({candidate.streams, candidate.threadsPerStream});
+        return configs;
+    };
+
+    std::vector<std::pair<int, int>> ref = {{1, 32}, {4, 8}, {8, 4}, {16, 2}};
+    ASSERT_EQ(ref, getConfigs(32, 16));
+    ref = {{1, 12}, {2, 6}, {4, 3}};
+    ASSERT_EQ(ref, getConfigs(12, 6));
+    // the threads limited by the user limit the streams
+    ref = {{1, 4}, {2, 2}, {4, 1}};
+    ASSERT_EQ(ref, getConfigs(4, 16));
+
+    ASSERT_EQ(1u, MKLDNNStreamsCalibration::GetCandidates(0, 0).size());
+}
+
+TEST(StreamsCalibrationTest, SelectsBestThroughputWithinLatencyBound) {
+    auto candidates = MKLDNNStreamsCalibration::GetCandidates(4, 4);
+    // more streams give more throughput and longer latency
+    std::vector<int> measured;
+    auto measurer = [&](const Candidate &candidate) {
+        measured.push_back(candidate.streams);
+        return Measurement{100. * candidate.streams, 10. * candidate.streams};
+    };
+
+    ASSERT_EQ(4, MKLDNNStreamsCalibration::Select(candidates, measurer, 0.f).streams);
+    ASSERT_EQ(std::vector<int>({1, 2, 4}), measured);
+    ASSERT_EQ(2, MKLDNNStreamsCalibration::Select(candidates, measurer, 25.f).streams);
+    // no candidate satisfies the bound
+    ASSERT_EQ(1, MKLDNNStreamsCalibration::Select(candidates, measurer, 5.f).streams);
+
+    ASSERT_THROW(MKLDNNStreamsCalibration::Select({}, measurer, 0.f), details::InferenceEngineException);
+}
+
+TEST(StreamsCalibrationTest, StoredResultsAreReplacedByKeyAndWeights) {
+    const std::string fileName = "streams_calibration_test.txt";
+    std::remove(fileName.c_str());
+
+    ASSERT_TRUE(MKLDNNStreamsCalibration::Load(fileName, "net cpu").empty());
+
+    MKLDNNStreamsCalibration::Store(fileName, "net cpu", "a1", {2, 4});
+    MKLDNNStreamsCalibration::Store(fileName, "other net cpu", "a1", {8, 1});
+    MKLDNNStreamsCalibration::Store(fileName, "net cpu", "b2", {1, 8});
+    MKLDNNStreamsCalibration::Store(fileName, "net cpu", "a1", {4, 2});
+
+    auto stored = MKLDNNStreamsCalibration::Load(fileName, "net cpu");
+    ASSERT_EQ(2u, stored.size());
+    ASSERT_EQ(4, stored["a1"].streams);
+    ASSERT_EQ(2, stored["a1"].threadsPerStream);
+    ASSERT_EQ(1, stored["b2"].streams);
+    stored = MKLDNNStreamsCalibration::Load(fileName, "other net cpu");
+    ASSERT_EQ(1u, stored.size());
+    ASSERT_EQ(8, stored["a1"].streams);
+    ASSERT_TRUE(MKLDNNStreamsCalibration::Load(fileName, "net").empty());
+
+    size_t lines = 0;
+    std::ifstream file(fileName);
+    for (std::string line; std::getline(file, line);)
+        lines++;
+    ASSERT_EQ(3u, lines);
+
+    file.close();
+    std::remove(fileName.c_str());
+}
+
+// the stores of several threads are not mixed in the file, each of them replaces it as a whole
+TEST(StreamsCalibrationTest, ConcurrentStoresKeepFileConsistent) {
+    const std::string fileName = "streams_calibration_concurrent_test.txt";
+    std::remove(fileName.c_str());
+
+    const int threadsNum = 4, storesNum = 16;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < storesNum; i++)
+                MKLDNNStreamsCalibration::Store(fileName, "net " + std::to_string(t), std::to_string(i), {t + 1, i + 1});
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (int t = 0; t < threadsNum; t++) {
+        auto stored = MKLDNNStreamsCalibration::Load(fileName, "net " + std::to_string(t));
+        ASSERT_EQ(static_cast<size_t>(storesNum), stored.size());
+        for (int i = 0; i < storesNum; i++) {
+            ASSERT_EQ(t + 1, stored[std::to_string(i)].streams);
+            ASSERT_EQ(i + 1, stored[std::to_string(i)].threadsPerStream);
+        }
+    }
+    std::remove(fileName.c_str());
+}
+
+TEST(StreamsCalibrationTest, KeyDependsOnNetworkAndLatencyBound) {
+    std::string model = R"V0G0N(
+<net name="PowerOnly" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="1" type="Power" precision="FP32">
+            <power_data power="1" scale="_SCALE_" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    auto getKey = [&](const std::string &scale, float latencyBound) {
+        std::string xml = model;
+        REPLACE_WITH_STR(xml, "_SCALE_", scale);
+        CNNNetReader reader;
+        reader.ReadNetwork(xml.data(), xml.length());
+        return MKLDNNStreamsCalibration::GetKey(reader.getNetwork(), latencyBound);
+    };
+
+    ASSERT_EQ(getKey("2", 0.f), getKey("2", 0.f));
+    ASSERT_NE(getKey("2", 0.f), getKey("3", 0.f));
+    ASSERT_NE(getKey("2", 0.f), getKey("2", 10.f));
+}
+
+TEST(StreamsCalibrationTest, WeightsAreHashedApartFromKey) {
+    std::string model = R"V0G0N(
+<net name="ScaleShiftOnly" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scaleshift" id="1" type="ScaleShift" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="12"/>
+            <biases offset="12" size="12"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    auto getKeys = [&](float scale) {
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>({ Precision::U8, {24}, C });
+        weights->allocate();
+        float *data = weights->buffer().as<float *>();
+        for (size_t i = 0; i < 6; i++)
+            data[i] = scale * i;
+        reader.SetWeights(weights);
+        return std::make_pair(MKLDNNStreamsCalibration::GetKey(reader.getNetwork(), 0.f),
+                              MKLDNNStreamsCalibration::GetWeightsHash(reader.getNetwork()));
+    };
+
+    auto keys = getKeys(1.f), sameKeys = getKeys(1.f), otherKeys = getKeys(2.f);
+    ASSERT_EQ(keys, sameKeys);
+    // the topology key doesn't read the weights
+    ASSERT_EQ(keys.first, otherKeys.first);
+    ASSERT_NE(keys.second, otherKeys.second);
+}
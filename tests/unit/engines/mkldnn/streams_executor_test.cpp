@@ -0,0 +1,46 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_streams.h"
+
+#include <thread>
+#include <chrono>
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(MultiWorkerTaskExecutorTest, CountsExecutedTasksPerStream) {
+    const int streams = 2;
+    std::vector<Task::Ptr> initTasks;
+    for (int n = 0; n < streams; n++)
+        initTasks.push_back(std::make_shared<Task>([] {}));
+    MultiWorkerTaskExecutor executor(initTasks);
+
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 8; i++) {
+        tasks.push_back(std::make_shared<Task>([] { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }));
+        ASSERT_TRUE(executor.startTask(tasks.back()));
+    }
+    for (auto &task : tasks)
+        task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+
+    // counters are updated by the worker right after the task is finished
+    uint64_t executed = 0;
+    for (int attempt = 0; attempt < 100 && executed != tasks.size(); attempt++) {
+        auto utilization = executor.getStreamsUtilization();
+        ASSERT_EQ(streams, utilization.size());
+        executed = 0;
+        for (auto &stream : utilization) {
+            executed += stream.executedTasks;
+            ASSERT_GE(stream.busyRatio, 0.f);
+            ASSERT_LE(stream.busyRatio, 1.f);
+        }
+        if (executed != tasks.size())
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(tasks.size(), executed);
+}
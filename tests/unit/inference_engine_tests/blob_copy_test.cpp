@@ -0,0 +1,231 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <blob_transform.hpp>
+#include <cpu_detector.hpp>
+
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/blob_transform_sse42.hpp"
+#endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/blob_transform_avx512.hpp"
+#endif
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+// widths are not multiples of the vector lengths, so the tails of the rows are covered
+const vector<size_t> widths = { 1, 5, 15, 16, 17, 31, 33, 47, 64, 65, 100 };
+
+template <typename T>
+void fill(T *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<T>((i * 37 + 11) % 251);
+    }
+}
+
+template <typename T>
+Blob::Ptr makeBlob(Precision precision, Layout layout, const SizeVector &dims) {
+    auto blob = make_shared_blob<T>({ precision, dims, layout });
+    blob->allocate();
+    fill(blob->buffer().template as<T*>(), blob->size());
+    return blob;
+}
+
+template <typename T>
+void fillZeros(const Blob::Ptr &blob) {
+    auto data = blob->buffer().as<T*>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = T(0);
+    }
+}
+
+// compares every element of the blobs in the logical NCHW order
+template <typename T>
+void compareBlobs(const Blob::Ptr &ref, const Blob::Ptr &actual) {
+    const auto &refDesc = ref->getTensorDesc();
+    const auto &actualDesc = actual->getTensorDesc();
+    const auto &dims = refDesc.getDims();
+    ASSERT_EQ(dims, actualDesc.getDims());
+
+    const T *refData = ref->cbuffer().as<const T*>();
+    const T *actualData = actual->cbuffer().as<const T*>();
+    for (size_t n = 0; n < dims[0]; n++)
+    for (size_t c = 0; c < dims[1]; c++)
+    for (size_t h = 0; h < dims[2]; h++)
+    for (size_t w = 0; w < dims[3]; w++) {
+        SizeVector idx = { n, c, h, w };
+        ASSERT_EQ(refData[refDesc.offset(idx)], actualData[actualDesc.offset(idx)])
+            << "n=" << n << " c=" << c << " h=" << h << " w=" << w;
+    }
+}
+
+}  // namespace
+
+using BlobCopyParams = std::tuple<Precision, Layout, SizeVector>;
+
+class BlobCopyTests : public TestWithParam<BlobCopyParams> {
+protected:
+    template <typename T>
+    void test(Precision precision, Layout srcLayout, const SizeVector &dims, bool roi) {
+        const Layout dstLayout = srcLayout == NCHW ? NHWC : NCHW;
+
+        Blob::Ptr frame, src;
+        if (roi) {
+            // ROI of the larger image, so the rows of the source are not dense.
+            // The ROI blob does not own the memory of the image
+            frame = makeBlob<T>(precision, srcLayout, { 1, dims[1], dims[2] + 3, dims[3] + 7 });
+            src = make_shared_blob(frame, ROI{ 0, 5, 2, dims[3], dims[2] });
+        } else {
+            src = makeBlob<T>(precision, srcLayout, dims);
+        }
+        auto dst = makeBlob<T>(precision, dstLayout, src->getTensorDesc().getDims());
+        fillZeros<T>(dst);
+
+        blob_copy(src, dst);
+        compareBlobs<T>(src, dst);
+    }
+
+    void test(bool roi) {
+        Precision precision;
+        Layout srcLayout;
+        SizeVector dims;
+        std::tie(precision, srcLayout, dims) = GetParam();
+        if (precision == Precision::U8) {
+            test<uint8_t>(precision, srcLayout, dims, roi);
+        } else {
+            test<float>(precision, srcLayout, dims, roi);
+        }
+    }
+};
+
+TEST_P(BlobCopyTests, copyIsEqualToReference) {
+    test(false);
+}
+
+TEST_P(BlobCopyTests, copyOfRoiIsEqualToReference) {
+    test(true);
+}
+
+static vector<SizeVector> blobCopyDims() {
+    vector<SizeVector> dims;
+    for (auto w : widths) {
+        dims.push_back({ 2, 3, 3, w });
+    }
+    // not vectorized number of channels
+    dims.push_back({ 1, 4, 3, 17 });
+    dims.push_back({ 1, 1, 2, 33 });
+    return dims;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        BlobCopy, BlobCopyTests,
+        Combine(Values(Precision::U8, Precision::FP32),
+                Values(NCHW, NHWC),
+                ValuesIn(blobCopyDims())));
+
+// The kernels of every instruction set supported by the CPU are compared with the scalar copy,
+// blob_copy() calls only the widest one
+class BlobCopyKernelTests : public TestWithParam<size_t> {
+protected:
+    static const int N = 2, C = 3, H = 3;
+
+    template <typename T>
+    using Kernel = void (*)(const T*, T*, size_t, size_t, size_t, size_t, size_t, int, int, int);
+
+    // NHWC -> NCHW, the rows of the source are padded by 2 pixels
+    template <typename T>
+    void testSplit(Kernel<T> kernel) {
+        const size_t W = GetParam();
+        const size_t H_src_stride = (W + 2) * C, N_src_stride = H * H_src_stride;
+        const size_t H_dst_stride = W, C_dst_stride = H * W, N_dst_stride = C * C_dst_stride;
+
+        vector<T> src(N * N_src_stride), dst(N * N_dst_stride, T(0));
+        fill(src.data(), src.size());
+        kernel(src.data(), dst.data(), N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+               N, H, static_cast<int>(W));
+
+        for (size_t n = 0; n < N; n++)
+        for (size_t c = 0; c < C; c++)
+        for (size_t h = 0; h < H; h++)
+        for (size_t w = 0; w < W; w++) {
+            ASSERT_EQ(src[n * N_src_stride + h * H_src_stride + w * C + c],
+                      dst[n * N_dst_stride + c * C_dst_stride + h * H_dst_stride + w])
+                << "n=" << n << " c=" << c << " h=" << h << " w=" << w;
+        }
+    }
+
+    // NCHW -> NHWC, the rows of the source are padded by 2 pixels
+    template <typename T>
+    void testMerge(Kernel<T> kernel) {
+        const size_t W = GetParam();
+        const size_t H_src_stride = W + 2, C_src_stride = H * H_src_stride, N_src_stride = C * C_src_stride;
+        const size_t H_dst_stride = W * C, N_dst_stride = H * H_dst_stride;
+
+        vector<T> src(N * N_src_stride), dst(N * N_dst_stride, T(0));
+        fill(src.data(), src.size());
+        kernel(src.data(), dst.data(), N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+               N, H, static_cast<int>(W));
+
+        for (size_t n = 0; n < N; n++)
+        for (size_t c = 0; c < C; c++)
+        for (size_t h = 0; h < H; h++)
+        for (size_t w = 0; w < W; w++) {
+            ASSERT_EQ(src[n * N_src_stride + c * C_src_stride + h * H_src_stride + w],
+                      dst[n * N_dst_stride + h * H_dst_stride + w * C + c])
+                << "n=" << n << " c=" << c << " h=" << h << " w=" << w;
+        }
+    }
+};
+
+#ifdef HAVE_SSE
+TEST_P(BlobCopyKernelTests, sse42) {
+    if (!with_cpu_x86_sse42())
+        return;
+    testSplit<uint8_t>(blob_copy_4d_split_u8c3);
+    testSplit<float>(blob_copy_4d_split_f32c3);
+    testMerge<uint8_t>(blob_copy_4d_merge_u8c3);
+    testMerge<float>(blob_copy_4d_merge_f32c3);
+}
+#endif
+
+#ifdef HAVE_AVX2
+TEST_P(BlobCopyKernelTests, avx2) {
+    if (!with_cpu_x86_avx2())
+        return;
+    testSplit<uint8_t>(avx2::blob_copy_4d_split_u8c3);
+    testSplit<float>(avx2::blob_copy_4d_split_f32c3);
+    testMerge<uint8_t>(avx2::blob_copy_4d_merge_u8c3);
+    testMerge<float>(avx2::blob_copy_4d_merge_f32c3);
+}
+#endif
+
+#ifdef HAVE_AVX512
+TEST_P(BlobCopyKernelTests, avx512) {
+    if (!with_cpu_x86_avx512_core())
+        return;
+    testSplit<uint8_t>(avx512::blob_copy_4d_split_u8c3);
+    testSplit<float>(avx512::blob_copy_4d_split_f32c3);
+    testMerge<uint8_t>(avx512::blob_copy_4d_merge_u8c3);
+    testMerge<float>(avx512::blob_copy_4d_merge_f32c3);
+}
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+        BlobCopyKernels, BlobCopyKernelTests,
+        ValuesIn(widths));
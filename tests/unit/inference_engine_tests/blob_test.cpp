@@ -75,6 +75,10 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 
+class I420BlobTests : public CompoundBlobTests {};
+
+class BatchedBlobTests : public CompoundBlobTests {};
+
 struct ScopedTimer
 {
     chrono::high_resolution_clock::time_point t0;
@@ -830,3 +834,133 @@ TEST_F(NV12BlobTests, canCreateNV12BlobFromTwoMovedPlanes) {
         make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC)));
     verifyCompoundBlob(nv12_blob);
 }
+
+TEST_F(I420BlobTests, cannotCreateI420BlobFromNullptrBlobs) {
+    Blob::Ptr y = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NHWC));
+    Blob::Ptr uv = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 2, 2}, NHWC));
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, uv, nullptr),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, nullptr, uv),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<I420Blob>(nullptr, uv, uv),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithNonU8Precision) {
+    Blob::Ptr y = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NHWC));
+    Blob::Ptr u = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 2, 2}, NHWC));
+    Blob::Ptr float_v = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 1, 2, 2}, NHWC));
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, u, float_v), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongChannelNumber) {
+    Blob::Ptr y = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NHWC));
+    Blob::Ptr u = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 2, 2}, NHWC));
+    Blob::Ptr uv = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 2, 2}, NHWC));
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, uv, uv), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<I420Blob>(uv, u, u), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongSizeRatio) {
+    Blob::Ptr y = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 6}, NHWC));
+    Blob::Ptr u = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 3, 3}, NHWC));
+    Blob::Ptr wide = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 3, 6}, NHWC));
+    Blob::Ptr tall = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 3}, NHWC));
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, wide, wide), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, tall, tall), InferenceEngine::details::InferenceEngineException);
+    // U and V planes must have the same size
+    EXPECT_THROW(make_shared_blob<I420Blob>(y, u, wide), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(I420BlobTests, canCreateI420BlobFromThreePlanes) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr u_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 3, 4}, NHWC));
+    Blob::Ptr v_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 3, 4}, NHWC));
+    I420Blob::Ptr i420_blob = make_shared_blob<I420Blob>(y_blob, u_blob, v_blob);
+    verifyCompoundBlob(i420_blob, {y_blob, u_blob, v_blob});
+    EXPECT_EQ(y_blob, i420_blob->y());
+    EXPECT_EQ(u_blob, i420_blob->u());
+    EXPECT_EQ(v_blob, i420_blob->v());
+}
+
+TEST_F(I420BlobTests, canCreateI420BlobOnDecoderPlanes) {
+    // planes of a decoded frame are wrapped without copying
+    std::vector<uint8_t> frame(8 * 6 * 3 / 2);
+    uint8_t *y_ptr = frame.data(), *u_ptr = y_ptr + 8 * 6, *v_ptr = u_ptr + 4 * 3;
+    I420Blob::Ptr i420_blob = make_shared_blob<I420Blob>(
+        make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC), y_ptr),
+        make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 3, 4}, NHWC), u_ptr),
+        make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 3, 4}, NHWC), v_ptr));
+    EXPECT_EQ(y_ptr, i420_blob->y()->buffer().as<uint8_t*>());
+    EXPECT_EQ(u_ptr, i420_blob->u()->buffer().as<uint8_t*>());
+    EXPECT_EQ(v_ptr, i420_blob->v()->buffer().as<uint8_t*>());
+
+    Blob::Ptr roi_blob = make_shared_blob(i420_blob, ROI{0, 2, 2, 4, 2});
+    ASSERT_TRUE(roi_blob->is<I420Blob>());
+    EXPECT_EQ(SizeVector({1, 1, 2, 4}), roi_blob->as<I420Blob>()->y()->getTensorDesc().getDims());
+    EXPECT_EQ(SizeVector({1, 1, 1, 2}), roi_blob->as<I420Blob>()->v()->getTensorDesc().getDims());
+    EXPECT_EQ(5, roi_blob->as<I420Blob>()->u()->getTensorDesc().getBlockingDesc().getOffsetPadding());
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromEmptyVectorOrNullptr) {
+    Blob::Ptr valid = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>()),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({valid, nullptr})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromInconsistentImages) {
+    Blob::Ptr nchw = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    Blob::Ptr nhwc = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NHWC));
+    Blob::Ptr batch2 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 4, 4}, NCHW));
+    Blob::Ptr nv12 = make_shared_blob<NV12Blob>(
+        make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NHWC)),
+        make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 2, 2}, NHWC)));
+    auto cblob = make_shared_blob<CompoundBlob>(std::vector<Blob::Ptr>({nchw}));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({nchw, nhwc})),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({batch2})),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({nv12, nchw})),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({cblob})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobOfRois) {
+    Blob::Ptr frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    frame->allocate();
+
+    std::vector<ROI> rois = {{0, 0, 0, 4, 4}, {1, 3, 2, 5, 3}};
+    BatchedBlob::Ptr batched_blob = make_shared_blob(frame, rois);
+    verifyCompoundBlob(batched_blob);
+    ASSERT_EQ(2, batched_blob->size());
+    EXPECT_EQ(Precision::U8, batched_blob->getTensorDesc().getPrecision());
+    EXPECT_EQ(NHWC, batched_blob->getTensorDesc().getLayout());
+    EXPECT_EQ(SizeVector({1, 3, 4, 4}), batched_blob->getBlob(0)->getTensorDesc().getDims());
+    EXPECT_EQ(SizeVector({1, 3, 3, 5}), batched_blob->getBlob(1)->getTensorDesc().getDims());
+    EXPECT_EQ(57, batched_blob->getBlob(1)->getTensorDesc().getBlockingDesc().getOffsetPadding());
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobOfNV12Rois) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 8, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 4, 4}, NHWC));
+    y_blob->allocate();
+    uv_blob->allocate();
+    Blob::Ptr frame = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+
+    // ROIs of the NV12 frame must be aligned to the subsampled UV plane
+    EXPECT_THROW(make_shared_blob(frame, ROI{0, 1, 0, 4, 4}), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob(frame, ROI{0, 0, 0, 3, 4}), InferenceEngine::details::InferenceEngineException);
+
+    BatchedBlob::Ptr batched_blob = make_shared_blob(frame, std::vector<ROI>({{0, 2, 4, 6, 4}}));
+    verifyCompoundBlob(batched_blob);
+    ASSERT_EQ(1, batched_blob->size());
+    NV12Blob::Ptr roi_blob = as<NV12Blob>(batched_blob->getBlob(0));
+    ASSERT_NE(nullptr, roi_blob);
+    EXPECT_EQ(SizeVector({1, 1, 4, 6}), roi_blob->y()->getTensorDesc().getDims());
+    EXPECT_EQ(SizeVector({1, 2, 2, 3}), roi_blob->uv()->getTensorDesc().getDims());
+    EXPECT_EQ(34, roi_blob->y()->getTensorDesc().getBlockingDesc().getOffsetPadding());
+    EXPECT_EQ(18, roi_blob->uv()->getTensorDesc().getBlockingDesc().getOffsetPadding());
+}
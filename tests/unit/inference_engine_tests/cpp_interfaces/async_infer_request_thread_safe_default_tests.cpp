@@ -8,6 +8,7 @@
 #include <cpp_interfaces/impl/mock_infer_request_internal.hpp>
 #include <cpp_interfaces/impl/mock_async_infer_request_default.hpp>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/ie_lock_free_task_executor.hpp>
 #include <cpp_interfaces/mock_task_synchronizer.hpp>
 #include <cpp_interfaces/mock_task_executor.hpp>
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
@@ -216,3 +217,54 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, callbackTakesOKIfAsyncRequestOnLockFreeExecutorWasOK) {
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>();
+    auto callbackExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, callbackExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    bool wasCalled = false;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                wasCalled = true;
+                ASSERT_EQ(StatusCode::OK, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(2);
+
+    for (int i = 0; i < 2; i++) {
+        wasCalled = false;
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_TRUE(wasCalled);
+    }
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyIfLockFreeExecutorQueueIsFull) {
+    const int CAPACITY = 2;
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>("test", CAPACITY);
+    auto callbackExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, callbackExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    // the request is started from the working thread of the executor, which can't wait for the free slot
+    auto task = std::make_shared<Task>([&]() {
+        for (int i = 0; i < CAPACITY; i++) {
+            ASSERT_TRUE(taskExecutor->startTask(std::make_shared<Task>()));
+        }
+        ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->StartAsync(); }, REQUEST_BUSY_str));
+    });
+    ASSERT_TRUE(taskExecutor->startTask(task));
+    ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+
+    // the request is not left busy and runs once the queue has room
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+}
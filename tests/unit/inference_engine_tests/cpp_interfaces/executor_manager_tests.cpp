@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <cpp_interfaces/ie_executor_manager.hpp>
+#include <cpp_interfaces/ie_lock_free_task_executor.hpp>
 #include <ie_device.hpp>
 
 using namespace ::testing;
@@ -41,3 +42,12 @@ TEST_F(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST_F(ExecutorManagerTests, createExecutorOfRequestedType) {
+    auto executor1 = _manager.getExecutor("CPU", TaskExecutorType::LOCK_FREE);
+    auto executor2 = _manager.getExecutor("GPU");
+
+    ASSERT_NE(nullptr, std::dynamic_pointer_cast<LockFreeTaskExecutor>(executor1));
+    ASSERT_EQ(nullptr, std::dynamic_pointer_cast<LockFreeTaskExecutor>(executor2));
+    ASSERT_EQ(executor1, _manager.getExecutor("CPU"));
+}
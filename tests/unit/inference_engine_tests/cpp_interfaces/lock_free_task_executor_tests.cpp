@@ -0,0 +1,223 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cpp_interfaces/ie_lock_free_queue.hpp>
+#include <cpp_interfaces/ie_lock_free_task_executor.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
+#include <ie_common.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include "task_tests_utils.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class LockFreeQueueTests : public ::testing::Test {};
+
+TEST_F(LockFreeQueueTests, capacityIsRoundedToPowerOfTwo) {
+    LockFreeQueue<int> queue(100);
+    ASSERT_EQ(128, queue.capacity());
+}
+
+TEST_F(LockFreeQueueTests, keepsFifoOrderAndBounds) {
+    LockFreeQueue<int> queue(4);
+    ASSERT_TRUE(queue.empty());
+    for (int i = 0; i < 4; i++)
+        ASSERT_TRUE(queue.tryPush(i));
+    ASSERT_FALSE(queue.tryPush(4));
+    int value = -1;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.tryPop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(queue.tryPop(value));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(LockFreeQueueTests, canPushAndPopFromMultipleThreads) {
+    const int THREAD_NUMBER = 4;
+    const int NUM_ELEMENTS = 10000;
+    LockFreeQueue<int> queue(64);
+    std::atomic<long long> sum(0);
+    std::atomic<int> popped(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_NUMBER; t++) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= NUM_ELEMENTS; i++)
+                while (!queue.tryPush(i)) std::this_thread::yield();
+        });
+        threads.emplace_back([&] {
+            int value;
+            while (popped < THREAD_NUMBER * NUM_ELEMENTS) {
+                if (queue.tryPop(value)) {
+                    sum += value;
+                    popped++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    ASSERT_EQ(static_cast<long long>(THREAD_NUMBER) * NUM_ELEMENTS * (NUM_ELEMENTS + 1) / 2, sum);
+}
+
+class LockFreeTaskExecutorTests : public ::testing::Test {};
+
+TEST_F(LockFreeTaskExecutorTests, canRunCustomFunction) {
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>();
+    int i = 0;
+    auto customTask = std::make_shared<Task>([&i]() { i++; });
+    taskExecutor->startTask(customTask);
+    auto status = customTask->wait(-1);
+    ASSERT_EQ(status, Task::Status::TS_DONE);
+    ASSERT_EQ(i, 1);
+}
+
+TEST_F(LockFreeTaskExecutorTests, canCatchException) {
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>();
+    auto task = std::make_shared<Task>([]() {
+        THROW_IE_EXCEPTION;
+    });
+    taskExecutor->startTask(task);
+    auto status = task->wait(-1);
+    ASSERT_EQ(status, Task::Status::TS_ERROR);
+    EXPECT_THROW(task->checkException(), details::InferenceEngineException);
+}
+
+TEST_F(LockFreeTaskExecutorTests, returnFalseIfRunTaskWhichIsRunning) {
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>();
+    auto task = std::make_shared<Task>([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    });
+    ASSERT_TRUE(taskExecutor->startTask(task));
+    ASSERT_FALSE(taskExecutor->startTask(task));
+}
+
+TEST_F(LockFreeTaskExecutorTests, canRunTasksAfterSleep) {
+    // no spinning: working thread goes to sleep right after each task
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>("test", 16, 0);
+    for (int i = 0; i < 100; i++) {
+        auto task = std::make_shared<Task>();
+        taskExecutor->startTask(task);
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+        if (i % 10 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST_F(LockFreeTaskExecutorTests, canRunMultipleTasksFromMultipleThreadsInFullQueue) {
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>("test", 4);
+    const int THREAD_NUMBER = 8;
+    const int NUM_TASKS = 200;
+    std::atomic<int> sharedVar(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_NUMBER; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < NUM_TASKS; i++) {
+                auto task = std::make_shared<Task>([&]() { sharedVar++; });
+                ASSERT_TRUE(taskExecutor->startTask(task));
+                task->wait(-1);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    ASSERT_EQ(THREAD_NUMBER * NUM_TASKS, sharedVar);
+}
+
+TEST_F(LockFreeTaskExecutorTests, taskCanNotStartTasksInFullQueue) {
+    const int CAPACITY = 4;
+    auto taskExecutor = std::make_shared<LockFreeTaskExecutor>("test", CAPACITY);
+    const int NUM_TASKS = 8;
+    std::atomic<int> sharedVar(0);
+    std::vector<Task::Ptr> followUps;
+    for (int i = 0; i < NUM_TASKS; i++) {
+        followUps.push_back(std::make_shared<Task>([&]() { sharedVar++; }));
+    }
+    // working thread is busy with the task, so nothing is taken from the queue until it is done
+    auto task = std::make_shared<Task>([&]() {
+        for (int i = 0; i < NUM_TASKS; i++) {
+            ASSERT_EQ(i < CAPACITY, taskExecutor->startTask(followUps[i])) << "i=" << i;
+        }
+    });
+    ASSERT_TRUE(taskExecutor->startTask(task));
+    ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    for (int i = 0; i < CAPACITY; i++) {
+        ASSERT_EQ(Task::Status::TS_DONE, followUps[i]->wait(-1));
+    }
+    ASSERT_EQ(CAPACITY, sharedVar);
+
+    // rejected tasks are released and can be started again
+    for (int i = CAPACITY; i < NUM_TASKS; i++) {
+        ASSERT_EQ(Task::Status::TS_INITIAL, followUps[i]->getStatus());
+        ASSERT_TRUE(taskExecutor->startTask(followUps[i]));
+        ASSERT_EQ(Task::Status::TS_DONE, followUps[i]->wait(-1));
+    }
+    ASSERT_EQ(NUM_TASKS, sharedVar);
+}
+
+TEST_F(LockFreeTaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
+    std::vector<Task::Ptr> tasks;
+    std::atomic<int> sharedVar(0);
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        tasks.push_back(std::make_shared<Task>([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            sharedVar++;
+        }));
+    }
+    {
+        auto taskExecutor = std::make_shared<LockFreeTaskExecutor>();
+        for (auto &task : tasks) {
+            taskExecutor->startTask(task);
+        }
+    }
+    ASSERT_EQ(sharedVar, MAX_NUMBER_OF_TASKS_IN_QUEUE);
+}
+
+// Microbenchmark of the time from startTask to the start of the task execution,
+// run with --gtest_also_run_disabled_tests
+class TaskExecutorLatencyTests : public ::testing::TestWithParam<std::string> {
+protected:
+    ITaskExecutor::Ptr createExecutor() {
+        if (GetParam() == "LockFreeTaskExecutor")
+            return std::make_shared<LockFreeTaskExecutor>(GetParam());
+        return std::make_shared<TaskExecutor>(GetParam());
+    }
+};
+
+TEST_P(TaskExecutorLatencyTests, DISABLED_enqueueToStartLatency) {
+    using clock = std::chrono::high_resolution_clock;
+    const int NUM_TASKS = 20000;
+    const int THREAD_NUMBER = 4;
+    auto taskExecutor = createExecutor();
+
+    std::vector<std::vector<double>> latencies(THREAD_NUMBER);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_NUMBER; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < NUM_TASKS / THREAD_NUMBER; i++) {
+                clock::time_point started;
+                auto task = std::make_shared<Task>([&started]() { started = clock::now(); });
+                auto enqueued = clock::now();
+                taskExecutor->startTask(task);
+                task->wait(-1);
+                latencies[t].push_back(std::chrono::duration<double, std::micro>(started - enqueued).count());
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+
+    std::vector<double> all;
+    for (auto &l : latencies) all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+    std::cout << GetParam() << " enqueue-to-start latency, us: p50 " << all[all.size() / 2]
+              << " p99 " << all[all.size() * 99 / 100] << " max " << all.back() << std::endl;
+}
+
+INSTANTIATE_TEST_CASE_P(TaskExecutors, TaskExecutorLatencyTests,
+                        ::testing::Values("TaskExecutor", "LockFreeTaskExecutor"));
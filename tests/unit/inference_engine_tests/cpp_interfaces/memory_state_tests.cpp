@@ -197,6 +197,78 @@ TEST_F(MemoryStateTests, MemoryStateCanPropagateGetLastState) {
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float*>()[2], 125);
 }
 
+TEST_F(MemoryStateTests, MemoryStateCanPropagateSwapState) {
+
+    auto net = ExecutableNetwork(make_executable_network(mockExeNetworkInternal));
+    std::vector<IMemoryStateInternal::Ptr> toReturn;
+    toReturn.push_back(mockMemoryStateInternal);
+
+    float data[] = {123, 124, 125};
+    float previousData[] = {0, 0, 0};
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, data, sizeof(data) / sizeof(*data));
+    auto previousBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, previousData,
+                                                sizeof(previousData) / sizeof(*previousData));
+    Blob::Ptr saver;
+
+    EXPECT_CALL(*mockExeNetworkInternal.get(), QueryState()).WillRepeatedly(Return(toReturn));
+    EXPECT_CALL(*mockMemoryStateInternal.get(), SwapState(_)).WillOnce(Invoke([&](Blob::Ptr &state) {
+        saver = state;
+        state = previousBlob;
+    }));
+
+    Blob::Ptr previous;
+    EXPECT_NO_THROW(previous = net.QueryState().front().SwapState(stateBlob));
+    ASSERT_EQ(saver, stateBlob);
+    ASSERT_EQ(previous, previousBlob);
+}
+
+TEST_F(MemoryStateTests, MemoryStatePropagatesNotImplementedSwapState) {
+
+    class MemoryStateWithoutSwap : public IMemoryStateInternal {
+     public:
+        std::string GetName() const override { return "name"; }
+        void Reset() override {}
+        void SetState(Blob::Ptr) override {}
+        Blob::CPtr GetLastState() const override { return nullptr; }
+    };
+
+    auto net = ExecutableNetwork(make_executable_network(mockExeNetworkInternal));
+    std::vector<IMemoryStateInternal::Ptr> toReturn;
+    toReturn.push_back(std::make_shared<MemoryStateWithoutSwap>());
+
+    EXPECT_CALL(*mockExeNetworkInternal.get(), QueryState()).WillRepeatedly(Return(toReturn));
+
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C });
+    stateBlob->allocate();
+    ASSERT_THROW(net.QueryState().front().SwapState(stateBlob), NotImplemented);
+}
+
+TEST_F(MemoryStateTests, MemoryStateWithoutSwappableInterfaceThrowsNotImplementedOnSwapState) {
+
+    // a state of a plugin built before IMemoryStateSwappable
+    class LegacyMemoryState : public IMemoryState {
+     public:
+        StatusCode GetName(char *name, size_t len, ResponseDesc *) const noexcept override {
+            if (len > 0) name[0] = 0;
+            return OK;
+        }
+        StatusCode Reset(ResponseDesc *) noexcept override { return OK; }
+        StatusCode SetState(Blob::Ptr, ResponseDesc *) noexcept override { return OK; }
+        StatusCode GetLastState(Blob::CPtr &, ResponseDesc *) const noexcept override { return OK; }
+    };
+
+    MemoryState state(std::make_shared<LegacyMemoryState>());
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C });
+    stateBlob->allocate();
+    ASSERT_THROW(state.SwapState(stateBlob), NotImplemented);
+}
+
+TEST_F(MemoryStateTests, MemoryStateBaseIsSwappable) {
+
+    IMemoryState::Ptr pState(new MemoryStateBase<IMemoryStateInternal>(mockMemoryStateInternal));
+    ASSERT_NE(nullptr, std::dynamic_pointer_cast<IMemoryStateSwappable>(pState));
+}
+
 class MemoryStateInternalMockImpl : public MemoryStateInternal {
  public:
     using MemoryStateInternal::MemoryStateInternal;
@@ -243,3 +315,19 @@ TEST_F(MemoryStateTests, MemoryStateInternalCanSaveStateByReference) {
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float *>()[1], 122);
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float *>()[2], 123);
 }
+
+TEST_F(MemoryStateTests, MemoryStateInternalCanSwapState) {
+
+    IMemoryStateInternal::Ptr pState(new MemoryStateInternalMockImpl("name"));
+    float data[] = {123, 124, 125};
+    float nextData[] = {126, 127, 128};
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, data, sizeof(data) / sizeof(*data));
+    Blob::Ptr nextBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, nextData,
+                                                 sizeof(nextData) / sizeof(*nextData));
+
+    pState->SetState(stateBlob);
+    pState->SwapState(nextBlob);
+
+    ASSERT_EQ(nextBlob, stateBlob);
+    ASSERT_FLOAT_EQ(pState->GetLastState()->cbuffer().as<const float *>()[0], 126);
+}
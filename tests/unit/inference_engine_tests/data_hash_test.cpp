@@ -0,0 +1,74 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cpu_detector.hpp>
+#include <ie_data_hash.hpp>
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/ie_data_hash_sse42.hpp"
+#endif
+
+#include <vector>
+
+using namespace InferenceEngine;
+
+class DataHashTests : public ::testing::Test {
+protected:
+    std::vector<uint8_t> createData(size_t size) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; i++)
+            data[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+        return data;
+    }
+};
+
+TEST_F(DataHashTests, sameDataHasSameHash) {
+    auto data = createData(3 * 1024 * 1024 + 7);
+    auto copy = data;
+    ASSERT_EQ(data_hash(data.data(), data.size()), data_hash(copy.data(), copy.size()));
+}
+
+TEST_F(DataHashTests, hashDependsOnEveryBlock) {
+    auto data = createData(3 * 1024 * 1024 + 7);
+    const uint64_t hash = data_hash(data.data(), data.size());
+    for (size_t pos : {size_t(0), size_t(9), data.size() / 2, data.size() - 1}) {
+        auto changed = data;
+        changed[pos] ^= 1;
+        ASSERT_NE(hash, data_hash(changed.data(), changed.size())) << "byte " << pos;
+    }
+}
+
+TEST_F(DataHashTests, hashDependsOnSize) {
+    std::vector<uint8_t> zeros(64, 0);
+    ASSERT_NE(data_hash(zeros.data(), 32), data_hash(zeros.data(), 64));
+}
+
+TEST_F(DataHashTests, hashDependsOnOrderOfBlocks) {
+    const size_t block = 256 * 1024;
+    auto data = createData(2 * block);
+    std::vector<uint8_t> swapped(data.begin() + block, data.end());
+    swapped.insert(swapped.end(), data.begin(), data.begin() + block);
+    ASSERT_NE(data_hash(data.data(), data.size()), data_hash(swapped.data(), swapped.size()));
+}
+
+TEST_F(DataHashTests, referenceBlockHashIsCRC32C) {
+    // the check value of CRC32C, the data is shorter than two words, so it all goes to the first sum
+    const char check[] = "123456789";
+    ASSERT_EQ(0xE306928300000000ull, data_hash_block_ref(reinterpret_cast<const uint8_t *>(check), 9));
+}
+
+#ifdef HAVE_SSE
+TEST_F(DataHashTests, sse42BlockHashIsBitExactWithReference) {
+    if (!with_cpu_x86_sse42())
+        return;
+    auto data = createData(4096 + 8);
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t size : {0, 1, 7, 8, 15, 16, 17, 31, 33, 255, 1023, 4093, 4096}) {
+            const uint8_t *block = data.data() + offset;
+            ASSERT_EQ(data_hash_block_ref(block, size), data_hash_block_sse42(block, size))
+                << "offset " << offset << " size " << size;
+        }
+    }
+}
+#endif
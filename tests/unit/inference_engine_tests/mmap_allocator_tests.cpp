@@ -0,0 +1,69 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "mmap_allocator.hpp"
+#include "ie_blob.h"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class MmapAllocatorTests: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        std::remove(fileName.c_str());
+    }
+
+    virtual void SetUp() {
+        data.resize(10000);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<char>(i % 127);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(data.data(), data.size());
+    }
+
+    std::string fileName = "mmap_allocator_test.bin";
+    std::vector<char> data;
+};
+
+TEST_F(MmapAllocatorTests, canMapFile) {
+    auto allocator = details::CreateMmapAllocator(fileName);
+    void* handle = allocator->alloc(data.size());
+    ASSERT_NE(nullptr, handle);
+    char * ptr = (char *)allocator->lock(handle);
+    ASSERT_EQ(0, memcmp(ptr, data.data(), data.size()));
+    allocator->unlock(ptr);
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    auto allocator = details::CreateMmapAllocator(fileName);
+    ASSERT_EQ(nullptr, allocator->alloc(data.size() + 1));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMissingFile) {
+    auto allocator = details::CreateMmapAllocator(fileName + ".missing");
+    ASSERT_EQ(nullptr, allocator->alloc(data.size()));
+}
+
+TEST_F(MmapAllocatorTests, writesDoNotChangeFile) {
+    {
+        TBlob<uint8_t> blob(TensorDesc(Precision::U8, {data.size()}, Layout::C), details::CreateMmapAllocator(fileName));
+        blob.allocate();
+        ASSERT_NE(nullptr, blob.data());
+        blob.data()[9999] = 11;
+        ASSERT_EQ(11, blob.data()[9999]);
+    }
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(data, content);
+}
@@ -0,0 +1,167 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <ie_compound_blob.h>
+#include <ie_preprocess_data.hpp>
+#include <ie_preprocess_gapi.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+// every item of the batch pre-processed from a batched blob is the result of its image pre-processed alone
+class PreprocBatchedTests : public ::testing::Test {
+protected:
+    static const size_t OUT_SIZE = 8;
+
+    static Blob::Ptr makePlane(size_t channels, size_t height, size_t width, Layout layout, size_t seed) {
+        auto blob = make_shared_blob<uint8_t>({ Precision::U8, { 1, channels, height, width }, layout });
+        blob->allocate();
+        auto data = blob->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = static_cast<uint8_t>((i * 37 + seed * 101 + 11) % 251);
+        }
+        return blob;
+    }
+
+    static Blob::Ptr makeNV12(size_t height, size_t width) {
+        return make_shared_blob<NV12Blob>(makePlane(1, height, width, NHWC, 0),
+                                          makePlane(2, height / 2, width / 2, NHWC, 1));
+    }
+
+    // the output batch is filled by a pattern, so the items not written by the pre-processing are seen
+    static Blob::Ptr makeOutput(size_t batch) {
+        auto blob = make_shared_blob<uint8_t>({ Precision::U8, { batch, 3, OUT_SIZE, OUT_SIZE }, NCHW });
+        blob->allocate();
+        std::memset(blob->buffer().as<uint8_t*>(), 0xAB, blob->byteSize());
+        return blob;
+    }
+
+    static PreProcessInfo makeInfo(ColorFormat fmt) {
+        PreProcessInfo info;
+        info.setResizeAlgorithm(RESIZE_BILINEAR);
+        info.setColorFormat(fmt);
+        return info;
+    }
+
+    static std::vector<uint8_t> item(const Blob::Ptr &blob, size_t i) {
+        const size_t itemSize = 3 * OUT_SIZE * OUT_SIZE;
+        auto data = blob->cbuffer().as<const uint8_t*>() + i * itemSize;
+        return std::vector<uint8_t>(data, data + itemSize);
+    }
+
+    static std::vector<uint8_t> preprocessSingle(const Blob::Ptr &image, ColorFormat fmt) {
+        PreProcessData data;
+        data.setRoiBlob(image);
+        auto out = makeOutput(1);
+        data.execute(out, makeInfo(fmt), false);
+        return item(out, 0);
+    }
+
+    void SetUp() override {
+        if (!PreprocEngine::useGAPI())
+            GTEST_SKIP();
+    }
+};
+
+TEST_F(PreprocBatchedTests, batchItemsAreTheResultsOfSingleImages) {
+    auto frame = makePlane(3, 32, 32, NCHW, 0);
+    const std::vector<ROI> rois = { { 0, 0, 0, 16, 16 }, { 1, 5, 3, 20, 12 }, { 2, 10, 10, 22, 22 } };
+
+    PreProcessData data;
+    data.setRoiBlob(make_shared_blob(frame, rois));
+    auto out = makeOutput(rois.size());
+    data.execute(out, makeInfo(ColorFormat::RAW), false);
+
+    for (size_t i = 0; i < rois.size(); i++) {
+        ASSERT_EQ(preprocessSingle(make_shared_blob(frame, rois[i]), ColorFormat::RAW), item(out, i)) << "i=" << i;
+    }
+}
+
+TEST_F(PreprocBatchedTests, batchItemsWithoutImagesAreZeroed) {
+    auto frame = makePlane(3, 32, 32, NHWC, 0);
+    const std::vector<ROI> rois = { { 0, 0, 0, 16, 16 }, { 1, 7, 9, 24, 18 } };
+
+    PreProcessData data;
+    data.setRoiBlob(make_shared_blob(frame, rois));
+    auto out = makeOutput(4);
+    data.execute(out, makeInfo(ColorFormat::BGR), false);
+
+    for (size_t i = 0; i < rois.size(); i++) {
+        ASSERT_EQ(preprocessSingle(make_shared_blob(frame, rois[i]), ColorFormat::BGR), item(out, i)) << "i=" << i;
+    }
+    const std::vector<uint8_t> zeros(3 * OUT_SIZE * OUT_SIZE, 0);
+    ASSERT_EQ(zeros, item(out, 2));
+    ASSERT_EQ(zeros, item(out, 3));
+}
+
+TEST_F(PreprocBatchedTests, dynamicBatchProcessesFirstImages) {
+    auto frame = makePlane(3, 32, 32, NCHW, 0);
+    const std::vector<ROI> rois = { { 0, 0, 0, 16, 16 }, { 1, 5, 3, 20, 12 }, { 2, 10, 10, 22, 22 } };
+
+    PreProcessData data;
+    data.setRoiBlob(make_shared_blob(frame, rois));
+    auto out = makeOutput(rois.size());
+    data.execute(out, makeInfo(ColorFormat::RAW), false, 2);
+
+    ASSERT_EQ(preprocessSingle(make_shared_blob(frame, rois[0]), ColorFormat::RAW), item(out, 0));
+    ASSERT_EQ(preprocessSingle(make_shared_blob(frame, rois[1]), ColorFormat::RAW), item(out, 1));
+    // the items past the dynamic batch are not read by the network
+    ASSERT_EQ(std::vector<uint8_t>(3 * OUT_SIZE * OUT_SIZE, 0xAB), item(out, 2));
+}
+
+TEST_F(PreprocBatchedTests, moreImagesThanBatchAreRejected) {
+    auto frame = makePlane(3, 32, 32, NCHW, 0);
+    const std::vector<ROI> rois = { { 0, 0, 0, 16, 16 }, { 1, 5, 3, 20, 12 }, { 2, 10, 10, 22, 22 } };
+
+    PreProcessData data;
+    data.setRoiBlob(make_shared_blob(frame, rois));
+    auto out = makeOutput(2);
+    ASSERT_THROW(data.execute(out, makeInfo(ColorFormat::RAW), false), details::InferenceEngineException);
+}
+
+// only the pixels of the ROI of an NV12 frame are converted, the result is the one of the cropped frame
+TEST_F(PreprocBatchedTests, nv12RoiIsTheCroppedFrame) {
+    auto frame = makeNV12(32, 32);
+    const ROI roi = { 0, 4, 6, 16, 12 };
+
+    auto nv12 = frame->as<NV12Blob>();
+    auto crop = makeNV12(roi.sizeY, roi.sizeX);
+    auto cropNV12 = crop->as<NV12Blob>();
+    auto copyPlane = [](const Blob::Ptr &src, const Blob::Ptr &dst, size_t channels, size_t x, size_t y) {
+        const auto &srcDims = src->getTensorDesc().getDims();
+        const auto &dstDims = dst->getTensorDesc().getDims();
+        auto psrc = src->cbuffer().as<const uint8_t*>();
+        auto pdst = dst->buffer().as<uint8_t*>();
+        for (size_t h = 0; h < dstDims[2]; h++) {
+            std::memcpy(pdst + h * dstDims[3] * channels, psrc + ((y + h) * srcDims[3] + x) * channels,
+                        dstDims[3] * channels);
+        }
+    };
+    copyPlane(nv12->y(), cropNV12->y(), 1, roi.posX, roi.posY);
+    copyPlane(nv12->uv(), cropNV12->uv(), 2, roi.posX / 2, roi.posY / 2);
+
+    ASSERT_EQ(preprocessSingle(crop, ColorFormat::NV12),
+              preprocessSingle(make_shared_blob(frame, roi), ColorFormat::NV12));
+}
+
+TEST_F(PreprocBatchedTests, nv12BatchItemsAreTheResultsOfSingleImages) {
+    auto frame = makeNV12(32, 32);
+    const std::vector<ROI> rois = { { 0, 0, 0, 16, 16 }, { 1, 4, 6, 16, 12 }, { 2, 10, 2, 22, 30 } };
+
+    PreProcessData data;
+    data.setRoiBlob(make_shared_blob(frame, rois));
+    auto out = makeOutput(rois.size());
+    data.execute(out, makeInfo(ColorFormat::NV12), false);
+
+    for (size_t i = 0; i < rois.size(); i++) {
+        ASSERT_EQ(preprocessSingle(make_shared_blob(frame, rois[i]), ColorFormat::NV12), item(out, i)) << "i=" << i;
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <ie_preprocess_gapi.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class PreprocGraphCacheTests : public ::testing::Test {
+protected:
+    static Blob::Ptr makeImage(size_t height, size_t width, Layout layout = NCHW) {
+        auto blob = make_shared_blob<uint8_t>({ Precision::U8, { 1, 3, height, width }, layout });
+        blob->allocate();
+        auto data = blob->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = static_cast<uint8_t>((i * 37 + 11) % 251);
+        }
+        return blob;
+    }
+
+    static Blob::Ptr makeOutput() {
+        auto blob = make_shared_blob<uint8_t>({ Precision::U8, { 1, 3, 8, 8 }, NCHW });
+        blob->allocate();
+        return blob;
+    }
+
+    static std::vector<uint8_t> preprocess(PreprocEngine &engine, Blob::Ptr in) {
+        auto out = makeOutput();
+        EXPECT_TRUE(engine.preprocessWithGAPI(in, out, RESIZE_BILINEAR, ColorFormat::RAW, false));
+        auto data = out->cbuffer().as<const uint8_t*>();
+        return std::vector<uint8_t>(data, data + out->size());
+    }
+
+    // the result of the engine compiling the graph for the image from scratch
+    static std::vector<uint8_t> reference(Blob::Ptr in) {
+        PreprocEngine engine;
+        return preprocess(engine, in);
+    }
+
+    void SetUp() override {
+        if (!PreprocEngine::useGAPI())
+            GTEST_SKIP();
+    }
+};
+
+TEST_F(PreprocGraphCacheTests, graphOfTheSameCallIsReused) {
+    PreprocEngine engine;
+    auto image = makeImage(16, 16);
+    auto first = preprocess(engine, image);
+    auto second = preprocess(engine, image);
+
+    auto stats = engine.getGraphCacheStats();
+    ASSERT_EQ(1u, stats.misses);
+    ASSERT_EQ(1u, stats.hits);
+    ASSERT_EQ(0u, stats.reshapes);
+    ASSERT_EQ(0u, stats.evictions);
+    ASSERT_EQ(first, second);
+}
+
+TEST_F(PreprocGraphCacheTests, roisOfTheSameSizeShareTheGraph) {
+    PreprocEngine engine;
+    auto frame = makeImage(32, 32);
+    Blob::Ptr left = make_shared_blob(frame, ROI{ 0, 0, 3, 16, 16 });
+    Blob::Ptr right = make_shared_blob(frame, ROI{ 0, 13, 7, 16, 16 });
+
+    auto leftResult = preprocess(engine, left);
+    auto rightResult = preprocess(engine, right);
+
+    auto stats = engine.getGraphCacheStats();
+    ASSERT_EQ(1u, stats.misses);
+    ASSERT_EQ(1u, stats.hits);
+
+    // the offset of the ROI is bound at run time, so the results are the ones of the dense crops
+    auto crop = [&](size_t x, size_t y) {
+        auto dense = makeImage(16, 16);
+        auto src = frame->cbuffer().as<const uint8_t*>();
+        auto dst = dense->buffer().as<uint8_t*>();
+        for (size_t c = 0; c < 3; c++)
+        for (size_t h = 0; h < 16; h++)
+        for (size_t w = 0; w < 16; w++)
+            dst[(c * 16 + h) * 16 + w] = src[(c * 32 + y + h) * 32 + x + w];
+        return dense;
+    };
+    ASSERT_EQ(reference(crop(0, 3)), leftResult);
+    ASSERT_EQ(reference(crop(13, 7)), rightResult);
+}
+
+TEST_F(PreprocGraphCacheTests, leastRecentlyUsedGraphIsEvictedAtCapacity) {
+    PreprocEngine engine;
+    const size_t capacity = PreprocEngine::graphsCapacity();
+    std::vector<Blob::Ptr> images;
+    for (size_t i = 0; i <= capacity; i++) {
+        images.push_back(makeImage(16 + i, 16));
+    }
+
+    for (size_t i = 0; i < capacity; i++) {
+        preprocess(engine, images[i]);
+    }
+    auto stats = engine.getGraphCacheStats();
+    ASSERT_EQ(capacity, stats.misses);
+    ASSERT_EQ(0u, stats.evictions);
+
+    // the first graph becomes the most recently used one, so the second is evicted
+    preprocess(engine, images[0]);
+    preprocess(engine, images[capacity]);
+    stats = engine.getGraphCacheStats();
+    ASSERT_EQ(1u, stats.hits);
+    ASSERT_EQ(capacity + 1, stats.misses);
+    ASSERT_EQ(1u, stats.evictions);
+
+    preprocess(engine, images[0]);
+    ASSERT_EQ(2u, engine.getGraphCacheStats().hits);
+    preprocess(engine, images[1]);
+    stats = engine.getGraphCacheStats();
+    ASSERT_EQ(2u, stats.hits);
+    ASSERT_EQ(capacity + 2, stats.misses);
+    ASSERT_EQ(2u, stats.evictions);
+}
+
+TEST_F(PreprocGraphCacheTests, evictedGraphIsReshapedIfOnlyInputSizeDiffers) {
+    PreprocEngine engine;
+    const size_t capacity = PreprocEngine::graphsCapacity();
+    for (size_t i = 0; i < capacity; i++) {
+        preprocess(engine, makeImage(16 + i, 16));
+    }
+
+    auto image = makeImage(40, 24);
+    auto result = preprocess(engine, image);
+    auto stats = engine.getGraphCacheStats();
+    ASSERT_EQ(1u, stats.evictions);
+    ASSERT_EQ(1u, stats.reshapes);
+    ASSERT_EQ(reference(image), result);
+}
+
+TEST_F(PreprocGraphCacheTests, evictedGraphIsRebuiltIfLayoutDiffers) {
+    PreprocEngine engine;
+    const size_t capacity = PreprocEngine::graphsCapacity();
+    for (size_t i = 0; i < capacity; i++) {
+        preprocess(engine, makeImage(16 + i, 16));
+    }
+
+    auto image = makeImage(16, 16, NHWC);
+    auto result = preprocess(engine, image);
+    auto stats = engine.getGraphCacheStats();
+    ASSERT_EQ(1u, stats.evictions);
+    ASSERT_EQ(0u, stats.reshapes);
+    ASSERT_EQ(reference(image), result);
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <ie_compound_blob.h>
+#include <ie_preprocess_data.hpp>
+#include <ie_preprocess_gapi.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+// an I420 frame is pre-processed as the NV12 frame with the same Y plane and the U and V planes interleaved
+class PreprocI420Tests : public ::testing::TestWithParam<size_t> {
+protected:
+    static Blob::Ptr makePlane(size_t channels, size_t height, size_t width, size_t seed) {
+        auto blob = make_shared_blob<uint8_t>({ Precision::U8, { 1, channels, height, width }, NHWC });
+        blob->allocate();
+        auto data = blob->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = static_cast<uint8_t>((i * 37 + seed * 101 + 11) % 251);
+        }
+        return blob;
+    }
+
+    void SetUp() override {
+        if (!PreprocEngine::useGAPI())
+            GTEST_SKIP();
+
+        y = makePlane(1, HEIGHT, WIDTH, 0);
+        u = makePlane(1, HEIGHT / 2, WIDTH / 2, 1);
+        v = makePlane(1, HEIGHT / 2, WIDTH / 2, 2);
+
+        auto uv = make_shared_blob<uint8_t>({ Precision::U8, { 1, 2, HEIGHT / 2, WIDTH / 2 }, NHWC });
+        uv->allocate();
+        auto pu = u->cbuffer().as<const uint8_t*>();
+        auto pv = v->cbuffer().as<const uint8_t*>();
+        auto puv = uv->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < u->size(); i++) {
+            puv[2 * i]     = pu[i];
+            puv[2 * i + 1] = pv[i];
+        }
+
+        i420 = make_shared_blob<I420Blob>(y, u, v);
+        nv12 = make_shared_blob<NV12Blob>(y, uv);
+    }
+
+    std::vector<uint8_t> preprocess(const Blob::Ptr &image, ColorFormat fmt, size_t batch = 1) {
+        const size_t outSize = GetParam();
+        Blob::Ptr out = make_shared_blob<uint8_t>({ Precision::U8, { batch, 3, outSize, outSize }, NCHW });
+        out->allocate();
+
+        PreProcessInfo info;
+        info.setResizeAlgorithm(RESIZE_BILINEAR);
+        info.setColorFormat(fmt);
+
+        PreProcessData data;
+        data.setRoiBlob(image);
+        data.execute(out, info, false);
+
+        auto result = out->cbuffer().as<const uint8_t*>();
+        return std::vector<uint8_t>(result, result + out->size());
+    }
+
+    static const size_t HEIGHT = 32;
+    static const size_t WIDTH = 48;
+
+    Blob::Ptr y, u, v;
+    Blob::Ptr i420, nv12;
+};
+
+TEST_P(PreprocI420Tests, frameIsConvertedAsNV12) {
+    ASSERT_EQ(preprocess(nv12, ColorFormat::NV12), preprocess(i420, ColorFormat::I420));
+}
+
+TEST_P(PreprocI420Tests, roiIsConvertedAsNV12) {
+    const ROI roi = { 0, 6, 4, 24, 16 };
+    ASSERT_EQ(preprocess(make_shared_blob(nv12, roi), ColorFormat::NV12),
+              preprocess(make_shared_blob(i420, roi), ColorFormat::I420));
+}
+
+TEST_P(PreprocI420Tests, batchIsConvertedAsNV12) {
+    const std::vector<ROI> rois = { { 0, 0, 0, 16, 16 }, { 1, 4, 6, 32, 20 }, { 2, 10, 2, 38, 30 } };
+    ASSERT_EQ(preprocess(make_shared_blob(nv12, rois), ColorFormat::NV12, rois.size()),
+              preprocess(make_shared_blob(i420, rois), ColorFormat::I420, rois.size()));
+}
+
+// the frame and the ROIs are both downscaled and upscaled
+INSTANTIATE_TEST_CASE_P(
+        PreprocI420, PreprocI420Tests,
+        Values(8, 32));
@@ -0,0 +1,401 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu_detector.hpp>
+
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/ie_preprocess_gapi_kernels_sse42.hpp"
+#endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/ie_preprocess_gapi_kernels_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/ie_preprocess_gapi_kernels_avx512.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using cv::gapi::own::Size;
+
+namespace {
+
+// lengths are not multiples of the vector lengths, so the overlapped and scalar tails are covered
+const vector<int> rowLengths = { 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 130 };
+// color conversion kernels process pairs of pixels
+const vector<int> yuvWidths = { 2, 6, 16, 30, 32, 34, 62, 64, 66, 96, 130 };
+
+template <typename T>
+vector<T> makeRow(size_t size, size_t seed) {
+    vector<T> row(size);
+    for (size_t i = 0; i < size; i++) {
+        row[i] = static_cast<T>((i * 37 + seed * 101 + 11) % 251);
+    }
+    return row;
+}
+
+// scalar reference of the BT.601 conversion, the same fixed point arithmetic as the fallback kernels
+const int ITUR_BT_601_CY = 1220542;
+const int ITUR_BT_601_CUB = 2116026;
+const int ITUR_BT_601_CUG = -409993;
+const int ITUR_BT_601_CVG = -852492;
+const int ITUR_BT_601_CVR = 1673527;
+const int ITUR_BT_601_SHIFT = 20;
+
+uint8_t saturate(int v) {
+    return static_cast<uint8_t>(std::min(std::max(v, 0), 255));
+}
+
+void yuvToRGBRef(uint8_t y, uint8_t u, uint8_t v, uint8_t *rgb) {
+    int uu = static_cast<int>(u) - 128;
+    int vv = static_cast<int>(v) - 128;
+    int ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+    int guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+    int buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+    int yy = std::max(0, static_cast<int>(y) - 16) * ITUR_BT_601_CY;
+    rgb[0] = saturate((yy + ruv) >> ITUR_BT_601_SHIFT);
+    rgb[1] = saturate((yy + guv) >> ITUR_BT_601_SHIFT);
+    rgb[2] = saturate((yy + buv) >> ITUR_BT_601_SHIFT);
+}
+
+// the fixed point arithmetic of the scalar bi-linear resize, alpha0 + alpha1 == ONE
+const int ONE = 1 << 15;
+
+short saturateShort(int v) {
+    return static_cast<short>(std::min(std::max(v, -32768), 32767));
+}
+
+uint8_t interpolate(short alpha0, uint8_t src0, short alpha1, uint8_t src1) {
+    return static_cast<uint8_t>((src0 * alpha0 + src1 * alpha1 + (1 << 14)) >> 15);
+}
+
+}  // namespace
+
+// The kernels of every instruction set supported by the CPU are compared with the scalar references,
+// the fluid kernels call only the widest one
+class PreprocessRowKernelTests : public TestWithParam<int> {
+protected:
+    template <typename T>
+    using MergeKernel = void (*)(const T[], const T[], const T[], T[], int);
+    template <typename T>
+    using SplitKernel = void (*)(const T[], T[], T[], T[], int);
+    template <typename T>
+    using CopyKernel = void (*)(const T[], T[], int);
+
+    template <typename T>
+    void testMerge(MergeKernel<T> kernel) {
+        const int length = GetParam();
+        auto in0 = makeRow<T>(length, 0), in1 = makeRow<T>(length, 1), in2 = makeRow<T>(length, 2);
+        // the guard elements after the row must not be written
+        vector<T> out(3 * length + 1, T(0));
+
+        kernel(in0.data(), in1.data(), in2.data(), out.data(), length);
+
+        for (int i = 0; i < length; i++) {
+            ASSERT_EQ(in0[i], out[3 * i]) << "i=" << i;
+            ASSERT_EQ(in1[i], out[3 * i + 1]) << "i=" << i;
+            ASSERT_EQ(in2[i], out[3 * i + 2]) << "i=" << i;
+        }
+        ASSERT_EQ(T(0), out[3 * length]);
+    }
+
+    template <typename T>
+    void testSplit(SplitKernel<T> kernel) {
+        const int length = GetParam();
+        auto in = makeRow<T>(3 * length, 0);
+        vector<T> out0(length + 1, T(0)), out1(length + 1, T(0)), out2(length + 1, T(0));
+
+        kernel(in.data(), out0.data(), out1.data(), out2.data(), length);
+
+        for (int i = 0; i < length; i++) {
+            ASSERT_EQ(in[3 * i], out0[i]) << "i=" << i;
+            ASSERT_EQ(in[3 * i + 1], out1[i]) << "i=" << i;
+            ASSERT_EQ(in[3 * i + 2], out2[i]) << "i=" << i;
+        }
+        ASSERT_EQ(T(0), out0[length]);
+        ASSERT_EQ(T(0), out1[length]);
+        ASSERT_EQ(T(0), out2[length]);
+    }
+
+    template <typename T>
+    void testCopy(CopyKernel<T> kernel) {
+        const int length = GetParam();
+        auto in = makeRow<T>(length, 0);
+        vector<T> out(length + 1, T(0));
+
+        kernel(in.data(), out.data(), length);
+
+        for (int i = 0; i < length; i++) {
+            ASSERT_EQ(in[i], out[i]) << "i=" << i;
+        }
+        ASSERT_EQ(T(0), out[length]);
+    }
+};
+
+#ifdef HAVE_SSE
+TEST_P(PreprocessRowKernelTests, sse42) {
+    if (!with_cpu_x86_sse42())
+        return;
+    testMerge<uint8_t>(gapi::kernels::mergeRow_8UC3);
+    testMerge<float>(gapi::kernels::mergeRow_32FC3);
+    testSplit<uint8_t>(gapi::kernels::splitRow_8UC3);
+    testSplit<float>(gapi::kernels::splitRow_32FC3);
+    testCopy<uint8_t>(gapi::kernels::copyRow_8U);
+    testCopy<float>(gapi::kernels::copyRow_32F);
+}
+#endif
+
+#ifdef HAVE_AVX2
+TEST_P(PreprocessRowKernelTests, avx2) {
+    if (!with_cpu_x86_avx2())
+        return;
+    testMerge<uint8_t>(gapi::kernels::avx2::mergeRow_8UC3);
+    testMerge<float>(gapi::kernels::avx2::mergeRow_32FC3);
+    testSplit<uint8_t>(gapi::kernels::avx2::splitRow_8UC3);
+    testSplit<float>(gapi::kernels::avx2::splitRow_32FC3);
+    testCopy<uint8_t>(gapi::kernels::avx2::copyRow_8U);
+    testCopy<float>(gapi::kernels::avx2::copyRow_32F);
+}
+#endif
+
+#ifdef HAVE_AVX512
+TEST_P(PreprocessRowKernelTests, avx512) {
+    if (!with_cpu_x86_avx512_core())
+        return;
+    testMerge<uint8_t>(gapi::kernels::avx512::mergeRow_8UC3);
+    testMerge<float>(gapi::kernels::avx512::mergeRow_32FC3);
+    testSplit<uint8_t>(gapi::kernels::avx512::splitRow_8UC3);
+    testSplit<float>(gapi::kernels::avx512::splitRow_32FC3);
+    testCopy<uint8_t>(gapi::kernels::avx512::copyRow_8U);
+    testCopy<float>(gapi::kernels::avx512::copyRow_32F);
+}
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+        PreprocessRowKernels, PreprocessRowKernelTests,
+        ValuesIn(rowLengths));
+
+class PreprocessColorKernelTests : public TestWithParam<int> {
+protected:
+    using NV12Kernel = void (*)(const uint8_t**, const uint8_t*, uint8_t**, int);
+
+    // two rows of luma share one row of chroma
+    void compare(const vector<uint8_t> *y, const uint8_t *u, const uint8_t *v, size_t uvStep,
+                 const vector<uint8_t> *rgb, int width) {
+        for (int row = 0; row < 2; row++)
+        for (int x = 0; x < width; x++) {
+            uint8_t ref[3];
+            yuvToRGBRef(y[row][x], u[x / 2 * uvStep], v[x / 2 * uvStep], ref);
+            for (int c = 0; c < 3; c++) {
+                ASSERT_EQ(ref[c], rgb[row][3 * x + c]) << "row=" << row << " x=" << x << " c=" << c;
+            }
+        }
+        ASSERT_EQ(0, rgb[0][3 * width]);
+        ASSERT_EQ(0, rgb[1][3 * width]);
+    }
+
+    void testNV12(NV12Kernel kernel) {
+        const int width = GetParam();
+        vector<uint8_t> y[2] = { makeRow<uint8_t>(width, 0), makeRow<uint8_t>(width, 1) };
+        auto uv = makeRow<uint8_t>(width, 2);
+        vector<uint8_t> rgb[2] = { vector<uint8_t>(3 * width + 1, 0), vector<uint8_t>(3 * width + 1, 0) };
+
+        const uint8_t *yRows[2] = { y[0].data(), y[1].data() };
+        uint8_t *rgbRows[2] = { rgb[0].data(), rgb[1].data() };
+        kernel(yRows, uv.data(), rgbRows, width);
+
+        compare(y, uv.data(), uv.data() + 1, 2, rgb, width);
+    }
+};
+
+#ifdef HAVE_SSE
+TEST_P(PreprocessColorKernelTests, sse42) {
+    if (!with_cpu_x86_sse42())
+        return;
+    testNV12(gapi::kernels::calculate_nv12_to_rgb);
+}
+#endif
+
+#ifdef HAVE_AVX2
+TEST_P(PreprocessColorKernelTests, avx2) {
+    if (!with_cpu_x86_avx2())
+        return;
+    testNV12(gapi::kernels::avx2::calculate_nv12_to_rgb);
+}
+#endif
+
+#ifdef HAVE_AVX512
+TEST_P(PreprocessColorKernelTests, avx512) {
+    if (!with_cpu_x86_avx512_core())
+        return;
+    testNV12(gapi::kernels::avx512::calculate_nv12_to_rgb);
+}
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+        PreprocessColorKernels, PreprocessColorKernelTests,
+        ValuesIn(yuvWidths));
+
+// Rows of the bi-linear resize take the coefficients and the indices computed by the fluid kernel
+// for the whole image, so the scratch is built here the same way
+class PreprocessResizeKernelTests : public TestWithParam<std::tuple<Size, Size>> {
+protected:
+    using ResizeKernel = void (*)(uint8_t *[], const uint8_t *[], const uint8_t *[], const short[], const short[],
+                                  const short[], uint8_t[], const Size&, const Size&, int);
+    using ResizeKernelSSE = void (*)(uint8_t *[], const uint8_t *[], const uint8_t *[], const short[], const short[],
+                                     const short[], const short[], uint8_t[], const Size&, const Size&, int);
+
+    static const int LPI = 4;
+
+    Size inSz, outSz;
+    vector<vector<uint8_t>> image;
+    vector<short> alpha, clone, mapsx, beta, mapsy;
+
+    // the source pixel and its weight of the output coordinate, the second pixel is the next one
+    static void map(double ratio, int max, int outCoord, short &alpha0, int &index0, int &index1) {
+        float f = (outCoord + 0.5f) * static_cast<float>(ratio) - 0.5f;
+        int s = static_cast<int>(std::floor(f));
+        f -= s;
+        index0 = std::max(s, 0);
+        index1 = (f == 0.f || s + 1 >= max) ? s : s + 1;
+        alpha0 = saturateShort(static_cast<int>(std::rint(ONE * (1.0f - f))));
+    }
+
+    void SetUp() override {
+        std::tie(inSz, outSz) = GetParam();
+        for (int y = 0; y < inSz.height; y++) {
+            image.push_back(makeRow<uint8_t>(inSz.width, y));
+        }
+
+        const double hRatio = static_cast<double>(inSz.width) / outSz.width;
+        for (int x = 0; x < outSz.width; x++) {
+            short alpha0;
+            int index0, index1;
+            map(hRatio, inSz.width, x, alpha0, index0, index1);
+            // the second pixel is always the next one, the weights keep the result
+            if (index1 != index0 + 1) {
+                if (index0 < inSz.width - 1) {
+                    alpha0 = saturateShort(ONE);
+                } else {
+                    alpha0 = 0;
+                    index0--;
+                }
+            }
+            alpha.push_back(alpha0);
+            mapsx.push_back(static_cast<short>(index0));
+            clone.insert(clone.end(), 4, alpha0);
+        }
+
+        const double vRatio = static_cast<double>(inSz.height) / outSz.height;
+        mapsy.resize(2 * outSz.height);
+        for (int y = 0; y < outSz.height; y++) {
+            short beta0;
+            int index0, index1;
+            map(vRatio, inSz.height, y, beta0, index0, index1);
+            beta.push_back(beta0);
+            mapsy[y] = static_cast<short>(index0);
+            mapsy[outSz.height + y] = static_cast<short>(index1);
+        }
+    }
+
+    // the scalar kernel of the fluid resize
+    vector<uint8_t> reference(int y) {
+        vector<uint8_t> row(outSz.width);
+        const auto &src0 = image[mapsy[y]], &src1 = image[mapsy[outSz.height + y]];
+        const short beta0 = beta[y], beta1 = saturateShort(ONE - beta[y]);
+        for (int x = 0; x < outSz.width; x++) {
+            const short alpha0 = alpha[x], alpha1 = saturateShort(ONE - alpha[x]);
+            const int sx0 = mapsx[x], sx1 = sx0 + 1;
+            const uint8_t tmp0 = interpolate(beta0, src0[sx0], beta1, src1[sx0]);
+            const uint8_t tmp1 = interpolate(beta0, src0[sx1], beta1, src1[sx1]);
+            row[x] = interpolate(alpha0, tmp0, alpha1, tmp1);
+        }
+        return row;
+    }
+
+    // the output rows are processed by the tiles of LPI rows as the fluid backend calls the kernel
+    template <typename Run>
+    void test(Run run) {
+        vector<uint8_t> tmp(inSz.width * LPI);
+        for (int outY = 0; outY < outSz.height; outY += LPI) {
+            const int lpi = std::min(LPI, outSz.height - outY);
+            const uint8_t *src0[LPI], *src1[LPI];
+            uint8_t *dst[LPI];
+            vector<vector<uint8_t>> out(lpi, vector<uint8_t>(outSz.width + 1, 0));
+            for (int l = 0; l < lpi; l++) {
+                src0[l] = image[mapsy[outY + l]].data();
+                src1[l] = image[mapsy[outSz.height + outY + l]].data();
+                dst[l] = out[l].data();
+            }
+
+            run(dst, src0, src1, &beta[outY], tmp.data(), lpi);
+
+            for (int l = 0; l < lpi; l++) {
+                // the guard element after the row must not be written
+                ASSERT_EQ(0, out[l][outSz.width]) << "y=" << outY + l;
+                out[l].pop_back();
+                ASSERT_EQ(reference(outY + l), out[l]) << "y=" << outY + l;
+            }
+        }
+    }
+
+    void testResize(ResizeKernel kernel) {
+        test([&](uint8_t *dst[], const uint8_t *src0[], const uint8_t *src1[], const short *rowBeta,
+                 uint8_t *tmp, int lpi) {
+            kernel(dst, src0, src1, alpha.data(), mapsx.data(), rowBeta, tmp, inSz, outSz, lpi);
+        });
+    }
+
+    void testResize(ResizeKernelSSE kernel) {
+        test([&](uint8_t *dst[], const uint8_t *src0[], const uint8_t *src1[], const short *rowBeta,
+                 uint8_t *tmp, int lpi) {
+            kernel(dst, src0, src1, alpha.data(), clone.data(), mapsx.data(), rowBeta, tmp, inSz, outSz, lpi);
+        });
+    }
+};
+
+#ifdef HAVE_SSE
+TEST_P(PreprocessResizeKernelTests, sse42) {
+    if (!with_cpu_x86_sse42())
+        return;
+    testResize(gapi::kernels::calcRowLinear_8U);
+}
+#endif
+
+#ifdef HAVE_AVX2
+TEST_P(PreprocessResizeKernelTests, avx2) {
+    if (!with_cpu_x86_avx2())
+        return;
+    testResize(gapi::kernels::avx2::calcRowLinear_8U);
+}
+#endif
+
+#ifdef HAVE_AVX512
+TEST_P(PreprocessResizeKernelTests, avx512) {
+    if (!with_cpu_x86_avx512_core())
+        return;
+    testResize(gapi::kernels::avx512::calcRowLinear_8U);
+}
+#endif
+
+// the widths are at least the ones required by the widest kernel, the fluid kernel calls
+// the scalar code for narrower images; the sizes cover the equal, down- and upscaled dimensions
+// and the widths which are not multiples of the vector lengths
+INSTANTIATE_TEST_CASE_P(
+        PreprocessResizeKernels, PreprocessResizeKernelTests,
+        Values(std::make_tuple(Size(47, 5), Size(47, 5)),
+               std::make_tuple(Size(32, 8), Size(32, 5)),
+               std::make_tuple(Size(64, 8), Size(33, 8)),
+               std::make_tuple(Size(40, 4), Size(100, 7)),
+               std::make_tuple(Size(130, 16), Size(47, 9)),
+               std::make_tuple(Size(33, 7), Size(64, 13)),
+               std::make_tuple(Size(96, 3), Size(95, 11))));
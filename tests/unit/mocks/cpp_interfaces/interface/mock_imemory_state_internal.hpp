@@ -17,4 +17,5 @@ class MockIMemoryStateInternal : public InferenceEngine::IMemoryStateInternal {
     MOCK_METHOD0(Reset, void ());
     MOCK_METHOD1(SetState, void (Blob::Ptr ));
     MOCK_CONST_METHOD0(GetLastState, Blob::CPtr ());
+    MOCK_METHOD1(SwapState, void (Blob::Ptr &));
 };